@@ -59,15 +59,16 @@ struct cartesian2 final : public coordinate_base<cartesian2, transform3_t> {
 
     /** This method transform from a point from global cartesian 3D frame to a
      * local 2D cartesian point */
-    DETRAY_HOST_DEVICE
-    inline point3 global_to_local(const transform3_t &trf3, const point3 &p,
-                                  const vector3 & /*d*/) const {
+    template <typename placement_t>
+    DETRAY_HOST_DEVICE inline point3 global_to_local(
+        const placement_t &trf3, const point3 &p, const vector3 & /*d*/) const {
         return trf3.point_to_local(p);
     }
 
     /** This method transform from a local 2D cartesian point to a point global
      * cartesian 3D frame*/
-    DETRAY_HOST_DEVICE inline point3 local_to_global(const transform3_t &trf3,
+    template <typename placement_t>
+    DETRAY_HOST_DEVICE inline point3 local_to_global(const placement_t &trf3,
                                                      const point3 &p) const {
         return trf3.point_to_global(p);
     }
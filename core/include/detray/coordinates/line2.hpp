@@ -58,9 +58,9 @@ struct line2 : public coordinate_base<line2, transform3_t> {
 
     /** This method transform from a point from global cartesian 3D frame to a
      * local 2D line point */
-    DETRAY_HOST_DEVICE
-    inline point3 global_to_local(const transform3_t &trf, const point3 &p,
-                                  const vector3 &d) const {
+    template <typename placement_t>
+    DETRAY_HOST_DEVICE inline point3 global_to_local(
+        const placement_t &trf, const point3 &p, const vector3 &d) const {
 
         const auto local3 = trf.point_to_local(p);
 
@@ -83,7 +83,8 @@ struct line2 : public coordinate_base<line2, transform3_t> {
 
     /** This method transform from a local 2D line point to a point global
      * cartesian 3D frame*/
-    DETRAY_HOST_DEVICE inline point3 local_to_global(const transform3_t &trf,
+    template <typename placement_t>
+    DETRAY_HOST_DEVICE inline point3 local_to_global(const placement_t &trf,
                                                      const point3 &p) const {
         const scalar_type R = std::abs(p[0]);
         const point3 local = {R * math_ns::cos(p[2]), R * math_ns::sin(p[2]),
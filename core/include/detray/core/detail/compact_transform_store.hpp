@@ -0,0 +1,256 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/data_context.hpp"
+#include "detray/core/detail/single_store.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s)
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Placement that only keeps the rotation and translation.
+///
+/// The full @c transform3 holds a 4x4 matrix and its inverse (32 scalars).
+/// For a rigid placement, the same information is contained in the 3x3
+/// rotation matrix and the translation (12 scalars), since the inverse
+/// rotation is the transpose of the rotation.
+///
+/// @tparam transform3_t the full transform type of the algebra plugin
+template <typename transform3_t>
+class compact_transform3 {
+
+    public:
+    using transform3_type = transform3_t;
+    using scalar_type = typename transform3_t::scalar_type;
+    using point3 = typename transform3_t::point3;
+    using vector3 = typename transform3_t::vector3;
+
+    /// Identity
+    constexpr compact_transform3() = default;
+
+    /// Construct from the full transform @param trf
+    DETRAY_HOST_DEVICE
+    compact_transform3(const transform3_t &trf) {
+        const vector3 x = trf.x();
+        const vector3 y = trf.y();
+        const vector3 z = trf.z();
+        const point3 t = trf.translation();
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            m_data[i] = x[i];
+            m_data[3u + i] = y[i];
+            m_data[6u + i] = z[i];
+            m_data[9u + i] = t[i];
+        }
+    }
+
+    /// @returns the full transform (the inverse is computed by the plugin)
+    DETRAY_HOST_DEVICE
+    transform3_t expand() const { return transform3_t{t(), x(), y(), z()}; }
+
+    /// @returns the local x-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    vector3 x() const { return {m_data[0], m_data[1], m_data[2]}; }
+
+    /// @returns the local y-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    vector3 y() const { return {m_data[3], m_data[4], m_data[5]}; }
+
+    /// @returns the local z-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    vector3 z() const { return {m_data[6], m_data[7], m_data[8]}; }
+
+    /// @returns the translation
+    DETRAY_HOST_DEVICE
+    point3 translation() const { return t(); }
+
+    /// @returns the point @param p transformed into the global frame
+    DETRAY_HOST_DEVICE
+    point3 point_to_global(const point3 &p) const {
+        return {rotate(p, 0u) + m_data[9], rotate(p, 1u) + m_data[10],
+                rotate(p, 2u) + m_data[11]};
+    }
+
+    /// @returns the point @param p transformed into the local frame
+    DETRAY_HOST_DEVICE
+    point3 point_to_local(const point3 &p) const {
+        const vector3 d{p[0] - m_data[9], p[1] - m_data[10],
+                        p[2] - m_data[11]};
+        return {rotate_inv(d, 0u), rotate_inv(d, 1u), rotate_inv(d, 2u)};
+    }
+
+    /// @returns the vector @param v rotated into the global frame
+    DETRAY_HOST_DEVICE
+    vector3 vector_to_global(const vector3 &v) const {
+        return {rotate(v, 0u), rotate(v, 1u), rotate(v, 2u)};
+    }
+
+    /// @returns the vector @param v rotated into the local frame
+    DETRAY_HOST_DEVICE
+    vector3 vector_to_local(const vector3 &v) const {
+        return {rotate_inv(v, 0u), rotate_inv(v, 1u), rotate_inv(v, 2u)};
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    bool operator==(const compact_transform3 &rhs) const {
+        for (unsigned int i = 0u; i < 12u; ++i) {
+            if (m_data[i] != rhs.m_data[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private:
+    /// @returns the translation
+    DETRAY_HOST_DEVICE
+    point3 t() const { return {m_data[9], m_data[10], m_data[11]}; }
+
+    /// @returns the i-th component of the rotated vector @param v
+    DETRAY_HOST_DEVICE
+    scalar_type rotate(const vector3 &v, const unsigned int i) const {
+        return m_data[i] * v[0] + m_data[3u + i] * v[1] + m_data[6u + i] * v[2];
+    }
+
+    /// @returns the i-th component of the inversely rotated vector @param v
+    /// (rotation with the transpose)
+    DETRAY_HOST_DEVICE
+    scalar_type rotate_inv(const vector3 &v, const unsigned int i) const {
+        const unsigned int col{3u * i};
+        return m_data[col] * v[0] + m_data[col + 1u] * v[1] +
+               m_data[col + 2u] * v[2];
+    }
+
+    /// Rotation columns (local x, y and z axes), followed by the translation
+    darray<scalar_type, 12> m_data{1.f, 0.f, 0.f, 0.f, 1.f, 0.f,
+                                   0.f, 0.f, 1.f, 0.f, 0.f, 0.f};
+};
+
+/// @brief Transform store that keeps the placements in compact form.
+///
+/// Can be used as @c transform_store in the detector metadata in place of a
+/// @c single_store of full transforms. The intersection kernels and the
+/// navigator (safety distance, portal entry cache) fetch the compact
+/// placement directly (see @c detail::placement ), so that they work with the
+/// transpose of the rotation and never build a full transform. The element
+/// access returns the full
+/// transform by value, which is rebuilt from the compact placement, for
+/// the remaining users (e.g. the jacobians).
+///
+/// @tparam transform3_t the full transform type of the algebra plugin
+/// @tparam container_t The type of container to use for the data collection.
+/// @tparam context_t the context with which to retrieve the correct data.
+template <typename transform3_t,
+          template <typename...> class container_t = dvector,
+          typename context_t = empty_context>
+class compact_transform_store
+    : public single_store<compact_transform3<transform3_t>, container_t,
+                          context_t> {
+
+    using store_base =
+        single_store<compact_transform3<transform3_t>, container_t, context_t>;
+
+    public:
+    /// The element type that is handed out by the store
+    using value_type = transform3_t;
+    using compact_type = compact_transform3<transform3_t>;
+    using context_type = context_t;
+
+    /// Same constructors as the @c single_store
+    using store_base::store_base;
+
+    /// Empty container
+    constexpr compact_transform_store() = default;
+
+    /// Elementwise access
+    DETRAY_HOST_DEVICE
+    value_type operator[](const dindex i) const {
+        return store_base::operator[](i).expand();
+    }
+
+    /// @returns context based access to an element (also range checked)
+    DETRAY_HOST_DEVICE
+    value_type at(const dindex i, const context_type &ctx) const {
+        return store_base::at(i, ctx).expand();
+    }
+
+    /// @returns the compact placement at position @param i
+    DETRAY_HOST_DEVICE
+    const compact_type &compact(const dindex i) const {
+        return store_base::operator[](i);
+    }
+
+    /// Add a new transform to the collection (stored in compact form)
+    DETRAY_HOST void push_back(const transform3_t &trf,
+                               const context_type &ctx = {}) noexcept(false) {
+        store_base::push_back(compact_type{trf}, ctx);
+    }
+
+    /// Add a new transform, that is constructed from @param args , to the
+    /// collection (stored in compact form)
+    template <typename... Args>
+    DETRAY_HOST decltype(auto) emplace_back(const context_type &ctx = {},
+                                            Args &&... args) noexcept(false) {
+        return store_base::emplace_back(
+            ctx, compact_type{transform3_t(std::forward<Args>(args)...)});
+    }
+
+    /// Append another store to the current one
+    DETRAY_HOST void append(compact_transform_store &other,
+                            const context_type &ctx = {}) noexcept(false) {
+        store_base::append(static_cast<store_base &>(other), ctx);
+    }
+
+    /// Append another store to the current one - move
+    DETRAY_HOST void append(compact_transform_store &&other,
+                            const context_type &ctx = {}) noexcept(false) {
+        store_base::append(static_cast<store_base &&>(other), ctx);
+    }
+};
+
+namespace detail {
+
+/// Checks whether a transform store keeps its placements in compact form
+/// @{
+template <typename T, typename = void>
+struct has_compact_placements : public std::false_type {};
+
+template <typename T>
+struct has_compact_placements<
+    T, std::void_t<decltype(std::declval<const T &>().compact(dindex{0u}))>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool has_compact_placements_v =
+    has_compact_placements<T>::value;
+/// @}
+
+/// @returns the placement at position @param i in the transform store
+/// @param transforms in the form that the intersectors can use directly:
+/// The compact placement, if the store provides it, the full transform
+/// otherwise.
+template <typename transform_container_t>
+DETRAY_HOST_DEVICE inline decltype(auto) placement(
+    const transform_container_t &transforms, const dindex i) {
+    if constexpr (has_compact_placements_v<transform_container_t>) {
+        return transforms.compact(i);
+    } else {
+        return transforms[i];
+    }
+}
+
+}  // namespace detail
+
+}  // namespace detray
@@ -0,0 +1,252 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/utils/tuple.hpp"
+#include "detray/utils/tuple_helpers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Alignment of every container in a snapshot block (in bytes)
+inline constexpr std::size_t snapshot_alignment{64u};
+
+/// @returns @param offset rounded up to the snapshot alignment
+DETRAY_HOST inline constexpr std::size_t snapshot_align(
+    const std::size_t offset) {
+    return (offset + snapshot_alignment - 1u) / snapshot_alignment *
+           snapshot_alignment;
+}
+
+/// @brief Owning handle of a snapshot memory block.
+///
+/// Allocates an aligned block of raw memory from a vecmem memory resource
+/// (host, pinned, managed or device memory) and releases it again on
+/// destruction.
+class snapshot_block {
+
+    public:
+    snapshot_block() = default;
+
+    /// Allocate @param size bytes from the memory resource @param mr
+    DETRAY_HOST
+    snapshot_block(const std::size_t size, vecmem::memory_resource &mr)
+        : m_size{size}, m_resource{&mr} {
+        if (m_size > 0u) {
+            m_data = static_cast<std::byte *>(
+                m_resource->allocate(m_size, snapshot_alignment));
+        }
+    }
+
+    /// Move only
+    /// @{
+    snapshot_block(const snapshot_block &) = delete;
+    snapshot_block &operator=(const snapshot_block &) = delete;
+
+    DETRAY_HOST
+    snapshot_block(snapshot_block &&other) noexcept
+        : m_size{std::exchange(other.m_size, 0u)},
+          m_resource{std::exchange(other.m_resource, nullptr)},
+          m_data{std::exchange(other.m_data, nullptr)} {}
+
+    DETRAY_HOST
+    snapshot_block &operator=(snapshot_block &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_size = std::exchange(other.m_size, 0u);
+            m_resource = std::exchange(other.m_resource, nullptr);
+            m_data = std::exchange(other.m_data, nullptr);
+        }
+        return *this;
+    }
+    /// @}
+
+    DETRAY_HOST
+    ~snapshot_block() { release(); }
+
+    /// @returns the size of the block in bytes
+    DETRAY_HOST
+    std::size_t size() const { return m_size; }
+
+    /// @returns the start address of the block
+    DETRAY_HOST
+    std::byte *data() const { return m_data; }
+
+    private:
+    /// Give the memory back to the resource
+    DETRAY_HOST
+    void release() {
+        if (m_data != nullptr) {
+            m_resource->deallocate(m_data, m_size, snapshot_alignment);
+            m_data = nullptr;
+        }
+    }
+
+    std::size_t m_size{0u};
+    vecmem::memory_resource *m_resource{nullptr};
+    std::byte *m_data{nullptr};
+};
+
+/// @returns the end offset of the data of @param vec_view , if it is laid out
+/// behind @param offset in a snapshot block
+template <typename T>
+DETRAY_HOST std::size_t snapshot_end(const dvector_view<T> &vec_view,
+                                     const std::size_t offset) {
+    return snapshot_align(offset) + vec_view.size() * sizeof(T);
+}
+
+/// @brief Recursively get the end offset of a composite view - forward decl.
+template <typename... Ts>
+DETRAY_HOST std::size_t snapshot_end(const dmulti_view<Ts...> &data_view,
+                                     std::size_t offset);
+
+/// @brief Recursively get the end offset of a composite view
+template <typename... Ts, std::size_t... I>
+DETRAY_HOST std::size_t snapshot_end(const dmulti_view<Ts...> &data_view,
+                                     std::size_t offset,
+                                     std::index_sequence<I...> /*seq*/) {
+    ((offset = detail::snapshot_end(detail::get<I>(data_view.m_view), offset)),
+     ...);
+    return offset;
+}
+
+template <typename... Ts>
+DETRAY_HOST std::size_t snapshot_end(const dmulti_view<Ts...> &data_view,
+                                     std::size_t offset) {
+    return detail::snapshot_end(
+        data_view, offset,
+        std::make_index_sequence<
+            detail::tuple_size_v<decltype(data_view.m_view)>>{});
+}
+
+/// @brief Position of the data of a single vector view in a snapshot block
+struct snapshot_entry {
+    /// Offset of the first element from the start of the block (in bytes)
+    std::size_t offset{0u};
+    /// Number of elements
+    std::size_t size{0u};
+};
+
+/// Layout of a snapshot block: One entry per vector view in packing order
+using snapshot_layout = std::vector<snapshot_entry>;
+
+/// @brief Copy the data of @param vec_view into the staging memory
+/// @param staging at the next aligned position after @param offset and
+/// record its position in @param layout
+template <typename T>
+DETRAY_HOST void snapshot_pack(const dvector_view<T> &vec_view,
+                               std::byte *staging, snapshot_layout &layout,
+                               std::size_t &offset) {
+    offset = snapshot_align(offset);
+    const std::size_t n_bytes{vec_view.size() * sizeof(T)};
+
+    if (n_bytes > 0u) {
+        std::memcpy(staging + offset,
+                    static_cast<const void *>(vec_view.ptr()), n_bytes);
+    }
+    layout.push_back({offset, static_cast<std::size_t>(vec_view.size())});
+    offset += n_bytes;
+}
+
+/// @brief Recursively pack a composite view - forward declaration
+template <typename... Ts>
+DETRAY_HOST void snapshot_pack(const dmulti_view<Ts...> &data_view,
+                               std::byte *staging, snapshot_layout &layout,
+                               std::size_t &offset);
+
+/// @brief Recursively pack a composite view
+///
+/// Unwraps the view type at compile time and packs every view in member order
+template <typename... Ts, std::size_t... I>
+DETRAY_HOST void snapshot_pack(const dmulti_view<Ts...> &data_view,
+                               std::byte *staging, snapshot_layout &layout,
+                               std::size_t &offset,
+                               std::index_sequence<I...> /*seq*/) {
+    (detail::snapshot_pack(detail::get<I>(data_view.m_view), staging, layout,
+                           offset),
+     ...);
+}
+
+template <typename... Ts>
+DETRAY_HOST void snapshot_pack(const dmulti_view<Ts...> &data_view,
+                               std::byte *staging, snapshot_layout &layout,
+                               std::size_t &offset) {
+    detail::snapshot_pack(
+        data_view, staging, layout, offset,
+        std::make_index_sequence<
+            detail::tuple_size_v<decltype(data_view.m_view)>>{});
+}
+
+/// @brief Rebuilds a (composite) view of type @tparam view_t from the layout
+/// of a snapshot and the start address of a block that holds its data
+template <typename view_t>
+struct snapshot_unpacker {};
+
+/// Rebuild a vector view from the next entry of the layout
+template <typename T>
+struct snapshot_unpacker<dvector_view<T>> {
+
+    DETRAY_HOST
+    static dvector_view<T> get(const snapshot_layout &layout, std::byte *base,
+                               std::size_t &entry) {
+        const snapshot_entry &e = layout.at(entry++);
+        return {static_cast<typename dvector_view<T>::size_type>(e.size),
+                reinterpret_cast<T *>(base + e.offset)};
+    }
+};
+
+/// Rebuild a composite view from its member views (the braced
+/// initialization guarantees the order of evaluation)
+template <typename... Ts>
+struct snapshot_unpacker<dmulti_view_helper<true, Ts...>> {
+
+    DETRAY_HOST
+    static dmulti_view<Ts...> get(const snapshot_layout &layout,
+                                  std::byte *base, std::size_t &entry) {
+        return dmulti_view<Ts...>{
+            snapshot_unpacker<Ts>::get(layout, base, entry)...};
+    }
+};
+
+}  // namespace detail
+
+/// @returns the size in bytes of a snapshot block that holds all data of the
+/// (composite) view @param data_view
+template <typename view_t>
+DETRAY_HOST std::size_t get_snapshot_size(const view_t &data_view) {
+    return detail::snapshot_end(data_view, 0u);
+}
+
+/// @returns a (composite) view of type @tparam view_t into the snapshot block
+/// that starts at @param base and was packed with the layout @param layout
+///
+/// The layout only holds offsets, so the block can be moved or copied to a
+/// different memory resource and the views rebuilt from its new address.
+template <typename view_t>
+DETRAY_HOST view_t get_snapshot_view(const detail::snapshot_layout &layout,
+                                     std::byte *base) {
+    std::size_t entry{0u};
+    return detail::snapshot_unpacker<view_t>::get(layout, base, entry);
+}
+
+}  // namespace detray
@@ -21,9 +21,26 @@
 
 // System include(s)
 #include <type_traits>
+#include <utility>
 
 namespace detray {
 
+namespace detail {
+
+/// Check whether a collection type provides its own @c append method for
+/// collections of the same type (e.g. the @c grid_collection)
+/// @{
+template <typename T, typename = void>
+struct has_append : public std::false_type {};
+
+template <typename T>
+struct has_append<T, std::void_t<decltype(std::declval<T &>().append(
+                         std::declval<const T &>()))>>
+    : public std::true_type {};
+/// @}
+
+}  // namespace detail
+
 /// @brief Wraps a vecmem enabled tuple and adds functionality to handle data
 /// collections @tparam Ts.
 ///
@@ -244,8 +261,12 @@ class multi_store {
         auto &coll = const_cast<collection_t &>(
             detail::get<collection_t>(m_tuple_container));
 
-        coll.reserve(coll.size() + new_data.size());
-        coll.insert(coll.end(), new_data.begin(), new_data.end());
+        if constexpr (detail::has_append<collection_t>::value) {
+            coll.append(new_data);
+        } else {
+            coll.reserve(coll.size() + new_data.size());
+            coll.insert(coll.end(), new_data.begin(), new_data.end());
+        }
     }
 
     /// Add a new collection - move
@@ -265,9 +286,13 @@ class multi_store {
 
         auto &coll = detail::get<collection_t>(m_tuple_container);
 
-        coll.reserve(coll.size() + new_data.size());
-        coll.insert(coll.end(), std::make_move_iterator(new_data.begin()),
-                    std::make_move_iterator(new_data.end()));
+        if constexpr (detail::has_append<collection_t>::value) {
+            coll.append(new_data);
+        } else {
+            coll.reserve(coll.size() + new_data.size());
+            coll.insert(coll.end(), std::make_move_iterator(new_data.begin()),
+                        std::make_move_iterator(new_data.end()));
+        }
     }
 
     /// Append another store to the current one
@@ -9,29 +9,37 @@
 
 // Project include(s)
 #include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_snapshot.hpp"
 #include "detray/core/detail/container_views.hpp"
 #include "detray/core/detail/detector_kernel.hpp"
 #include "detray/core/detector_metadata.hpp"
 #include "detray/definitions/containers.hpp"
+#include "detray/definitions/pdg_particle.hpp"
 #include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
 #include "detray/geometry/detail/volume_descriptor.hpp"
 #include "detray/geometry/detector_volume.hpp"
 #include "detray/geometry/surface.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/tools/store_deduplicator.hpp"
 #include "detray/tools/volume_builder.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/ranges.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
 
 // Covfie include(s)
 #include <covfie/core/field.hpp>
 
 // System include(s)
 #include <algorithm>
+#include <cstddef>
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace detray {
 
@@ -60,14 +68,6 @@ class detector {
         detector<metadata, bfield_t, container_t>>;
 
     public:
-    /// Algebra types
-    /// @TODO: scalar as a template parameter
-    using scalar_type = scalar;
-
-    using point3 = __plugin::point3<scalar_type>;
-    using vector3 = __plugin::vector3<scalar_type>;
-    using point2 = __plugin::point2<scalar_type>;
-
     using bfield_backend_type = typename metadata::bfield_backend_t;
 
     using bfield_type = bfield_t<bfield_backend_type>;
@@ -94,17 +94,28 @@ class detector {
     using transform_link = typename transform_container::link_type;
     using geometry_context = typename transform_container::context_type;
 
+    /// Algebra types: The precision of the detector is given by the surface
+    /// placements of its metadata
+    using scalar_type = typename transform3::scalar_type;
+
+    using point3 = typename transform3::point3;
+    using vector3 = typename transform3::vector3;
+    using point2 = typename transform3::point2;
+
     /// Forward mask types that are present in this detector
     using mask_container =
         typename metadata::template mask_store<tuple_type, vector_type>;
     using masks = typename mask_container::value_types;
     using mask_link = typename mask_container::single_link;
 
-    /// Forward mask types that are present in this detector
+    /// Forward material types that are present in this detector
     using material_container =
-        typename metadata::template material_store<tuple_type, vector_type>;
+        typename metadata::template material_store<tuple_type, container_t>;
     using materials = typename material_container::value_types;
     using material_link = typename material_container::single_link;
+    /// Tabulated material interactions, keyed by the material store entries
+    using interaction_table_container =
+        interaction_table_store<interaction_table<scalar_type>, container_t>;
 
     /// Surface Finders: structures that enable neigborhood searches in the
     /// detector geometry during navigation. Can be different in each volume
@@ -125,7 +136,8 @@ class detector {
     using surface_container_t = vector_type<surface_type>;
     /// Volume type
     using geo_obj_ids = typename metadata::geo_objects;
-    using volume_type = volume_descriptor<geo_obj_ids, sf_finder_link>;
+    using volume_type =
+        volume_descriptor<geo_obj_ids, sf_finder_link, material_link>;
     using volume_container = vector_type<volume_type>;
 
     /// Volume finder definition: Make volume index available from track
@@ -147,7 +159,8 @@ class detector {
         typename mask_container::view_type,
         typename material_container::view_type,
         typename surface_container::view_type, dvector_view<surface_type>,
-        typename volume_finder::view_type>;
+        typename volume_finder::view_type,
+        typename interaction_table_container::view_type>;
 
     using const_view_type =
         dmulti_view<dvector_view<const volume_type>,
@@ -156,7 +169,8 @@ class detector {
                     typename material_container::const_view_type,
                     typename surface_container::const_view_type,
                     dvector_view<const surface_type>,
-                    typename volume_finder::const_view_type>;
+                    typename volume_finder::const_view_type,
+                    typename interaction_table_container::const_view_type>;
 
     /// Detector buffer types
     using buffer_type = dmulti_buffer<
@@ -164,7 +178,8 @@ class detector {
         typename mask_container::buffer_type,
         typename material_container::buffer_type,
         typename surface_container::buffer_type, dvector_buffer<surface_type>,
-        typename volume_finder::buffer_type>;
+        typename volume_finder::buffer_type,
+        typename interaction_table_container::buffer_type>;
 
     detector() = delete;
 
@@ -179,6 +194,7 @@ class detector {
           _surfaces(resource),
           _surface_lookup(&resource),
           _volume_finder(resource),
+          _interaction_tables(resource),
           _resource(&resource),
           _bfield(field) {}
 
@@ -193,6 +209,7 @@ class detector {
           _surfaces(resource),
           _surface_lookup(&resource),
           _volume_finder(resource),
+          _interaction_tables(resource),
           _resource(&resource),
           _bfield(typename bfield_type::backend_t::configuration_t{0.f, 0.f,
                                                                    0.f}) {}
@@ -212,6 +229,8 @@ class detector {
               detray::detail::get<5>(det_data._detector_data.m_view)),
           _volume_finder(
               detray::detail::get<6>(det_data._detector_data.m_view)),
+          _interaction_tables(
+              detray::detail::get<7>(det_data._detector_data.m_view)),
           _bfield(det_data._bfield_view) {}
 
     /// Add a new volume and retrieve a reference to it.
@@ -397,6 +416,31 @@ class detector {
         _materials.append(std::move(new_materials));
     }
 
+    /// @return the tabulated material interactions - const access
+    DETRAY_HOST_DEVICE
+    inline auto interaction_tables() const
+        -> const interaction_table_container & {
+        return _interaction_tables;
+    }
+
+    /// @return the tabulated material interactions - non-const access
+    DETRAY_HOST_DEVICE
+    inline auto interaction_tables() -> interaction_table_container & {
+        return _interaction_tables;
+    }
+
+    /// Tabulate the material interactions of all distinct materials in the
+    /// material store for the particle hypothesis given by @param pdg,
+    /// @param mass and @param q (default: muon). Has to be called again after
+    /// the material store was modified.
+    DETRAY_HOST
+    inline void update_interaction_tables(
+        const int pdg = pdg_particle::eMuon,
+        const scalar_type mass = 105.7f * unit<scalar_type>::MeV,
+        const scalar_type q = -1.f) {
+        _interaction_tables.build(_materials, pdg, mass, q);
+    }
+
     /// Get all transform in an index range from the detector - const
     ///
     /// @param ctx The context of the call
@@ -430,6 +474,7 @@ class detector {
     ///                         (either portals, sensitives or passives)
     /// @param masks_per_vol is the mask container per volume
     /// @param trfs_per_vol is the transform vector per volume
+    /// @param deduplicate let surfaces with identical masks share one entry
     ///
     /// @note can throw an exception if input data is inconsistent
     // TODO: Provide volume builder structure separate from the detector
@@ -437,7 +482,12 @@ class detector {
     DETRAY_HOST auto add_objects_per_volume(
         const geometry_context ctx, volume_type &vol,
         surface_container_t &surfaces_per_vol, mask_container &masks_per_vol,
-        transform_container &trfs_per_vol) noexcept(false) -> void {
+        transform_container &trfs_per_vol,
+        const bool deduplicate = false) noexcept(false) -> void {
+
+        if (deduplicate) {
+            store_deduplicator{}(surfaces_per_vol, masks_per_vol);
+        }
 
         // Append transforms
         const auto trf_offset = _transforms.size(ctx);
@@ -479,6 +529,8 @@ class detector {
     /// @param masks_per_vol is the mask container per volume
     /// @param materials_per_vol is the material container per volume
     /// @param trfs_per_vol is the transform vector per volume
+    /// @param deduplicate let surfaces with identical masks or material share
+    ///                    one entry
     ///
     /// @note can throw an exception if input data is inconsistent
     // TODO: Provide volume builder structure separate from the detector
@@ -487,7 +539,13 @@ class detector {
         const geometry_context ctx, volume_type &vol,
         surface_container_t &surfaces_per_vol, mask_container &masks_per_vol,
         transform_container &trfs_per_vol,
-        material_container &materials_per_vol) noexcept(false) -> void {
+        material_container &materials_per_vol,
+        const bool deduplicate = false) noexcept(false) -> void {
+
+        if (deduplicate) {
+            store_deduplicator{}(surfaces_per_vol, masks_per_vol,
+                                 materials_per_vol);
+        }
 
         // Update material index of surfaces
         for (auto &sf : surfaces_per_vol) {
@@ -640,6 +698,9 @@ class detector {
     /// Search structure for volumes
     volume_finder _volume_finder;
 
+    /// Tabulated material interactions for the distinct materials
+    interaction_table_container _interaction_tables;
+
     /// The memory resource represents how and where (host, device, managed)
     /// the memory for the detector containers is allocated
     vecmem::memory_resource *_resource = nullptr;
@@ -674,7 +735,9 @@ struct detector_buffer {
                            detray::get_buffer(det.surface_lookup(), mr, cpy,
                                               cpy_type, buff_type),
                            detray::get_buffer(det.volume_search_grid(), mr, cpy,
-                                              cpy_type, buff_type)),
+                                              cpy_type, buff_type),
+                           detray::get_buffer(det.interaction_tables(), mr,
+                                              cpy, cpy_type, buff_type)),
           _bfield_view(det.get_bfield()) {}
 
     /// Buffers were created manually
@@ -688,11 +751,13 @@ struct detector_buffer {
         typename detector_type::surface_container::buffer_type &&sf_buffer,
         detail::get_buffer_t<typename detector_type::surface_lookup_container>
             &&sf_lkp_buffer,
-        typename detector_type::volume_finder::buffer_type &&vgrd_buffer)
+        typename detector_type::volume_finder::buffer_type &&vgrd_buffer,
+        typename detector_type::interaction_table_container::buffer_type
+            &&tab_buffer)
         : _detector_buffer(std::move(vol_buffer), std::move(trf_buffer),
                            std::move(msk_buffer), std::move(mat_buffer),
                            std::move(sf_buffer), std::move(sf_lkp_buffer),
-                           std::move(vgrd_buffer)),
+                           std::move(vgrd_buffer), std::move(tab_buffer)),
           _bfield_view(det.get_bfield()) {}
 
     /// Buffers for the vecemem types
@@ -719,9 +784,97 @@ detector_buffer(
     typename detector<metadata, bfield_t, container_t>::surface_lookup_container
         &&,
     typename detector<metadata, bfield_t,
-                      container_t>::volume_finder::buffer_type &&)
+                      container_t>::volume_finder::buffer_type &&,
+    typename detector<metadata, bfield_t,
+                      container_t>::interaction_table_container::buffer_type &&)
     -> detector_buffer<metadata, bfield_t, container_t>;
 
+/// @brief Flat snapshot of the detector data in a single memory block.
+///
+/// Instead of one buffer per container, the data of all detector containers
+/// is laid out in one contiguous block, in which every container starts at an
+/// aligned offset. The block is allocated once from the given memory resource
+/// (host, pinned, managed or device) and filled by a single copy from a host
+/// staging area. Only the offsets of the containers are kept, from which the
+/// views are rebuilt for the address of the block. A copy of the block, e.g.
+/// in a different memory resource, can therefore be used in the same way.
+/// A detector can be constructed from the snapshot like from a
+/// @c detector_buffer .
+template <typename metadata, template <typename> class bfield_t,
+          typename container_t>
+struct detector_snapshot {
+
+    using detector_type = detector<metadata, bfield_t, container_t>;
+
+    /// Lay out the data of the detector @param det in a new block from
+    /// @param mr and copy it there using @param cpy
+    DETRAY_HOST
+    detector_snapshot(detector_type &det, vecmem::memory_resource &mr,
+                      vecmem::copy &cpy,
+                      detray::copy cpy_type = detray::copy::sync)
+        : _bfield_view(det.get_bfield()) {
+
+        const detector_view<metadata, bfield_t, container_t> det_view{det};
+
+        // Compute the total footprint and allocate the block in one go
+        _block = detail::snapshot_block{
+            detray::get_snapshot_size(det_view._detector_data), mr};
+        _staging.resize(_block.size());
+
+        // Pack the data on the host and compute the views into the block
+        std::size_t offset{0u};
+        detail::snapshot_pack(det_view._detector_data, _staging.data(),
+                              _layout, offset);
+        _detector_data = get_view(_block.data());
+
+        // Single transfer into the target memory
+        const auto n_bytes{
+            static_cast<vecmem::data::vector_view<std::byte>::size_type>(
+                _block.size())};
+        vecmem::data::vector_view<const std::byte> staging_view{
+            n_bytes, _staging.data()};
+        vecmem::data::vector_view<std::byte> block_view{n_bytes,
+                                                        _block.data()};
+        switch (cpy_type) {
+            case detray::copy::async:
+                // The staging area has to stay alive until the copy is done
+                cpy(staging_view, block_view);
+                break;
+            default:
+                cpy(staging_view, block_view)->wait();
+                _staging.clear();
+                _staging.shrink_to_fit();
+        };
+    }
+
+    /// @returns the size of the snapshot in bytes
+    DETRAY_HOST
+    std::size_t size() const { return _block.size(); }
+
+    /// @returns the start address of the snapshot block
+    DETRAY_HOST
+    const std::byte *data() const { return _block.data(); }
+
+    /// @returns the views into a block with the layout of this snapshot that
+    /// starts at @param block (e.g. a copy of the snapshot block)
+    DETRAY_HOST
+    typename detector_type::view_type get_view(std::byte *block) const {
+        return detray::get_snapshot_view<typename detector_type::view_type>(
+            _layout, block);
+    }
+
+    /// The memory block that holds the data of all containers
+    detail::snapshot_block _block{};
+    /// Host staging area for the copy
+    std::vector<std::byte> _staging{};
+    /// Offsets and sizes of the containers in the block
+    detail::snapshot_layout _layout{};
+    /// Views into the snapshot block
+    typename detector_type::view_type _detector_data;
+    /// Covfie field
+    typename detector_type::bfield_type::view_t _bfield_view;
+};
+
 /// @brief A static inplementation of detector data for device
 template <typename metadata, template <typename> class bfield_t,
           typename container_t>
@@ -736,13 +889,23 @@ struct detector_view {
                          detray::get_data(det.material_store()),
                          detray::get_data(det.surface_store()),
                          detray::get_data(det.surface_lookup()),
-                         detray::get_data(det.volume_search_grid())),
+                         detray::get_data(det.volume_search_grid()),
+                         detray::get_data(det.interaction_tables())),
           _bfield_view(det.get_bfield()) {}
 
     detector_view(detector_buffer<metadata, bfield_t, container_t> &det_buff)
         : _detector_data(detray::get_data(det_buff._detector_buffer)),
           _bfield_view(det_buff._bfield_view) {}
 
+    detector_view(detector_snapshot<metadata, bfield_t, container_t> &det_snap)
+        : _detector_data(det_snap._detector_data),
+          _bfield_view(det_snap._bfield_view) {}
+
+    detector_view(detector_snapshot<metadata, bfield_t, container_t> &det_snap,
+                  std::byte *block)
+        : _detector_data(det_snap.get_view(block)),
+          _bfield_view(det_snap._bfield_view) {}
+
     /// Views for the vecmem types
     typename detector_type::view_type _detector_data;
     /// Covfie field view
@@ -785,4 +948,39 @@ inline detector_view<metadata, bfield_t, container_t> get_data(
     return {det_buff};
 }
 
+/// Stand-alone function that @returns a flat snapshot of the detector data
+/// in a single memory block.
+///
+/// @param detector the detector to be tranferred
+template <typename metadata, template <typename> class bfield_t,
+          typename container_t>
+inline detector_snapshot<metadata, bfield_t, container_t> get_snapshot(
+    detector<metadata, bfield_t, container_t> &det, vecmem::memory_resource &mr,
+    vecmem::copy &cpy, detray::copy cpy_type = detray::copy::sync) {
+    return {det, mr, cpy, cpy_type};
+}
+
+/// Stand-alone function that @returns the detector data of a snapshot
+///
+/// @param det_snap the detector snapshot
+template <typename metadata, template <typename> class bfield_t,
+          typename container_t>
+inline detector_view<metadata, bfield_t, container_t> get_data(
+    detector_snapshot<metadata, bfield_t, container_t> &det_snap) {
+    return {det_snap};
+}
+
+/// Stand-alone function that @returns the detector data of a copy of a
+/// snapshot block
+///
+/// @param det_snap the detector snapshot that was copied
+/// @param block start address of the copied block
+template <typename metadata, template <typename> class bfield_t,
+          typename container_t>
+inline detector_view<metadata, bfield_t, container_t> get_data(
+    detector_snapshot<metadata, bfield_t, container_t> &det_snap,
+    std::byte *block) {
+    return {det_snap, block};
+}
+
 }  // namespace detray
@@ -0,0 +1,50 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s)
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Shared, read-only handle to a detector.
+///
+/// A reference counted handle that only gives const access to the detector.
+/// Many simulators or propagation jobs can hold the same handle, so that the
+/// geometry is kept in memory only once, independent of the number of jobs.
+template <typename detector_t>
+using detector_handle = std::shared_ptr<const detector_t>;
+
+/// Stand-alone function that @returns a shared handle that takes ownership
+/// of the detector @param det . The detector data is moved, never copied.
+template <typename detector_t,
+          std::enable_if_t<!std::is_lvalue_reference_v<detector_t>, bool> =
+              true>
+DETRAY_HOST inline detector_handle<detector_t> make_detector_handle(
+    detector_t &&det) {
+    return std::make_shared<const detector_t>(std::move(det));
+}
+
+/// Stand-alone function that @returns a non-owning shared handle to the
+/// detector @param det .
+///
+/// @note the detector has to outlive all copies of the handle. There is
+/// deliberately no overload of @c make_detector_handle for lvalues, so that
+/// this has to be requested explicitly.
+template <typename detector_t>
+DETRAY_HOST inline detector_handle<detector_t> make_non_owning_detector_handle(
+    const detector_t &det) {
+    return detector_handle<detector_t>(std::shared_ptr<void>{}, &det);
+}
+
+}  // namespace detray
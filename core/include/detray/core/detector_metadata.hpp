@@ -19,8 +19,10 @@
 #include "detray/masks/masks.hpp"
 #include "detray/masks/unbounded.hpp"
 #include "detray/masks/unmasked.hpp"
+#include "detray/materials/material_map.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
+#include "detray/materials/volume_material.hpp"
 #include "detray/surface_finders/accelerator_grid.hpp"
 #include "detray/surface_finders/brute_force_finder.hpp"
 
@@ -64,10 +66,26 @@ struct default_metadata {
     /// Material types
     using slab = material_slab<detray::scalar>;
     using rod = material_rod<detray::scalar>;
+    /// Homogeneous volume material
+    using raw_material = material<detray::scalar>;
 
-    /// @TODO material grids
+    /// Material grid types (default: closed binning)
     /// @{
-    /// ...
+    template <typename container_t>
+    using rectangle_map =
+        material_map<rectangle2D<>::axes<>, detray::scalar, container_t>;
+
+    template <typename container_t>
+    using cylinder2D_map =
+        material_map<cylinder2D<>::axes<>, detray::scalar, container_t>;
+
+    template <typename container_t>
+    using disc_map =
+        material_map<ring2D<>::axes<>, detray::scalar, container_t>;
+
+    template <typename container_t>
+    using cylinder3D_map =
+        volume_material_map<cylinder3D::axes<>, detray::scalar, container_t>;
     /// @}
 
     /// surface grid types (default boundaries: closed binning)
@@ -171,19 +189,29 @@ unbounded_cell, unmasked_plane*/>;
 
     /// Give your material types a name (needs to be consecutive and has to
     /// match the types position in the mask store!)
-    /// @TODO: Add the material grid types for every surface shape
     enum class material_ids {
         e_slab = 0,
         e_rod = 1,
-        // ... material map types
-        e_none = 2,
+        e_rectangle2_map = 2,
+        e_cylinder2_map = 3,
+        e_disc2_map = 4,
+        e_raw_material = 5,
+        e_cylinder3_map = 6,
+        e_none = 7,
     };
 
     /// How to store materials
     template <template <typename...> class tuple_t = dtuple,
-              template <typename...> class vector_t = dvector>
-    using material_store = regular_multi_store<material_ids, empty_context,
-                                               tuple_t, vector_t, slab, rod>;
+              typename container_t = host_container_types>
+    using material_store =
+        multi_store<material_ids, empty_context, tuple_t,
+                    typename container_t::template vector_type<slab>,
+                    typename container_t::template vector_type<rod>,
+                    grid_collection<rectangle_map<container_t>>,
+                    grid_collection<cylinder2D_map<container_t>>,
+                    grid_collection<disc_map<container_t>>,
+                    typename container_t::template vector_type<raw_material>,
+                    grid_collection<cylinder3D_map<container_t>>>;
 
     /// How to link to the entries in the data stores
     using transform_link = typename transform_store<>::link_type;
@@ -0,0 +1,62 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <type_traits>
+
+namespace detray::telemetry {
+
+/// Stages of the propagation loop that can be timed
+enum class stage : unsigned int {
+    e_stepper = 0u,
+    e_navigator = 1u,
+    e_actors = 2u,
+    e_none = 3u,
+};
+
+/// Number of timed stages (without @c e_none )
+inline constexpr unsigned int n_stages{3u};
+
+/// Counter that does nothing: Used where telemetry is switched off
+struct void_counter {
+    DETRAY_HOST_DEVICE
+    constexpr void_counter &operator++() { return *this; }
+};
+
+/// Switches the telemetry on for a component that is not a navigation
+/// inspector (e.g. the counters of the stepper)
+struct enabled {
+    static constexpr bool is_telemetry_inspector{true};
+};
+
+/// Telemetry is switched on for an inspector, if it declares itself as
+/// telemetry inspector. Otherwise, all hooks compile to nothing.
+/// @{
+template <typename inspector_t, typename = void>
+struct is_enabled : public std::false_type {};
+
+template <typename inspector_t>
+struct is_enabled<inspector_t,
+                  std::enable_if_t<inspector_t::is_telemetry_inspector, void>>
+    : public std::true_type {};
+
+template <typename inspector_t>
+inline constexpr bool is_enabled_v = is_enabled<inspector_t>::value;
+/// @}
+
+/// Type of the telemetry counters: A real counter only if telemetry is
+/// enabled for the inspector @tparam inspector_t
+template <typename inspector_t, typename value_t>
+using counter_t =
+    std::conditional_t<is_enabled_v<inspector_t>, value_t, void_counter>;
+
+}  // namespace detray::telemetry
@@ -27,7 +27,10 @@ namespace detray {
 ///         and device. The surface finders reside in an 'unrollable tuple
 ///         container' and are called per volume in the navigator during local
 ///         navigation.
-template <typename ID, typename link_t = dtyped_index<dindex, dindex>>
+/// @tparam material_link_t the type of link to the volume material in the
+///         detector material store (homogeneous or binned volume material).
+template <typename ID, typename link_t = dtyped_index<dindex, dindex>,
+          typename material_link_t = dtyped_index<dindex, dindex>>
 class volume_descriptor {
 
     public:
@@ -45,6 +48,11 @@ class volume_descriptor {
     /// portals (the accelerator structure's id and index).
     using link_type = dmulti_index<link_t, ID::e_size>;
 
+    /// Link to the volume material: id and index of the material in the
+    /// detector's material store. Invalid, if the volume is filled with
+    /// vacuum.
+    using material_link_type = material_link_t;
+
     /// Default constructor builds an ~infinitely long cylinder
     constexpr volume_descriptor() = default;
 
@@ -102,13 +110,41 @@ class volume_descriptor {
         detail::get<obj_id>(m_sf_finder_links) = link_t{id, index};
     }
 
+    /// @returns the link to the volume material - const access
+    DETRAY_HOST_DEVICE
+    constexpr auto material() const -> const material_link_t & {
+        return m_material_link;
+    }
+
+    /// @returns true if the volume is filled with material (not vacuum)
+    DETRAY_HOST_DEVICE
+    constexpr auto has_material() const -> bool {
+        return !m_material_link.is_invalid();
+    }
+
+    /// Set the volume material link from @param link
+    DETRAY_HOST
+    constexpr auto set_material(const material_link_t link) -> void {
+        m_material_link = link;
+    }
+
+    /// Set the volume material link from @param id and @param index of the
+    /// material in the detector material store
+    DETRAY_HOST
+    constexpr auto set_material(const typename material_link_t::id_type id,
+                                const typename material_link_t::index_type
+                                    index) -> void {
+        m_material_link = material_link_t{id, index};
+    }
+
     /// Equality operator
     ///
     /// @param rhs is the right-hand side to compare against.
     DETRAY_HOST_DEVICE
     constexpr auto operator==(const volume_descriptor &rhs) const -> bool {
         return (m_id == rhs.m_id && m_index == rhs.m_index &&
-                m_sf_finder_links == rhs.m_sf_finder_links);
+                m_sf_finder_links == rhs.m_sf_finder_links &&
+                m_material_link == rhs.m_material_link);
     }
 
     private:
@@ -123,6 +159,9 @@ class volume_descriptor {
 
     /// Links for every object type to an acceleration data structure
     link_type m_sf_finder_links = {};
+
+    /// Link to the volume material (invalid by default: vacuum)
+    material_link_t m_material_link = {};
 };
 
 }  // namespace detray
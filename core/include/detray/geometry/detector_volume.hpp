@@ -13,6 +13,8 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/geometry/detail/volume_kernels.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/volume_material.hpp"
 
 namespace detray {
 
@@ -72,9 +74,9 @@ class detector_volume {
 
     /// @returns the (non contextual) transform for the placement of the
     /// volume in the detector geometry.
+    /// @note returned by value if the transform store keeps compact placements
     DETRAY_HOST_DEVICE
-    constexpr auto transform() const -> const
-        typename detector_t::transform3 & {
+    constexpr decltype(auto) transform() const {
         return m_detector.transform_store({})[m_desc.transform()];
     }
 
@@ -84,6 +86,28 @@ class detector_volume {
         return transform().translation();
     }
 
+    /// @returns true if the volume is filled with material (not vacuum).
+    DETRAY_HOST_DEVICE
+    constexpr auto has_material() const -> bool {
+        return m_desc.has_material();
+    }
+
+    /// @returns the volume material at the global position @param glob_pos
+    /// and direction @param glob_dir, or @c nullptr in case of vacuum.
+    template <typename point3_t, typename vector3_t>
+    DETRAY_HOST_DEVICE constexpr auto material_at(const point3_t &glob_pos,
+                                                  const vector3_t &glob_dir)
+        const -> const material<typename detector_t::scalar_type> * {
+        using scalar_t = typename detector_t::scalar_type;
+
+        if (not m_desc.has_material()) {
+            return nullptr;
+        }
+        return m_detector.material_store()
+            .template visit<detail::get_volume_material<scalar_t>>(
+                m_desc.material(), transform(), glob_pos, glob_dir);
+    }
+
     /// Apply a functor to all surfaces in the volume.
     ///
     /// @tparam functor_t the prescription to be applied to the surfaces
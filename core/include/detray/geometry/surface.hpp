@@ -146,6 +146,10 @@ class surface {
     DETRAY_HOST
     auto update_mask(dindex offset) -> void { _mask += offset; }
 
+    /// Access to the mask
+    DETRAY_HOST_DEVICE
+    constexpr auto mask() -> mask_link & { return _mask; }
+
     /// @return the mask link
     DETRAY_HOST_DEVICE
     constexpr auto mask() const -> const mask_link & { return _mask; }
@@ -43,22 +43,25 @@ struct concentric_cylinder_intersector {
     ///
     /// @tparam mask_t is the input mask type
     /// @tparam surface_t is the type of surface handle
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sf the surface handle the mask is associated with
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mode lazy: skip the polar angle and the incidence angle
     ///
     /// @return the intersection
-    template <typename mask_t, typename surface_t,
+    template <typename mask_t, typename surface_t, typename placement_t,
               std::enable_if_t<std::is_same_v<typename mask_t::local_frame_type,
                                               cylindrical2<transform3_type>>,
                                bool> = true>
     DETRAY_HOST_DEVICE inline intersection_t operator()(
         const ray_type &ray, const surface_t &sf, const mask_t &mask,
-        const transform3_type & /*trf*/,
-        const scalar_type mask_tolerance = 0.f) const {
+        const placement_t & /*trf*/, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         intersection_t is;
 
@@ -77,8 +80,9 @@ struct concentric_cylinder_intersector {
         const scalar_type k{(l0[_y] - l1[_y]) / (l0[_x] - l1[_x])};
         const scalar_type d{l1[_y] - k * l1[_x]};
 
-        detail::quadratic_equation<scalar_type> qe{(1.f + k * k), 2.f * k * d,
-                                                   d * d - r * r};
+        detail::quadratic_equation<scalar_type> qe{
+            (1.f + k * k), 2.f * k * d,
+            d * d - mask.baked()[mask_t::shape::e_r2]};
 
         if (qe.solutions() > 0) {
             const scalar_type overstep_tolerance{ray.overstep_tolerance()};
@@ -106,8 +110,14 @@ struct concentric_cylinder_intersector {
             if (t01[0] > overstep_tolerance or t01[1] > overstep_tolerance) {
 
                 const point3 p3 = candidates[cindex];
-                const scalar_type phi{getter::phi(p3)};
-                is.local = {r * phi, p3[2], r};
+                // The polar angle is not needed for the mask check
+                const bool is_lazy{
+                    mode == intersection::mode::e_lazy and
+                    not detail::check_uses_phi_v<typename mask_t::shape>};
+                const scalar_type phi{is_lazy ? 0.f : getter::phi(p3)};
+                is.local = {is_lazy ? detail::invalid_value<scalar_type>()
+                                    : r * phi,
+                            p3[2], r};
 
                 is.path = t01[cindex];
                 // In this case, the point has to be in cylinder3 coordinates
@@ -124,8 +134,11 @@ struct concentric_cylinder_intersector {
                     is.volume_link = mask.volume_link();
 
                     // Get incidence angle
-                    const vector3 normal = {std::cos(phi), std::sin(phi), 0.f};
-                    is.cos_incidence_angle = vector::dot(rd, normal);
+                    if (not is_lazy) {
+                        const vector3 normal = {std::cos(phi), std::sin(phi),
+                                                0.f};
+                        is.cos_incidence_angle = vector::dot(rd, normal);
+                    }
                 }
             }
         }
@@ -136,21 +149,49 @@ struct concentric_cylinder_intersector {
     ///
     /// @tparam mask_t is the input mask type
     /// @tparam surface_t is the type of surface handle
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sfi the intersection to be updated
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
-    template <typename mask_t, typename surface_t,
+    /// @param mode lazy: skip the polar angle and the incidence angle
+    template <typename mask_t, typename placement_t,
               std::enable_if_t<std::is_same_v<typename mask_t::local_frame_type,
                                               cylindrical2<transform3_type>>,
                                bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_t &sfi, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
-        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance)[0];
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
+        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance,
+                               mode)[0];
+    }
+
+    /// Compute the full local position and the incidence angle of an
+    /// intersection that was found in the lazy mode.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be completed
+    /// @param mask is the input mask that defines the surface extent
+    template <typename mask_t, typename placement_t>
+    DETRAY_HOST_DEVICE inline void complete(
+        const ray_type &ray, intersection_t &sfi, const mask_t &mask,
+        const placement_t & /*trf*/) const {
+        const scalar_type r{mask[mask_t::shape::e_r]};
+        const point3 p3 = ray.pos() + sfi.path * ray.dir();
+        const scalar_type phi{getter::phi(p3)};
+
+        sfi.local = {r * phi, p3[2], r};
+
+        const vector3 normal = {std::cos(phi), std::sin(phi), 0.f};
+        sfi.cos_incidence_angle = vector::dot(ray.dir(), normal);
     }
 };
 
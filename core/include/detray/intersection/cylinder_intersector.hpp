@@ -41,19 +41,22 @@ struct cylinder_intersector {
     ///
     /// @tparam mask_t is the input mask type
     /// @tparam surface_t is the type of surface handle
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sf the surface handle the mask is associated with
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mode lazy: skip the polar angle and the incidence angle
     ///
     /// @return the intersections.
-    template <typename mask_t, typename surface_t>
+    template <typename mask_t, typename surface_t, typename placement_t>
     DETRAY_HOST_DEVICE inline std::array<intersection_t, 2> operator()(
         const ray_type &ray, const surface_t &sf, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         // One or both of these solutions might be invalid
         const auto qe = solve_intersection(ray, mask, trf);
@@ -62,7 +65,7 @@ struct cylinder_intersector {
         switch (qe.solutions()) {
             case 2:
                 ret[1] = build_candidate(ray, mask, trf, qe.larger(),
-                                         mask_tolerance);
+                                         mask_tolerance, mode);
                 ret[1].surface = sf;
                 // If there are two solutions, reuse the case for a single
                 // solution to setup the intersection with the smaller path
@@ -70,7 +73,7 @@ struct cylinder_intersector {
                 [[fallthrough]];
             case 1:
                 ret[0] = build_candidate(ray, mask, trf, qe.smaller(),
-                                         mask_tolerance);
+                                         mask_tolerance, mode);
                 ret[0].surface = sf;
                 break;
             case 0:
@@ -87,20 +90,23 @@ struct cylinder_intersector {
     /// Operator function to find intersections between a ray and a 2D cylinder
     ///
     /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sfi the intersection to be updated
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
-    template <typename mask_t,
+    /// @param mode lazy: skip the polar angle and the incidence angle
+    template <typename mask_t, typename placement_t,
               std::enable_if_t<std::is_same_v<typename mask_t::local_frame_type,
                                               cylindrical2<transform3_type>>,
                                bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_t &sfi, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         // One or both of these solutions might be invalid
         const auto qe = solve_intersection(ray, mask, trf);
@@ -108,26 +114,48 @@ struct cylinder_intersector {
         switch (qe.solutions()) {
             case 1:
                 sfi = build_candidate(ray, mask, trf, qe.smaller(),
-                                      mask_tolerance);
+                                      mask_tolerance, mode);
                 break;
             case 0:
                 sfi.status = intersection::status::e_missed;
         };
     }
 
+    /// Compute the full local position and the incidence angle of an
+    /// intersection that was found in the lazy mode.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be completed
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    template <typename mask_t, typename placement_t>
+    DETRAY_HOST_DEVICE inline void complete(const ray_type &ray,
+                                            intersection_t &sfi,
+                                            const mask_t &mask,
+                                            const placement_t &trf) const {
+        const point3 p3 = ray.pos() + sfi.path * ray.dir();
+
+        sfi.local = mask.to_local_frame(trf, p3);
+        sfi.cos_incidence_angle = incidence_angle(ray, sfi.local);
+    }
+
     protected:
     /// Calculates the distance to the (two) intersection points on the
     /// cylinder in global coordinates.
     ///
     /// @returns a quadratic equation object that contains the solution(s).
-    template <typename mask_t>
+    template <typename mask_t, typename placement_t>
     DETRAY_HOST_DEVICE inline detail::quadratic_equation<scalar_type>
     solve_intersection(const ray_type &ray, const mask_t &mask,
-                       const transform3_type &trf) const {
-        const scalar_type r{mask[mask_t::shape::e_r]};
-        const auto &m = trf.matrix();
-        const vector3 sz = getter::vector<3>(m, 0u, 2u);
-        const vector3 sc = getter::vector<3>(m, 0u, 3u);
+                       const placement_t &trf) const {
+        // Squared radius, precomputed by the mask
+        const scalar_type r2{mask.baked()[mask_t::shape::e_r2]};
+        const vector3 sz = trf.z();
+        const point3 sc = trf.translation();
 
         const point3 &ro = ray.pos();
         const vector3 &rd = ray.dir();
@@ -136,7 +164,7 @@ struct cylinder_intersector {
         const auto rd_cross_sz = vector::cross(rd, sz);
         const scalar_type a{vector::dot(rd_cross_sz, rd_cross_sz)};
         const scalar_type b{2.f * vector::dot(rd_cross_sz, pc_cross_sz)};
-        const scalar_type c{vector::dot(pc_cross_sz, pc_cross_sz) - (r * r)};
+        const scalar_type c{vector::dot(pc_cross_sz, pc_cross_sz) - r2};
 
         return detail::quadratic_equation<scalar_type>{a, b, c};
     }
@@ -147,10 +175,11 @@ struct cylinder_intersector {
     /// @returns the intersection candidate. Might be (partially) uninitialized
     /// if the overstepping tolerance is not met or the intersection lies
     /// outside of the mask.
-    template <typename mask_t>
+    template <typename mask_t, typename placement_t>
     DETRAY_HOST_DEVICE inline intersection_t build_candidate(
-        const ray_type &ray, const mask_t &mask, const transform3_type &trf,
-        const scalar_type path, const scalar_type mask_tolerance = 0.f) const {
+        const ray_type &ray, const mask_t &mask, const placement_t &trf,
+        const scalar_type path, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         intersection_t is;
 
@@ -163,7 +192,16 @@ struct cylinder_intersector {
             is.path = path;
             const point3 p3 = ro + is.path * rd;
 
-            is.local = mask.to_local_frame(trf, p3);
+            const bool is_lazy{mode == intersection::mode::e_lazy};
+            if (is_lazy and
+                not detail::check_uses_phi_v<typename mask_t::shape>) {
+                // Only z and r are needed for the mask check
+                const point3 loc3 = trf.point_to_local(p3);
+                is.local = {detail::invalid_value<scalar_type>(), loc3[2],
+                            getter::perp(loc3)};
+            } else {
+                is.local = mask.to_local_frame(trf, p3);
+            }
             is.status = mask.is_inside(is.local, mask_tolerance);
 
             // prepare some additional information in case the intersection
@@ -174,11 +212,10 @@ struct cylinder_intersector {
                                    : intersection::direction::e_along;
                 is.volume_link = mask.volume_link();
 
-                // Get incidence angle
-                const scalar_type phi{is.local[0] / is.local[2]};
-                const vector3 normal = {math_ns::cos(phi), math_ns::sin(phi),
-                                        0.f};
-                is.cos_incidence_angle = vector::dot(rd, normal);
+                // Get incidence angle (computed on demand in lazy mode)
+                if (not is_lazy) {
+                    is.cos_incidence_angle = incidence_angle(ray, is.local);
+                }
             }
         } else {
             is.status = intersection::status::e_missed;
@@ -186,6 +223,16 @@ struct cylinder_intersector {
 
         return is;
     }
+
+    /// @returns the cosine of the incidence angle at the local position
+    /// @param loc of an intersection
+    DETRAY_HOST_DEVICE inline scalar_type incidence_angle(
+        const ray_type &ray, const point3 &loc) const {
+        const scalar_type phi{loc[0] / loc[2]};
+        const vector3 normal = {math_ns::cos(phi), math_ns::sin(phi), 0.f};
+
+        return vector::dot(ray.dir(), normal);
+    }
 };
 
 }  // namespace detray
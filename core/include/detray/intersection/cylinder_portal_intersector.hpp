@@ -46,22 +46,25 @@ struct cylinder_portal_intersector
     ///
     /// @tparam mask_t is the input mask type
     /// @tparam surface_t is the type of surface handle
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sf the surface handle the mask is associated with
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mode lazy: skip the polar angle and the incidence angle
     ///
     /// @return the closest intersection
-    template <typename mask_t, typename surface_t,
+    template <typename mask_t, typename surface_t, typename placement_t,
               std::enable_if_t<std::is_same_v<typename mask_t::local_frame_type,
                                               cylindrical2<transform3_type>>,
                                bool> = true>
     DETRAY_HOST_DEVICE inline intersection_t operator()(
         const ray_type &ray, const surface_t &sf, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         intersection_t is;
 
@@ -77,7 +80,7 @@ struct cylinder_portal_intersector
                                     ? qe.smaller()
                                     : qe.larger()};
             is = this->template build_candidate(ray, mask, trf, t,
-                                                mask_tolerance);
+                                                mask_tolerance, mode);
             is.surface = sf;
         } else {
             is.status = intersection::status::e_missed;
@@ -89,21 +92,25 @@ struct cylinder_portal_intersector
     /// Operator function to find intersections between a ray and a 2D cylinder
     ///
     /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sfi the intersection to be updated
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
-    template <typename mask_t,
+    /// @param mode lazy: skip the polar angle and the incidence angle
+    template <typename mask_t, typename placement_t,
               std::enable_if_t<std::is_same_v<typename mask_t::local_frame_type,
                                               cylindrical2<transform3_type>>,
                                bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_t &sfi, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
-        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance);
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
+        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance,
+                               mode);
     }
 };
 
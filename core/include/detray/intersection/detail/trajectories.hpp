@@ -12,12 +12,14 @@
 #include "detray/definitions/units.hpp"
 #include "detray/tracks/detail/track_helper.hpp"
 #include "detray/tracks/tracks.hpp"
+#include "detray/utils/algebra_cast.hpp"
 #include "detray/utils/matrix_helper.hpp"
 
 // System include(s).
 #include <cmath>
 #include <limits>
 #include <ostream>
+#include <type_traits>
 
 namespace detray::detail {
 
@@ -60,6 +62,21 @@ class ray {
         _overstep_tolerance = track.overstep_tolerance();
     }
 
+    /// Construct from a track state of different precision, e.g. to intersect
+    /// a double precision track with a single precision geometry
+    ///
+    /// @param track the track state that should be approximated
+    template <typename other_transform3_t,
+              std::enable_if_t<
+                  not std::is_same_v<other_transform3_t, transform3_type>,
+                  bool> = true>
+    DETRAY_HOST_DEVICE explicit ray(
+        const free_track_parameters<other_transform3_t> &track)
+        : _pos{detail::cast_point3<transform3_type>(track.pos())},
+          _dir{detail::cast_vector3<transform3_type>(track.dir())},
+          _overstep_tolerance{
+              static_cast<scalar_type>(track.overstep_tolerance())} {}
+
     /// @returns position on the ray (compatible with tracks/intersectors)
     DETRAY_HOST_DEVICE point3 pos() const { return _pos; }
 
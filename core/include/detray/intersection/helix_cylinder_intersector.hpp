@@ -12,10 +12,10 @@
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/intersection/cylinder_intersector.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersector.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/masks/cylinder2D.hpp"
 #include "detray/utils/invalid_values.hpp"
-#include "tests/common/tools/intersectors/helix_intersector.hpp"
 
 // System include(s)
 #include <cmath>
@@ -10,8 +10,9 @@
 // Project include(s)
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersector.hpp"
 #include "detray/intersection/intersection.hpp"
-#include "tests/common/tools/intersectors/helix_intersector.hpp"
+#include "detray/intersection/line_intersector.hpp"
 
 // System include(s)
 #include <cmath>
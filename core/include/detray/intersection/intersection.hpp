@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <limits>
 #include <ostream>
+#include <type_traits>
 
 namespace detray {
 
@@ -38,8 +39,37 @@ enum class status : std::uint_least8_t {
     e_inside = 3u      //!< surface hit and inside confirmed
 };
 
+/// How much information the intersectors compute for a candidate
+enum class mode : std::uint_least8_t {
+    e_full = 0u,  //!< local position and incidence angle of every candidate
+    e_lazy = 1u   //!< only what the mask check needs: the candidate has to be
+                  //!< completed before its local position or incidence angle
+                  //!< can be used
+};
+
 }  // namespace intersection
 
+namespace detail {
+
+/// Whether the boundary check of a mask shape uses the polar angle of the
+/// local point. Shapes that only check radial and longitudinal bounds declare
+/// 'check_uses_phi = false', so that the intersectors can skip the atan2 in
+/// the lazy intersection mode.
+/// @{
+template <typename shape_t, typename = void>
+struct check_uses_phi : public std::true_type {};
+
+template <typename shape_t>
+struct check_uses_phi<shape_t,
+                      std::enable_if_t<not shape_t::check_uses_phi, void>>
+    : public std::false_type {};
+
+template <typename shape_t>
+inline constexpr bool check_uses_phi_v = check_uses_phi<shape_t>::value;
+/// @}
+
+}  // namespace detail
+
 /// @brief This class holds the intersection information.
 ///
 /// @tparam surface_descr_t is the type of surface descriptor
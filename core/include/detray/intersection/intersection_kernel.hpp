@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/core/detail/compact_transform_store.hpp"
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/utils/ranges.hpp"
@@ -32,6 +33,7 @@ struct intersection_initialize {
     /// @param surface is the input surface
     /// @param contextual_transforms is the input transform container
     /// @param mask_tolerance is the tolerance for mask size
+    /// @param mode how much of the intersection information to compute
     ///
     /// @return the number of valid intersections
     template <typename mask_group_t, typename mask_range_t,
@@ -42,11 +44,13 @@ struct intersection_initialize {
         is_container_t &is_container, const traj_t &traj,
         const surface_t &surface,
         const transform_container_t &contextual_transforms,
-        const scalar mask_tolerance = 0.f) const {
+        const scalar mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         using intersection_t = typename is_container_t::value_type;
 
-        const auto &ctf = contextual_transforms[surface.transform()];
+        const auto &ctf =
+            detail::placement(contextual_transforms, surface.transform());
 
         // Run over the masks that belong to the surface (only one can be hit)
         for (const auto &mask :
@@ -54,7 +58,7 @@ struct intersection_initialize {
 
             if (place_in_collection(
                     mask.template intersector<intersection_t>()(
-                        traj, surface, mask, ctf, mask_tolerance),
+                        traj, surface, mask, ctf, mask_tolerance, mode),
                     is_container)) {
                 return;
             };
@@ -108,6 +112,7 @@ struct intersection_update {
     /// @param surface is the input surface
     /// @param contextual_transforms is the input transform container
     /// @param mask_tolerance is the tolerance for mask size
+    /// @param mode how much of the intersection information to compute
     ///
     /// @return the intersection
     template <typename mask_group_t, typename mask_range_t, typename traj_t,
@@ -116,16 +121,18 @@ struct intersection_update {
         const mask_group_t &mask_group, const mask_range_t &mask_range,
         const traj_t &traj, intersection_t &sfi,
         const transform_container_t &contextual_transforms,
-        const scalar mask_tolerance = 0.f) const {
+        const scalar mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
-        const auto &ctf = contextual_transforms[sfi.surface.transform()];
+        const auto &ctf =
+            detail::placement(contextual_transforms, sfi.surface.transform());
 
         // Run over the masks that belong to the surface
         for (const auto &mask :
              detray::ranges::subrange(mask_group, mask_range)) {
 
             mask.template intersector<intersection_t>().update(
-                traj, sfi, mask, ctf, mask_tolerance);
+                traj, sfi, mask, ctf, mask_tolerance, mode);
 
             if (sfi.status == intersection::status::e_inside) {
                 return true;
@@ -136,4 +143,42 @@ struct intersection_update {
     }
 };
 
+/// A functor that computes the local position and incidence angle of an
+/// intersection that was found in the lazy intersection mode
+struct intersection_complete {
+
+    /// Operator function to complete the intersection
+    ///
+    /// @tparam mask_group_t is the input mask group type found by variadic
+    /// unrolling
+    /// @tparam traj_t is the input trajectory type (e.g. ray or helix)
+    /// @tparam transform_container_t is the input transform store type
+    ///
+    /// @param mask_group is the input mask group
+    /// @param mask_range is the range of masks in the group that belong to the
+    ///                   surface
+    /// @param traj is the input trajectory
+    /// @param sfi the intersection to be completed
+    /// @param contextual_transforms is the input transform container
+    template <typename mask_group_t, typename mask_range_t, typename traj_t,
+              typename intersection_t, typename transform_container_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        const traj_t &traj, intersection_t &sfi,
+        const transform_container_t &contextual_transforms) const {
+
+        const auto &ctf =
+            detail::placement(contextual_transforms, sfi.surface.transform());
+
+        // All masks of a surface share the local frame: use the first one
+        for (const auto &mask :
+             detray::ranges::subrange(mask_group, mask_range)) {
+
+            mask.template intersector<intersection_t>().complete(traj, sfi,
+                                                                 mask, ctf);
+            return;
+        }
+    }
+};
+
 }  // namespace detray
\ No newline at end of file
@@ -39,27 +39,31 @@ struct line_intersector {
     ///
     /// @tparam mask_t is the input mask type
     /// @tparam surface_t is the type of surface handle
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sf the surface handle the mask is associated with
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mode lazy: skip the sign and the polar angle if the mask does
+    ///             not need them
     //
     /// @return the intersection
-    template <typename mask_t, typename surface_t,
+    template <typename mask_t, typename surface_t, typename placement_t,
               std::enable_if_t<std::is_same_v<typename mask_t::local_frame_type,
                                               line2<transform3_type>>,
                                bool> = true>
     DETRAY_HOST_DEVICE inline intersection_t operator()(
         const ray_type &ray, const surface_t &sf, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         intersection_type is;
 
         // line direction
-        const vector3 _z = getter::vector<3>(trf.matrix(), 0u, 2u);
+        const vector3 _z = trf.z();
 
         // line center
         const point3 _t = trf.translation();
@@ -100,7 +104,15 @@ struct line_intersector {
             // point of closest approach on the track
             const point3 m = _p + _d * A;
 
-            is.local = mask.to_local_frame(trf, m, _d);
+            if (mode == intersection::mode::e_lazy and
+                not detail::check_uses_phi_v<typename mask_t::shape>) {
+                // The distance to the wire and z are enough for the mask check
+                const point3 loc3 = trf.point_to_local(m);
+                is.local = {getter::perp(loc3), loc3[2],
+                            detail::invalid_value<scalar_type>()};
+            } else {
+                is.local = mask.to_local_frame(trf, m, _d);
+            }
 
             is.status = mask.is_inside(is.local, mask_tolerance);
 
@@ -124,21 +136,49 @@ struct line_intersector {
     /// Operator function to find intersections between a ray and a line.
     ///
     /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sfi the intersection to be updated
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
-    template <typename mask_t,
+    /// @param mode lazy: skip the sign and the polar angle if the mask does
+    ///             not need them
+    template <typename mask_t, typename placement_t,
               std::enable_if_t<std::is_same_v<typename mask_t::local_frame_type,
                                               line2<transform3_type>>,
                                bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_t &sfi, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
-        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance);
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
+        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance,
+                               mode);
+    }
+
+    /// Compute the full local position and the incidence angle of an
+    /// intersection that was found in the lazy mode.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be completed
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    template <typename mask_t, typename placement_t>
+    DETRAY_HOST_DEVICE inline void complete(const ray_type &ray,
+                                            intersection_t &sfi,
+                                            const mask_t &mask,
+                                            const placement_t &trf) const {
+        const point3 m = ray.pos() + sfi.path * ray.dir();
+        const vector3 _z = trf.z();
+
+        sfi.local = mask.to_local_frame(trf, m, ray.dir());
+        sfi.cos_incidence_angle = std::abs(vector::dot(_z, ray.dir()));
     }
 };
 
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/coordinates/polar2.hpp"
 #include "detray/definitions/math.hpp"
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
@@ -38,26 +39,28 @@ struct plane_intersector {
     ///
     /// @tparam mask_t is the input mask type
     /// @tparam surface_t is the type of surface handle
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sf the surface handle the mask is associated with
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mode lazy: skip the polar angle if the mask does not need it
     ///
     /// @return the intersection
-    template <typename mask_t, typename surface_t>
+    template <typename mask_t, typename surface_t, typename placement_t>
     DETRAY_HOST_DEVICE inline intersection_t operator()(
         const ray_type &ray, const surface_t &sf, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
 
         intersection_t is;
 
         // Retrieve the surface normal & translation (context resolved)
-        const auto &sm = trf.matrix();
-        const vector3 sn = getter::vector<3>(sm, 0u, 2u);
-        const vector3 st = getter::vector<3>(sm, 0u, 3u);
+        const vector3 sn = trf.z();
+        const point3 st = trf.translation();
 
         // Intersection code
         const point3 &ro = ray.pos();
@@ -71,7 +74,22 @@ struct plane_intersector {
             if (is.path >= ray.overstep_tolerance()) {
 
                 const point3 p3 = ro + is.path * rd;
-                is.local = mask.to_local_frame(trf, p3, ray.dir());
+                if constexpr (std::is_same_v<typename mask_t::local_frame_type,
+                                             polar2<transform3_type>> and
+                              not detail::check_uses_phi_v<
+                                  typename mask_t::shape>) {
+                    // Polar frame: The radius is enough for the mask check
+                    if (mode == intersection::mode::e_lazy) {
+                        const point3 loc3 = trf.point_to_local(p3);
+                        is.local = {getter::perp(loc3),
+                                    detail::invalid_value<scalar_type>(),
+                                    loc3[2]};
+                    } else {
+                        is.local = mask.to_local_frame(trf, p3, ray.dir());
+                    }
+                } else {
+                    is.local = mask.to_local_frame(trf, p3, ray.dir());
+                }
                 is.status = mask.is_inside(is.local, mask_tolerance);
 
                 // prepare some additional information in case the intersection
@@ -99,18 +117,45 @@ struct plane_intersector {
     /// surface.
     ///
     /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
     ///
     /// @param ray is the input ray trajectory
     /// @param sfi the intersection to be updated
     /// @param mask is the input mask that defines the surface extent
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
-    template <typename mask_t>
+    /// @param mode lazy: skip the polar angle if the mask does not need it
+    template <typename mask_t, typename placement_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_t &sfi, const mask_t &mask,
-        const transform3_type &trf,
-        const scalar_type mask_tolerance = 0.f) const {
-        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance);
+        const placement_t &trf, const scalar_type mask_tolerance = 0.f,
+        const intersection::mode mode = intersection::mode::e_full) const {
+        sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance,
+                               mode);
+    }
+
+    /// Compute the full local position and the incidence angle of an
+    /// intersection that was found in the lazy mode.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam placement_t is the type of the surface placement (full or
+    ///         compact transform)
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be completed
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    template <typename mask_t, typename placement_t>
+    DETRAY_HOST_DEVICE inline void complete(const ray_type &ray,
+                                            intersection_t &sfi,
+                                            const mask_t &mask,
+                                            const placement_t &trf) const {
+        const point3 p3 = ray.pos() + sfi.path * ray.dir();
+        const vector3 sn = trf.z();
+
+        sfi.local = mask.to_local_frame(trf, p3, ray.dir());
+        sfi.cos_incidence_angle = std::abs(vector::dot(ray.dir(), sn));
     }
 };
 
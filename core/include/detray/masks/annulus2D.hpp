@@ -76,6 +76,14 @@ class annulus2D {
         e_size = 7u,
     };
 
+    /// Names for the values that are precomputed from the boundaries
+    enum baked : unsigned int {
+        e_shift_r2 = 0u,     // Squared origin shift in r (focal to beam)
+        e_two_shift_r = 1u,  // 2 * origin shift in r
+        e_shift_phi = 2u,    // Origin shift in phi
+        e_baked_size = 3u,
+    };
+
     /// Local coordinate frame ( focal system )
     template <typename algebra_t>
     using local_frame_type = polar2<algebra_t>;
@@ -133,6 +141,29 @@ class annulus2D {
         return 2.f * math_ns::atan(bounds[e_shift_y] / bounds[e_shift_x]);
     }
 
+    /// @brief Precompute the origin shift in polar coordinates.
+    ///
+    /// @param bounds the boundary values for this shape
+    ///
+    /// @returns the values that are needed by @c check_baked_boundaries
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM,
+              typename std::enable_if_t<kDIM == e_size, bool> = true>
+    DETRAY_HOST_DEVICE inline bounds_t<scalar_t, e_baked_size> bake(
+        const bounds_t<scalar_t, kDIM>& bounds) const {
+
+        const scalar_t shift_x{-bounds[e_shift_x]};
+        const scalar_t shift_y{-bounds[e_shift_y]};
+        const scalar_t shift_r2{shift_x * shift_x + shift_y * shift_y};
+
+        bounds_t<scalar_t, e_baked_size> baked{};
+        baked[e_shift_r2] = shift_r2;
+        baked[e_two_shift_r] = 2.f * math_ns::sqrt(shift_r2);
+        baked[e_shift_phi] = math_ns::atan2(shift_y, shift_x);
+
+        return baked;
+    }
+
     /// @brief Check boundary values for a local point.
     ///
     /// @note the point is expected to be given in local coordinates by the
@@ -150,6 +181,29 @@ class annulus2D {
     DETRAY_HOST_DEVICE inline bool check_boundaries(
         const bounds_t<scalar_t, kDIM>& bounds, const point_t& loc_p,
         const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
+        return check_baked_boundaries(bounds, bake(bounds), loc_p, tol);
+    }
+
+    /// @brief Check boundary values for a local point.
+    ///
+    /// Same as @c check_boundaries, but uses the origin shift that was
+    /// precomputed by @c bake .
+    ///
+    /// @param bounds the boundary values for this shape
+    /// @param baked the precomputed values for this shape
+    /// @param loc_p the point to be checked in the local coordinate system
+    /// @param tol dynamic tolerance determined by caller
+    ///
+    /// @return true if the local point lies within the given boundaries.
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM, std::size_t kBAKED,
+              typename point_t,
+              typename std::enable_if_t<kDIM == e_size, bool> = true,
+              typename std::enable_if_t<kBAKED == e_baked_size, bool> = true>
+    DETRAY_HOST_DEVICE inline bool check_baked_boundaries(
+        const bounds_t<scalar_t, kDIM>& bounds,
+        const bounds_t<scalar_t, kBAKED>& baked, const point_t& loc_p,
+        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
 
         // The two quantities to check: r^2 in beam system, phi in focal system:
 
@@ -164,14 +218,10 @@ class annulus2D {
 
         // Now go to beam frame to check r boundaries. Use the origin
         // shift in polar coordinates for that
-        // TODO: Put shift in r-phi into the bounds?
-        const point_t shift_xy = {-bounds[e_shift_x], -bounds[e_shift_y], 0.f};
-        const scalar_t shift_r{getter::perp(shift_xy)};
-        const scalar_t shift_phi{getter::phi(shift_xy)};
-
-        const scalar_t r_mod2{shift_r * shift_r + loc_p[0] * loc_p[0] +
-                              2.f * shift_r * loc_p[0] *
-                                  math_ns::cos(phi_strp - shift_phi)};
+        const scalar_t r_mod2{
+            baked[e_shift_r2] + loc_p[0] * loc_p[0] +
+            baked[e_two_shift_r] * loc_p[0] *
+                math_ns::cos(phi_strp - baked[e_shift_phi])};
 
         // Apply tolerances as squares: 0 <= a, 0 <= b: a^2 <= b^2 <=> a <= b
         const scalar_t minR_tol{bounds[e_min_r] - tol};
@@ -50,6 +50,9 @@ class cylinder2D {
     /// Normal ordering
     inline static constexpr const bool normal_order{kNormalOrder};
 
+    /// The boundary check does not need the local polar angle
+    inline static constexpr const bool check_uses_phi{false};
+
     // Measurement dimension check
     static_assert(meas_dim == 1u || meas_dim == 2u,
                   "Only 1D or 2D measurement is allowed");
@@ -61,6 +64,12 @@ class cylinder2D {
         e_size = 3u,
     };
 
+    /// Names for the values that are precomputed from the boundaries
+    enum baked : unsigned int {
+        e_r2 = 0u,  // Squared radius, used by the intersectors
+        e_baked_size = 1u,
+    };
+
     /// Local coordinate frame for boundary checks
     template <typename algebra_t>
     using local_frame_type = cylindrical2<algebra_t>;
@@ -90,6 +99,23 @@ class cylinder2D {
         using binning = dtuple<binning_loc0<C, S>, binning_loc1<C, S>>;
     };
 
+    /// @brief Precompute the squared radius for the intersectors.
+    ///
+    /// @param bounds the boundary values for this shape
+    ///
+    /// @returns the values that are needed by @c check_baked_boundaries
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM,
+              typename std::enable_if_t<kDIM == e_size, bool> = true>
+    DETRAY_HOST_DEVICE constexpr bounds_t<scalar_t, e_baked_size> bake(
+        const bounds_t<scalar_t, kDIM>& bounds) const {
+
+        bounds_t<scalar_t, e_baked_size> baked{};
+        baked[e_r2] = bounds[e_r] * bounds[e_r];
+
+        return baked;
+    }
+
     /// @brief Check boundary values for a local point.
     ///
     /// @note the point is expected to be given in local coordinates by the
@@ -121,6 +147,22 @@ class cylinder2D {
                 loc_p[1] <= bounds[e_p_half_z] + tol);
     }
 
+    /// @brief Check boundary values for a local point.
+    ///
+    /// The squared radius is not needed for the check, which works on the
+    /// local cylinder frame: Same as @c check_boundaries .
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM, std::size_t kBAKED,
+              typename point_t,
+              typename std::enable_if_t<kDIM == e_size, bool> = true,
+              typename std::enable_if_t<kBAKED == e_baked_size, bool> = true>
+    DETRAY_HOST_DEVICE inline bool check_baked_boundaries(
+        const bounds_t<scalar_t, kDIM>& bounds,
+        const bounds_t<scalar_t, kBAKED>& /*baked*/, const point_t& loc_p,
+        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
+        return check_boundaries(bounds, loc_p, tol);
+    }
+
     /// @brief Lower and upper point for minimal axis aligned bounding box.
     ///
     /// Computes the min and max vertices in a local cartesian frame.
@@ -53,6 +53,10 @@ class line {
     /// Normal ordering
     inline static constexpr const bool normal_order{kNormalOrder};
 
+    /// The boundary check does not need the local polar angle (unless the
+    /// cross section is square)
+    inline static constexpr const bool check_uses_phi{square_cross_sect};
+
     // Measurement dimension check
     static_assert(meas_dim == 1u || meas_dim == 2u,
                   "Only 1D or 2D measurement is allowed");
@@ -26,10 +26,29 @@
 #include <algorithm>
 #include <cassert>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
 
+namespace detail {
+
+/// @returns the number of values a mask shape precomputes from its boundaries
+/// (zero if the shape does not provide a @c bake method)
+/// @{
+template <typename shape_t, typename = void>
+struct n_baked_values : public std::integral_constant<std::size_t, 0u> {};
+
+template <typename shape_t>
+struct n_baked_values<shape_t, std::void_t<decltype(shape_t::e_baked_size)>>
+    : public std::integral_constant<std::size_t, shape_t::e_baked_size> {};
+
+template <typename shape_t>
+inline constexpr std::size_t n_baked_values_v = n_baked_values<shape_t>::value;
+/// @}
+
+}  // namespace detail
+
 /// @brief Mask a region on a surface and link it to a volume.
 ///
 /// The class uses a lightweight 'shape' that defines the local geometry of a
@@ -49,10 +68,13 @@ template <typename shape_t, typename links_t = std::uint_least16_t,
 class mask {
     public:
     using links_type = links_t;
+    using algebra_type = algebra_t;
     using scalar_type = typename algebra_t::scalar_type;
     using shape = shape_t;
     using boundaries = typename shape::boundaries;
     using mask_values = array_t<scalar_type, boundaries::e_size>;
+    using baked_values =
+        array_t<scalar_type, detail::n_baked_values_v<shape>>;
     using local_frame_type =
         typename shape::template local_frame_type<algebra_t>;
     // Linear algebra types
@@ -71,12 +93,16 @@ class mask {
     template <typename... Args>
     DETRAY_HOST_DEVICE explicit constexpr mask(const links_type& link,
                                                Args&&... args)
-        : _values({{std::forward<Args>(args)...}}), _volume_link(link) {}
+        : _values({{std::forward<Args>(args)...}}), _volume_link(link) {
+        bake();
+    }
 
     /// Constructor from mask boundary array
     DETRAY_HOST_DEVICE
     constexpr mask(const mask_values& values, const links_type& link)
-        : _values{values}, _volume_link{link} {}
+        : _values{values}, _volume_link{link} {
+        bake();
+    }
 
     /// Constructor from mask boundary vector
     DETRAY_HOST mask(const std::vector<scalar_type>& values,
@@ -85,6 +111,7 @@ class mask {
         assert(values.size() == boundaries::e_size &&
                " Given number of boundaries does not match mask shape.");
         std::copy(std::cbegin(values), std::cend(values), std::begin(_values));
+        bake();
     }
 
     /// Assignment operator from an array, convenience function
@@ -94,6 +121,7 @@ class mask {
     auto operator=(const mask_values& rhs)
         -> mask<shape_t, links_t, algebra_t, array_t>& {
         _values = rhs;
+        bake();
         return (*this);
     }
 
@@ -109,15 +137,10 @@ class mask {
         return (_values == rhs._values && _volume_link == rhs._volume_link);
     }
 
-    /// Access operator - non-const
+    /// Access operator
     ///
-    /// @returns the reference to the member variable
-    DETRAY_HOST_DEVICE
-    constexpr auto operator[](const std::size_t value_index) -> scalar_type& {
-        return _values[value_index];
-    }
-
-    /// Access operator - const
+    /// @note There is no non-const access, so that the precomputed values
+    /// cannot go stale: Assign the full boundary array instead.
     ///
     /// @returns a copy of the member variable
     DETRAY_HOST_DEVICE
@@ -171,11 +194,35 @@ class mask {
         const scalar_type t = std::numeric_limits<scalar_type>::epsilon()) const
         -> intersection::status {
 
-        return _shape.check_boundaries(_values, loc_p, t)
-                   ? intersection::status::e_inside
-                   : intersection::status::e_outside;
+        bool is_inside{false};
+        if constexpr (detail::n_baked_values_v<shape> > 0u) {
+            is_inside =
+                _shape.check_baked_boundaries(_values, _baked, loc_p, t);
+        } else {
+            is_inside = _shape.check_boundaries(_values, loc_p, t);
+        }
+
+        return is_inside ? intersection::status::e_inside
+                         : intersection::status::e_outside;
+    }
+
+    /// @brief Precompute the values that the shape derives from the mask
+    /// boundaries (e.g. the origin shift of the annulus in polar coordinates).
+    ///
+    /// This is done whenever the boundary values are set, so that the inside
+    /// check does not have to recompute them for every intersection. The
+    /// baked values are not part of the serialized mask.
+    DETRAY_HOST_DEVICE
+    constexpr void bake() {
+        if constexpr (detail::n_baked_values_v<shape> > 0u) {
+            _baked = _shape.bake(_values);
+        }
     }
 
+    /// @returns the precomputed values
+    DETRAY_HOST_DEVICE
+    auto baked() const -> const baked_values& { return _baked; }
+
     /// @returns return local frame object (used in geometrical checks)
     DETRAY_HOST_DEVICE inline constexpr local_frame_type local_frame() const {
         return local_frame_type{};
@@ -232,6 +279,7 @@ class mask {
 
     private:
     shape _shape;
+    baked_values _baked{};
     mask_values _values;
     links_type _volume_link{std::numeric_limits<links_type>::max()};
 };
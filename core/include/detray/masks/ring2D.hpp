@@ -44,6 +44,9 @@ class ring2D {
     /// Normal ordering
     inline static constexpr const bool normal_order{kNormalOrder};
 
+    /// The boundary check does not need the local polar angle
+    inline static constexpr const bool check_uses_phi{false};
+
     // Measurement dimension check
     static_assert(meas_dim == 1u || meas_dim == 2u,
                   "Only 1D or 2D measurement is allowed");
@@ -58,6 +58,13 @@ class trapezoid2D {
         e_size = 4u,
     };
 
+    /// Names for the values that are precomputed from the boundaries
+    enum baked : unsigned int {
+        e_mid_half_length = 0u,  // Half length in local0 at local1 = 0
+        e_slope = 1u,            // Change of the local0 half length in local1
+        e_baked_size = 2u,
+    };
+
     /// Local coordinate frame for boundary checks
     template <typename algebra_t>
     using local_frame_type = cartesian2<algebra_t>;
@@ -87,6 +94,29 @@ class trapezoid2D {
         using binning = dtuple<binning_loc0<C, S>, binning_loc1<C, S>>;
     };
 
+    /// @brief Precompute the slope of the trapezoid legs.
+    ///
+    /// @param bounds the boundary values for this shape
+    ///
+    /// @returns the values that are needed by @c check_baked_boundaries
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM,
+              typename std::enable_if_t<kDIM == e_size, bool> = true>
+    DETRAY_HOST_DEVICE constexpr bounds_t<scalar_t, e_baked_size> bake(
+        const bounds_t<scalar_t, kDIM>& bounds) const {
+
+        const scalar_t slope{
+            (bounds[e_half_length_1] - bounds[e_half_length_0]) *
+            bounds[e_divisor]};
+
+        bounds_t<scalar_t, e_baked_size> baked{};
+        baked[e_mid_half_length] =
+            bounds[e_half_length_0] + bounds[e_half_length_2] * slope;
+        baked[e_slope] = slope;
+
+        return baked;
+    }
+
     /// @brief Check boundary values for a local point.
     ///
     /// @note the point is expected to be given in local coordinates by the
@@ -104,12 +134,31 @@ class trapezoid2D {
     DETRAY_HOST_DEVICE inline bool check_boundaries(
         const bounds_t<scalar_t, kDIM>& bounds, const point_t& loc_p,
         const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
-        const scalar_t rel_y{(bounds[e_half_length_2] + loc_p[1]) *
-                             bounds[e_divisor]};
-        return (std::abs(loc_p[0]) <= bounds[e_half_length_0] +
-                                          rel_y * (bounds[e_half_length_1] -
-                                                   bounds[e_half_length_0]) +
-                                          tol and
+        return check_baked_boundaries(bounds, bake(bounds), loc_p, tol);
+    }
+
+    /// @brief Check boundary values for a local point.
+    ///
+    /// Same as @c check_boundaries, but uses the slope that was precomputed
+    /// by @c bake .
+    ///
+    /// @param bounds the boundary values for this shape
+    /// @param baked the precomputed values for this shape
+    /// @param loc_p the point to be checked in the local coordinate system
+    /// @param tol dynamic tolerance determined by caller
+    ///
+    /// @return true if the local point lies within the given boundaries.
+    template <template <typename, std::size_t> class bounds_t,
+              typename scalar_t, std::size_t kDIM, std::size_t kBAKED,
+              typename point_t,
+              typename std::enable_if_t<kDIM == e_size, bool> = true,
+              typename std::enable_if_t<kBAKED == e_baked_size, bool> = true>
+    DETRAY_HOST_DEVICE inline bool check_baked_boundaries(
+        const bounds_t<scalar_t, kDIM>& bounds,
+        const bounds_t<scalar_t, kBAKED>& baked, const point_t& loc_p,
+        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
+        return (std::abs(loc_p[0]) <= baked[e_mid_half_length] +
+                                          loc_p[1] * baked[e_slope] + tol and
                 std::abs(loc_p[1]) <= bounds[e_half_length_2] + tol);
     }
 
@@ -33,6 +33,9 @@ class unbounded {
     /// normal ordering
     inline static constexpr const bool normal_order = shape::normal_order;
 
+    /// The boundary check does not need any local coordinate
+    inline static constexpr const bool check_uses_phi = false;
+
     /// Local coordinate frame for boundary checks
     template <typename algebra_t>
     using local_frame_type =
@@ -14,6 +14,10 @@
 #include "detray/definitions/units.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/material.hpp"
+
+// System include(s)
+#include <limits>
 
 namespace detray {
 
@@ -27,7 +31,7 @@ struct interaction {
     template <typename material_t, typename surface_t, typename algebra_t>
     DETRAY_HOST_DEVICE scalar_type compute_energy_loss_bethe(
         const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
-        const int /*pdg*/, const scalar_type m, const scalar_type qOverP,
+        const int pdg, const scalar_type m, const scalar_type qOverP,
         const scalar_type q) const {
 
         // return early in case of vacuum or zero thickness
@@ -35,12 +39,27 @@ struct interaction {
             return 0.f;
         }
 
-        const scalar_t I{mat.get_material().mean_excitation_energy()};
-        const scalar_t Ne{mat.get_material().molar_electron_density()};
-        const scalar_t path_segment{mat.path_segment(is)};
+        return compute_energy_loss_bethe(mat.path_segment(is),
+                                         mat.get_material(), pdg, m, qOverP, q);
+    }
+
+    /// @returns the mean energy loss along the path segment @param path_segment
+    /// through the material @param mat (e.g. inside a volume).
+    DETRAY_HOST_DEVICE scalar_type compute_energy_loss_bethe(
+        const scalar_type path_segment, const material<scalar_type>& mat,
+        const int /*pdg*/, const scalar_type m, const scalar_type qOverP,
+        const scalar_type q) const {
+
+        // return early in case of vacuum or zero path length
+        if (is_vacuum(path_segment, mat)) {
+            return 0.f;
+        }
+
+        const scalar_t I{mat.mean_excitation_energy()};
+        const scalar_t Ne{mat.molar_electron_density()};
         const relativistic_quantities rq(m, qOverP, q);
         const scalar_t eps{rq.compute_epsilon(Ne, path_segment)};
-        const scalar_t dhalf{rq.compute_delta_half(mat.get_material())};
+        const scalar_t dhalf{rq.compute_delta_half(mat)};
         const scalar_t u{rq.compute_mass_term(constant<scalar_t>::m_e)};
         const scalar_t wmax{rq.compute_WMax(m)};
         // uses RPP2018 eq. 33.5 scaled from mass stopping power to linear
@@ -80,10 +99,20 @@ struct interaction {
     template <typename material_t, typename surface_t, typename algebra_t>
     DETRAY_HOST_DEVICE scalar_type compute_energy_loss_landau_fwhm(
         const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const int pdg, const scalar_type m, const scalar_type qOverP,
+        const scalar_type q) const {
+
+        return compute_energy_loss_landau_fwhm(
+            mat.path_segment(is), mat.get_material(), pdg, m, qOverP, q);
+    }
+
+    /// @returns the Landau fwhm along the path segment @param path_segment
+    /// through the material @param mat
+    DETRAY_HOST_DEVICE scalar_type compute_energy_loss_landau_fwhm(
+        const scalar_type path_segment, const material<scalar_type>& mat,
         const int /*pdg*/, const scalar_type m, const scalar_type qOverP,
         const scalar_type q) const {
-        const auto Ne = mat.get_material().molar_electron_density();
-        const auto path_segment = mat.path_segment(is);
+        const auto Ne = mat.molar_electron_density();
         const relativistic_quantities rq(m, qOverP, q);
 
         // the Landau-Vavilov fwhm is 4*eps (see RPP2018 fig. 33.7)
@@ -118,8 +147,25 @@ struct interaction {
             return 0.f;
         }
 
-        const scalar_t sigmaE{
-            compute_energy_loss_landau_sigma(is, mat, pdg, m, qOverP, q)};
+        return compute_energy_loss_landau_sigma_QOverP(
+            mat.path_segment(is), mat.get_material(), pdg, m, qOverP, q);
+    }
+
+    /// @returns the sigma of q/p for the energy loss along the path segment
+    /// @param path_segment through the material @param mat
+    DETRAY_HOST_DEVICE scalar_type compute_energy_loss_landau_sigma_QOverP(
+        const scalar_type path_segment, const material<scalar_type>& mat,
+        const int pdg, const scalar_type m, const scalar_type qOverP,
+        const scalar_type q) const {
+
+        // return early in case of vacuum or zero path length
+        if (is_vacuum(path_segment, mat)) {
+            return 0.f;
+        }
+
+        const scalar_t sigmaE{convert_landau_fwhm_to_gaussian_sigma(
+            compute_energy_loss_landau_fwhm(path_segment, mat, pdg, m, qOverP,
+                                            q))};
 
         //  var(q/p) = (d(q/p)/dE)² * var(E)
         // d(q/p)/dE = d/dE (q/sqrt(E²-m²))
@@ -147,7 +193,31 @@ struct interaction {
         }
 
         // relative radiation length
-        const scalar_type xOverX0{mat.path_segment_in_X0(is)};
+        return theta0(mat.path_segment_in_X0(is), pdg, m, qOverP, q);
+    }
+
+    /// @returns the multiple scattering angle theta0 along the path segment
+    /// @param path_segment through the material @param mat
+    DETRAY_HOST_DEVICE scalar_type compute_multiple_scattering_theta0(
+        const scalar_type path_segment, const material<scalar_type>& mat,
+        const int pdg, const scalar_type m, const scalar_type qOverP,
+        const scalar_type q) const {
+        // return early in case of vacuum or zero path length
+        if (is_vacuum(path_segment, mat)) {
+            return 0.f;
+        }
+
+        return theta0(path_segment / mat.X0(), pdg, m, qOverP, q);
+    }
+
+    private:
+    /// Multiple scattering theta0 for a path length @param xOverX0 in units
+    /// of the radiation length
+    DETRAY_HOST_DEVICE scalar_type theta0(const scalar_type xOverX0,
+                                          const int pdg, const scalar_type m,
+                                          const scalar_type qOverP,
+                                          const scalar_type q) const {
+
         // 1/p = q/(pq) = (q/p)/q
         const scalar_type momentumInv{std::abs(qOverP / q)};
         // q²/beta²; a smart compiler should be able to remove the unused
@@ -166,7 +236,13 @@ struct interaction {
         }
     }
 
-    private:
+    /// @returns true if there is no material along the path segment
+    DETRAY_HOST_DEVICE bool is_vacuum(const scalar_type path_segment,
+                                      const material<scalar_type>& mat) const {
+        return (path_segment <= std::numeric_limits<scalar_type>::epsilon() ||
+                mat.Z() == 0.f || mat.mass_density() == 0.f);
+    }
+
     /// Multiple scattering (mainly due to Coulomb interaction) for charged
     /// particles
     /// Original source: G. R. Lynch and O. I. Dahl, NIM.B58, 6
@@ -0,0 +1,490 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/intersection/intersection.hpp"
+#include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_map.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Precomputed interaction quantities for a single material.
+///
+/// The momentum dependent parts of the energy loss and scattering formulas in
+/// @c interaction are tabulated on an equidistant grid in log(p) for a fixed
+/// particle hypothesis. The thickness dependent parts are evaluated exactly,
+/// so that only one interpolation is needed per quantity. Outside of the
+/// tabulated momentum range, the analytic computation has to be used
+/// (see @c in_range).
+///
+/// @tparam scalar_t the scalar type
+/// @tparam N the number of log(p) nodes of the table
+template <typename scalar_t, std::size_t N = 128u>
+class interaction_table {
+
+    static_assert(N >= 2u, "Interaction table needs at least two nodes");
+
+    public:
+    using scalar_type = scalar_t;
+    using material_type = material<scalar_t>;
+    using relativistic_quantities =
+        detail::relativistic_quantities<scalar_type>;
+
+    /// Number of log(p) nodes
+    static constexpr std::size_t n_nodes{N};
+
+    /// Default momentum range of the table
+    static constexpr scalar_type default_p_min{50.f * unit<scalar_type>::MeV};
+    static constexpr scalar_type default_p_max{1.f * unit<scalar_type>::TeV};
+
+    /// Default constructor: Empty table, which is never in range
+    constexpr interaction_table() = default;
+
+    /// Build the table for the material @param mat and a particle hypothesis
+    /// given by @param pdg, @param mass and @param q in the momentum range
+    /// [@param p_min, @param p_max].
+    DETRAY_HOST
+    interaction_table(const material_type& mat, const int pdg,
+                      const scalar_type mass, const scalar_type q,
+                      const scalar_type p_min = default_p_min,
+                      const scalar_type p_max = default_p_max)
+        : m_mat{mat},
+          m_pdg{pdg},
+          m_mass{mass},
+          m_q{q},
+          m_log_p_min{math_ns::log(p_min)},
+          m_log_p_max{math_ns::log(p_max)} {
+
+        m_inv_bin_width = static_cast<scalar_type>(N - 1u) /
+                          (m_log_p_max - m_log_p_min);
+
+        const scalar_type I{m_mat.mean_excitation_energy()};
+        const scalar_type Ne{m_mat.molar_electron_density()};
+        const scalar_type log_I{math_ns::log(I)};
+
+        for (std::size_t i = 0u; i < N; ++i) {
+            const scalar_type log_p{m_log_p_min +
+                                    static_cast<scalar_type>(i) /
+                                        m_inv_bin_width};
+            const scalar_type qop{m_q / math_ns::exp(log_p)};
+
+            const relativistic_quantities rq(m_mass, qop, m_q);
+            // Epsilon per unit length
+            const scalar_type eps{rq.compute_epsilon(Ne, 1.f)};
+            const scalar_type dhalf{rq.compute_delta_half(m_mat)};
+            const scalar_type u{
+                rq.compute_mass_term(constant<scalar_type>::m_e)};
+            const scalar_type wmax{rq.compute_WMax(m_mass)};
+
+            // RPP2018 eq. 33.5 per unit length
+            m_bethe[i] = eps * (math_ns::log(u / I) + math_ns::log(wmax / I) -
+                                2.f * rq.m_beta2 - 2.f * dhalf);
+            m_eps[i] = eps;
+            // RPP2018 eq. 33.11 without the thickness dependent log(eps)
+            m_landau[i] =
+                math_ns::log(u / I) - log_I + 0.2f - rq.m_beta2 - 2.f * dhalf;
+            m_q_over_beta[i] = std::sqrt(rq.m_q2OverBeta2);
+        }
+    }
+
+    /// @returns the material the table was built for
+    DETRAY_HOST_DEVICE
+    constexpr const material_type& get_material() const { return m_mat; }
+
+    /// @returns true if the table was built for the given particle hypothesis
+    /// (the tabulated quantities only depend on the magnitude of the charge)
+    DETRAY_HOST_DEVICE
+    inline bool matches(const int pdg, const scalar_type mass,
+                        const scalar_type q) const {
+        return (pdg == m_pdg) and (mass == m_mass) and
+               (std::abs(q) == std::abs(m_q));
+    }
+
+    /// @brief Position of a momentum in the table.
+    ///
+    /// Is computed once per material interaction and then used for the
+    /// interpolation of all quantities.
+    struct node {
+        /// Lower node of the interpolation
+        std::size_t index{0u};
+        /// Interpolation weight of the upper node
+        scalar_type weight{0.f};
+        /// Inverse momentum
+        scalar_type p_inv{0.f};
+        /// Whether the momentum is covered by the table
+        bool in_range{false};
+    };
+
+    /// @returns the position of the momentum of @param qOverP in the table
+    DETRAY_HOST_DEVICE
+    inline node locate(const scalar_type qOverP) const {
+        const scalar_type p_inv{std::abs(qOverP / m_q)};
+        const scalar_type log_p{-math_ns::log(p_inv)};
+        const scalar_type x{(log_p - m_log_p_min) * m_inv_bin_width};
+
+        const scalar_type x_max{static_cast<scalar_type>(N - 1u)};
+        const scalar_type x_clamped{x < 0.f ? 0.f : (x > x_max ? x_max : x)};
+
+        std::size_t i{static_cast<std::size_t>(x_clamped)};
+        i = i < N - 1u ? i : N - 2u;
+
+        return {i, x_clamped - static_cast<scalar_type>(i), p_inv,
+                (log_p >= m_log_p_min) and (log_p <= m_log_p_max)};
+    }
+
+    /// @returns true if the momentum of @param qOverP is covered by the table
+    DETRAY_HOST_DEVICE
+    inline bool in_range(const scalar_type qOverP) const {
+        return locate(qOverP).in_range;
+    }
+
+    /// @returns the mean energy loss (Bethe formula)
+    /// @{
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_energy_loss_bethe(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const node& n) const {
+        return mat.path_segment(is) * interpolate(m_bethe, n);
+    }
+
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_energy_loss_bethe(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const scalar_type qOverP) const {
+        return compute_energy_loss_bethe(is, mat, locate(qOverP));
+    }
+    /// @}
+
+    /// @returns the most probable energy loss (Landau-Vavilov)
+    /// @{
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_energy_loss_landau(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const node& n) const {
+        const scalar_type eps{mat.path_segment(is) * interpolate(m_eps, n)};
+        return eps * (interpolate(m_landau, n) + math_ns::log(eps));
+    }
+
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_energy_loss_landau(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const scalar_type qOverP) const {
+        return compute_energy_loss_landau(is, mat, locate(qOverP));
+    }
+    /// @}
+
+    /// @returns the gaussian sigma of the Landau energy loss distribution
+    /// @{
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_energy_loss_landau_sigma(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const node& n) const {
+        // the Landau-Vavilov fwhm is 4*eps (see RPP2018 fig. 33.7)
+        const scalar_type fwhm{4.f * mat.path_segment(is) *
+                               interpolate(m_eps, n)};
+        return 0.5f * constant<scalar_type>::inv_sqrt2 * fwhm /
+               std::sqrt(constant<scalar_type>::ln2);
+    }
+
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_energy_loss_landau_sigma(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const scalar_type qOverP) const {
+        return compute_energy_loss_landau_sigma(is, mat, locate(qOverP));
+    }
+    /// @}
+
+    /// @returns the sigma of q/p due to the Landau energy loss
+    /// @{
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type
+    compute_energy_loss_landau_sigma_QOverP(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const node& n) const {
+        const scalar_type sigmaE{compute_energy_loss_landau_sigma(is, mat, n)};
+
+        return interpolate(m_q_over_beta, n) * n.p_inv * n.p_inv * sigmaE;
+    }
+
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type
+    compute_energy_loss_landau_sigma_QOverP(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const scalar_type qOverP) const {
+        return compute_energy_loss_landau_sigma_QOverP(is, mat,
+                                                       locate(qOverP));
+    }
+    /// @}
+
+    /// @returns the projected multiple scattering angle
+    /// @{
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_multiple_scattering_theta0(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const node& n) const {
+
+        const scalar_type xOverX0{mat.path_segment_in_X0(is)};
+        const scalar_type t{std::sqrt(xOverX0) *
+                            interpolate(m_q_over_beta, n)};
+
+        if ((m_pdg == pdg_particle::eElectron) or
+            (m_pdg == pdg_particle::ePositron)) {
+            return 17.5f * unit<scalar_type>::MeV * n.p_inv * t *
+                   (1.0f + 0.125f * math_ns::log10(10.0f * xOverX0));
+        } else {
+            return 13.6f * unit<scalar_type>::MeV * n.p_inv * t *
+                   (1.0f + 0.038f * 2.f * math_ns::log(t));
+        }
+    }
+
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE inline scalar_type compute_multiple_scattering_theta0(
+        const intersection2D<surface_t, algebra_t>& is, const material_t& mat,
+        const scalar_type qOverP) const {
+        return compute_multiple_scattering_theta0(is, mat, locate(qOverP));
+    }
+    /// @}
+
+    private:
+    /// Linear interpolation of the table @param column at the node @param n
+    DETRAY_HOST_DEVICE
+    inline scalar_type interpolate(const darray<scalar_type, N>& column,
+                                   const node& n) const {
+        return (1.f - n.weight) * column[n.index] +
+               n.weight * column[n.index + 1u];
+    }
+
+    /// Material and particle hypothesis
+    material_type m_mat{};
+    int m_pdg{0};
+    scalar_type m_mass{0.f};
+    scalar_type m_q{0.f};
+
+    /// Binning in log(p)
+    scalar_type m_log_p_min{0.f};
+    scalar_type m_log_p_max{-1.f};
+    scalar_type m_inv_bin_width{0.f};
+
+    /// Mean energy loss per unit length
+    darray<scalar_type, N> m_bethe{};
+    /// Landau epsilon per unit length
+    darray<scalar_type, N> m_eps{};
+    /// Landau most probable value, without the thickness dependent term
+    darray<scalar_type, N> m_landau{};
+    /// |q|/beta
+    darray<scalar_type, N> m_q_over_beta{};
+};
+
+/// @brief Interaction tables of all distinct materials in a detector material
+/// store for one particle hypothesis.
+///
+/// The tables are keyed by the position of the material in the store: Every
+/// homogeneous material and every bin of the material maps is assigned the
+/// index of the table for its material. The keys of all material collections
+/// are kept in one flat collection, in which every material collection starts
+/// at its own offset. Finding the table for a material during the propagation
+/// is therefore a direct index access.
+///
+/// @tparam table_t the interaction table type
+/// @tparam container_t the container types (host or device)
+template <typename table_t, typename container_t = host_container_types>
+class interaction_table_store {
+
+    public:
+    using table_type = table_t;
+    using scalar_type = typename table_t::scalar_type;
+    using size_type = dindex;
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+
+    /// Vecmem based view type
+    using view_type =
+        dmulti_view<dvector_view<table_t>, dvector_view<size_type>,
+                    dvector_view<size_type>>;
+
+    /// Vecmem based const view type
+    using const_view_type =
+        dmulti_view<dvector_view<const table_t>, dvector_view<const size_type>,
+                    dvector_view<const size_type>>;
+
+    /// Vecmem based buffer type
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<table_t>, dvector_buffer<size_type>,
+                      dvector_buffer<size_type>>;
+
+    /// Default constructor: No tables
+    interaction_table_store() = default;
+
+    /// Empty store from a specific vecmem memory resource
+    DETRAY_HOST
+    explicit interaction_table_store(vecmem::memory_resource &resource)
+        : m_tables(&resource), m_offsets(&resource), m_keys(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename store_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<store_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE interaction_table_store(store_view_t &view)
+        : m_tables(detail::get<0>(view.m_view)),
+          m_offsets(detail::get<1>(view.m_view)),
+          m_keys(detail::get<2>(view.m_view)) {}
+
+    /// @returns the number of tables
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const -> dindex {
+        return static_cast<dindex>(m_tables.size());
+    }
+
+    /// @returns true if no tables were built
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const -> bool { return m_tables.empty(); }
+
+    /// @returns the tables of the distinct materials - const
+    DETRAY_HOST_DEVICE
+    constexpr auto tables() const -> const vector_type<table_t> & {
+        return m_tables;
+    }
+
+    /// Find the table for a material in the material store.
+    ///
+    /// @param coll_idx position of the material collection in the store
+    /// @param pos position of the material in the collection (index of the
+    ///            homogeneous material or bin in the material map storage)
+    /// @param pdg the pdg number of the particle hypothesis
+    /// @param mass the mass of the particle hypothesis
+    /// @param q the charge of the particle hypothesis
+    ///
+    /// @returns nullptr if there is no table for the material (e.g. vacuum)
+    /// or it was built for a different particle hypothesis
+    DETRAY_HOST_DEVICE
+    inline const table_t *find(const std::size_t coll_idx, const dindex pos,
+                               const int pdg, const scalar_type mass,
+                               const scalar_type q) const {
+        if (coll_idx + 1u >= m_offsets.size() or
+            pos >= m_offsets[coll_idx + 1u] - m_offsets[coll_idx]) {
+            return nullptr;
+        }
+        const dindex table_idx{m_keys[m_offsets[coll_idx] + pos]};
+        if (table_idx == dindex_invalid or
+            not m_tables[table_idx].matches(pdg, mass, q)) {
+            return nullptr;
+        }
+        return &m_tables[table_idx];
+    }
+
+    /// Tabulate the interactions for all distinct materials in the material
+    /// store @param mat_store and replace the previous tables.
+    ///
+    /// @param pdg the pdg number of the particle hypothesis
+    /// @param mass the mass of the particle hypothesis
+    /// @param q the charge of the particle hypothesis
+    template <typename material_store_t>
+    DETRAY_HOST void build(const material_store_t &mat_store, const int pdg,
+                           const scalar_type mass, const scalar_type q) {
+        m_tables.clear();
+        m_offsets.clear();
+        m_keys.clear();
+
+        m_offsets.push_back(0u);
+        fill(mat_store, pdg, mass, q);
+    }
+
+    /// @returns a view of the tables and keys
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(m_tables),
+                         detray::get_data(m_offsets),
+                         detray::get_data(m_keys)};
+    }
+
+    /// @returns a const view of the tables and keys
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_tables),
+                               detray::get_data(m_offsets),
+                               detray::get_data(m_keys)};
+    }
+
+    private:
+    /// Add the keys for the material collection with position @tparam I in
+    /// the material store @param mat_store
+    template <std::size_t I = 0u, typename material_store_t>
+    DETRAY_HOST void fill(const material_store_t &mat_store, const int pdg,
+                          const scalar_type mass, const scalar_type q) {
+
+        constexpr auto id{material_store_t::value_types::to_id(I)};
+        using mat_t = typename material_store_t::template get_type<id>;
+
+        if constexpr (std::is_base_of_v<homogeneous_material_tag, mat_t>) {
+            for (const auto &mat : mat_store.template get<id>()) {
+                m_keys.push_back(add(mat, pdg, mass, q));
+            }
+        } else if constexpr (detail::is_material_map_v<mat_t>) {
+            // All bins of all material maps in the collection
+            for (const auto &bin :
+                 mat_store.template get<id>().bin_storage()) {
+                m_keys.push_back(add(bin.content(), pdg, mass, q));
+            }
+        }
+        m_offsets.push_back(static_cast<dindex>(m_keys.size()));
+
+        if constexpr (I < material_store_t::n_collections() - 1u) {
+            fill<I + 1u>(mat_store, pdg, mass, q);
+        }
+    }
+
+    /// @returns the index of the table for the material of @param mat, which
+    /// is added if not yet contained, or @c dindex_invalid for vacuum
+    template <typename material_t>
+    DETRAY_HOST dindex add(const material_t &mat, const int pdg,
+                           const scalar_type mass, const scalar_type q) {
+        // Vacuum or zero thickness
+        if (not mat) {
+            return dindex_invalid;
+        }
+        // The number of distinct materials is usually small
+        const auto it = std::find_if(
+            m_tables.begin(), m_tables.end(), [&mat](const table_t &t) {
+                return t.get_material() == mat.get_material();
+            });
+        if (it != m_tables.end()) {
+            return static_cast<dindex>(std::distance(m_tables.begin(), it));
+        }
+        m_tables.emplace_back(mat.get_material(), pdg, mass, q);
+
+        return static_cast<dindex>(m_tables.size() - 1u);
+    }
+
+    /// Tables of the distinct materials
+    vector_type<table_t> m_tables;
+    /// Offset of every material collection in the keys
+    vector_type<size_type> m_offsets;
+    /// Table index for every material in the store
+    vector_type<size_type> m_keys;
+};
+
+}  // namespace detray
@@ -0,0 +1,119 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/materials/volume_material.hpp"
+#include "detray/surface_finders/grid/grid.hpp"
+#include "detray/surface_finders/grid/grid_collection.hpp"
+#include "detray/surface_finders/grid/populator.hpp"
+#include "detray/surface_finders/grid/serializer.hpp"
+#include "detray/tools/grid_factory.hpp"
+#include "detray/utils/ranges.hpp"
+
+// System include(s)
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Surface material map.
+///
+/// Bins material slabs in the local coordinates of a surface, e.g. in
+/// (r * phi, z) for a cylinder or (r, phi) for a disc. Uses the surface grid
+/// machinery, so that the maps can be stored in a @c grid_collection inside
+/// the detector material store and be moved to device.
+///
+/// @tparam grid_shape_t the shape of the grid, e.g. @c cylinder2D<>::axes<>
+/// @tparam scalar_t the scalar type of the material slabs
+/// @tparam container_t the container types
+/// @tparam owning whether the map owns its data (a single grid) or is part of
+///                a grid collection
+template <typename grid_shape_t, typename scalar_t = detray::scalar,
+          typename container_t = host_container_types, bool owning = false>
+using material_map =
+    grid<coordinate_axes<grid_shape_t, owning, container_t>,
+         material_slab<scalar_t>, simple_serializer, replacer>;
+
+/// Builds owning material maps from the surface masks (see @c grid_factory)
+template <typename scalar_t = detray::scalar>
+using material_map_factory =
+    grid_factory<material_slab<scalar_t>, simple_serializer, replacer>;
+
+namespace detail {
+
+/// Check whether a type is a material map
+/// @{
+template <typename T, typename = void>
+struct is_material_map : public std::false_type {};
+
+template <typename axes_t, typename scalar_t,
+          template <std::size_t> class serializer_t>
+struct is_material_map<
+    grid<axes_t, material_slab<scalar_t>, serializer_t, replacer>, void>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_material_map_v = is_material_map<T>::value;
+/// @}
+
+/// @returns an iterable range over the material of a surface at the local
+/// position of the intersection @param is. The range is empty for volume
+/// material, which is not placed on surfaces.
+///
+/// @param material_coll the collection that contains the surface material
+/// @param idx the index of the surface material in the collection
+template <typename material_coll_t, typename index_t, typename intersection_t>
+DETRAY_HOST_DEVICE inline auto get_material(
+    const material_coll_t &material_coll, const index_t &idx,
+    const intersection_t &is) {
+
+    using material_t = typename material_coll_t::value_type;
+    using scalar_t = typename intersection_t::scalar_type;
+
+    if constexpr (is_material_map_v<material_t>) {
+        // The bin content lives in the collection: safe to return the view
+        return material_coll[idx].search(is.local);
+    } else if constexpr (is_volume_material_v<material_t>) {
+        return detray::ranges::views::empty<const material_slab<scalar_t>>{};
+    } else {
+        return detray::ranges::subrange(material_coll, idx);
+    }
+}
+
+/// @returns the position of the surface material at the local position of the
+/// intersection @param is in its collection: the index of homogeneous
+/// material or the position of the material map bin in the bin storage that
+/// is shared by all maps of the collection.
+///
+/// @param material_coll the collection that contains the surface material
+/// @param idx the index of the surface material in the collection
+template <typename material_coll_t, typename index_t, typename intersection_t>
+DETRAY_HOST_DEVICE inline dindex get_material_position(
+    const material_coll_t &material_coll, const index_t &idx,
+    const intersection_t &is) {
+
+    using material_t = typename material_coll_t::value_type;
+
+    if constexpr (is_material_map_v<material_t>) {
+        const auto map = material_coll[idx];
+        return map.data().offset() +
+               map.serializer()(map.axes(), map.axes().bins(is.local));
+    } else if constexpr (is_volume_material_v<material_t>) {
+        return dindex_invalid;
+    } else {
+        return static_cast<dindex>(idx);
+    }
+}
+
+}  // namespace detail
+
+}  // namespace detray
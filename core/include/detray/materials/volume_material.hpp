@@ -0,0 +1,106 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/surface_finders/grid/grid.hpp"
+#include "detray/surface_finders/grid/grid_collection.hpp"
+#include "detray/surface_finders/grid/populator.hpp"
+#include "detray/surface_finders/grid/serializer.hpp"
+
+// System include(s)
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Volume material map.
+///
+/// Bins the raw material (without thickness) in the local 3D frame of a
+/// volume, e.g. in (r, phi, z) for a cylindrical volume. As for the surface
+/// material maps, the grids are stored in a @c grid_collection inside the
+/// detector material store.
+///
+/// @tparam grid_shape_t the shape of the grid, e.g. @c cylinder3D::axes<>
+/// @tparam scalar_t the scalar type of the material
+/// @tparam container_t the container types
+/// @tparam owning whether the map owns its data (a single grid) or is part of
+///                a grid collection
+template <typename grid_shape_t, typename scalar_t = detray::scalar,
+          typename container_t = host_container_types, bool owning = false>
+using volume_material_map =
+    grid<coordinate_axes<grid_shape_t, owning, container_t>,
+         material<scalar_t>, simple_serializer, replacer>;
+
+namespace detail {
+
+/// Check whether a type describes the material of a volume, i.e. either a
+/// homogeneous material that fills the entire volume or a volume material map
+/// @{
+template <typename T, typename = void>
+struct is_volume_material : public std::false_type {};
+
+template <typename scalar_t, typename R>
+struct is_volume_material<material<scalar_t, R>, void>
+    : public std::true_type {};
+
+template <typename axes_t, typename scalar_t,
+          template <std::size_t> class serializer_t>
+struct is_volume_material<
+    grid<axes_t, material<scalar_t>, serializer_t, replacer>, void>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_volume_material_v = is_volume_material<T>::value;
+
+/// Surface material types are everything else in the material store
+template <typename T>
+inline constexpr bool is_surface_material_v = !is_volume_material_v<T>;
+/// @}
+
+/// @brief Material store visitor that finds the volume material at a given
+/// global position and direction.
+///
+/// @returns a pointer to the material at the position, or @c nullptr if the
+/// material link points to surface material.
+template <typename scalar_t>
+struct get_volume_material {
+
+    template <typename material_coll_t, typename index_t,
+              typename transform3_t, typename point3_t, typename vector3_t>
+    DETRAY_HOST_DEVICE inline const material<scalar_t> *operator()(
+        const material_coll_t &material_coll, const index_t &idx,
+        const transform3_t &trf, const point3_t &glob_pos,
+        const vector3_t &glob_dir) const {
+
+        using material_t = typename material_coll_t::value_type;
+
+        if constexpr (std::is_same_v<material_t, material<scalar_t>>) {
+            // Homogeneous material: The same for every position
+            return &(material_coll[idx]);
+
+        } else if constexpr (is_volume_material_v<material_t>) {
+            const auto mat_map = material_coll[idx];
+            const auto loc_pos =
+                mat_map.global_to_local(trf, glob_pos, glob_dir);
+
+            // The bin content lives in the collection
+            for (const auto &mat : mat_map.search(loc_pos)) {
+                return &mat;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+}  // namespace detail
+
+}  // namespace detray
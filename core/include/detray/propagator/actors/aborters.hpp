@@ -8,11 +8,16 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
 #include "detray/definitions/qualifiers.hpp"
+#include "detray/geometry/barcode.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/base_stepper.hpp"
 
 // System include(s)
+#include <cmath>
+#include <cstddef>
 #include <limits>
 
 namespace detray {
@@ -50,7 +55,8 @@ struct pathlimit_aborter : actor {
         }
 
         // Check the path limit
-        abrt_state._path_limit -= std::abs(prop_state._stepping.step_size());
+        abrt_state._path_limit -=
+            static_cast<scalar>(std::abs(prop_state._stepping.step_size()));
         if (abrt_state.path_limit() <= 0) {
             // Stop navigation
             prop_state._heartbeat &= nav_state.abort();
@@ -116,4 +122,275 @@ struct next_surface_aborter : actor {
     }
 };
 
+/// Aborter that stops tracks below a minimal transverse momentum (low-pT
+/// loopers)
+struct min_pT_aborter : actor {
+
+    struct state {
+        /// Minimal transverse momentum
+        scalar _min_pT{0.f};
+
+        /// Statistics: transverse momentum at the last check
+        scalar _pT{std::numeric_limits<scalar>::max()};
+        /// Statistics: Did the aborter stop the track?
+        bool _triggered{false};
+    };
+
+    /// Aborts the propagation if the transverse momentum has fallen below
+    /// the minimum
+    ///
+    /// @param abrt_state contains the minimal transverse momentum
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        auto &navigation = prop_state._navigation;
+
+        if (navigation.is_complete()) {
+            return;
+        }
+
+        abrt_state._pT = static_cast<scalar>(prop_state._stepping().pT());
+        if (abrt_state._pT < abrt_state._min_pT) {
+            abrt_state._triggered = true;
+            prop_state._heartbeat &= navigation.abort();
+        }
+    }
+};
+
+/// Aborter that limits the number of steps per track
+struct step_limit_aborter : actor {
+
+    struct state {
+        /// Maximal number of steps
+        std::size_t _max_steps{std::numeric_limits<std::size_t>::max()};
+
+        /// Statistics: Number of steps (actor calls) so far
+        std::size_t _n_steps{0u};
+        /// Statistics: Did the aborter stop the track?
+        bool _triggered{false};
+    };
+
+    /// Counts the steps and aborts the propagation if the budget is spent
+    ///
+    /// @param abrt_state contains the step budget
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        auto &navigation = prop_state._navigation;
+
+        if (navigation.is_complete()) {
+            return;
+        }
+
+        if (++abrt_state._n_steps > abrt_state._max_steps) {
+            abrt_state._triggered = true;
+            prop_state._heartbeat &= navigation.abort();
+        }
+    }
+};
+
+/// Aborter that limits the number of volume switches per track
+struct volume_switch_aborter : actor {
+
+    struct state {
+        /// Maximal number of volume switches
+        std::size_t _max_switches{std::numeric_limits<std::size_t>::max()};
+
+        /// The volume the track was in at the last check
+        dindex _last_volume{dindex_invalid};
+        /// Statistics: Number of volume switches so far
+        std::size_t _n_switches{0u};
+        /// Statistics: Did the aborter stop the track?
+        bool _triggered{false};
+    };
+
+    /// Counts the volume switches and aborts the propagation if there are
+    /// too many
+    ///
+    /// @param abrt_state contains the maximal number of volume switches
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        auto &navigation = prop_state._navigation;
+
+        if (navigation.is_complete()) {
+            return;
+        }
+
+        const auto volume{static_cast<dindex>(navigation.volume())};
+        if (abrt_state._last_volume != dindex_invalid and
+            volume != abrt_state._last_volume) {
+            ++abrt_state._n_switches;
+        }
+        abrt_state._last_volume = volume;
+
+        if (abrt_state._n_switches > abrt_state._max_switches) {
+            abrt_state._triggered = true;
+            prop_state._heartbeat &= navigation.abort();
+        }
+    }
+};
+
+/// Aborter that stops tracks that no longer make progress
+struct stuck_track_aborter : actor {
+
+    struct state {
+        /// Maximal number of consecutive updates without progress
+        std::size_t _max_zero_progress{10u};
+        /// Path length below which an update counts as zero progress
+        scalar _min_progress{1e-4f};
+
+        /// Path length at the last check
+        scalar _last_path_length{0.f};
+        /// Statistics: Number of consecutive updates without progress
+        std::size_t _n_zero_progress{0u};
+        /// Statistics: Did the aborter stop the track?
+        bool _triggered{false};
+    };
+
+    /// Counts the consecutive updates without progress and aborts the
+    /// propagation if there are too many
+    ///
+    /// @param abrt_state contains the number of allowed updates
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        auto &navigation = prop_state._navigation;
+
+        if (navigation.is_complete()) {
+            return;
+        }
+
+        const auto path_length{
+            static_cast<scalar>(prop_state._stepping.path_length())};
+        if (std::abs(path_length - abrt_state._last_path_length) <
+            abrt_state._min_progress) {
+            ++abrt_state._n_zero_progress;
+        } else {
+            abrt_state._n_zero_progress = 0u;
+        }
+        abrt_state._last_path_length = path_length;
+
+        if (abrt_state._n_zero_progress > abrt_state._max_zero_progress) {
+            abrt_state._triggered = true;
+            prop_state._heartbeat &= navigation.abort();
+        }
+    }
+};
+
+/// Aborter that detects loopers by repeated visits to the same surfaces
+///
+/// Keeps the barcodes of the last @c n_history surfaces that were reached
+/// and aborts when a surface appears too often among them.
+struct looper_aborter : actor {
+
+    /// Number of surfaces that are remembered
+    static constexpr std::size_t n_history{16u};
+
+    struct state {
+        /// Maximal number of visits to the same surface
+        std::size_t _max_visits{3u};
+
+        /// Ring buffer of the last surfaces that were reached
+        darray<geometry::barcode, n_history> _history{};
+        /// Position of the next entry in the ring buffer
+        std::size_t _next{0u};
+        /// The surface the track was on at the last check
+        geometry::barcode _last_surface{};
+
+        /// Statistics: Number of surfaces reached
+        std::size_t _n_surfaces{0u};
+        /// Statistics: Highest number of visits to a single surface
+        std::size_t _n_max_visits{0u};
+        /// Statistics: Did the aborter stop the track?
+        bool _triggered{false};
+    };
+
+    /// Records the surface the track is on and aborts the propagation if it
+    /// has been visited too often
+    ///
+    /// @param abrt_state contains the surface history
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        auto &navigation = prop_state._navigation;
+
+        if (navigation.is_complete() or
+            not(navigation.is_on_module() or navigation.is_on_portal())) {
+            return;
+        }
+
+        // Count every surface only once per crossing
+        const geometry::barcode surface = navigation.current_object();
+        if (surface == abrt_state._last_surface) {
+            return;
+        }
+        abrt_state._last_surface = surface;
+
+        std::size_t n_visits{1u};
+        for (const geometry::barcode &bcd : abrt_state._history) {
+            n_visits += (bcd == surface) ? 1u : 0u;
+        }
+        abrt_state._history[abrt_state._next] = surface;
+        abrt_state._next = (abrt_state._next + 1u) % n_history;
+
+        ++abrt_state._n_surfaces;
+        if (n_visits > abrt_state._n_max_visits) {
+            abrt_state._n_max_visits = n_visits;
+        }
+
+        if (n_visits > abrt_state._max_visits) {
+            abrt_state._triggered = true;
+            prop_state._heartbeat &= navigation.abort();
+        }
+    }
+};
+
+/// @brief Counts how often the track aborters stopped a track.
+///
+/// Add the aborter states of every propagated track to tune the cuts.
+struct aborter_statistics {
+
+    /// Number of tracks that were added
+    std::size_t n_tracks{0u};
+    /// Number of tracks that were stopped by the respective aborter
+    std::size_t n_min_pT{0u};
+    std::size_t n_step_limit{0u};
+    std::size_t n_volume_switches{0u};
+    std::size_t n_stuck{0u};
+    std::size_t n_loopers{0u};
+
+    /// Add the aborter states @param states of a finished track (other
+    /// actor states are ignored)
+    template <typename... states_t>
+    DETRAY_HOST void add(const states_t &... states) {
+        (count(states), ...);
+        ++n_tracks;
+    }
+
+    private:
+    DETRAY_HOST void count(const min_pT_aborter::state &s) {
+        n_min_pT += s._triggered ? 1u : 0u;
+    }
+    DETRAY_HOST void count(const step_limit_aborter::state &s) {
+        n_step_limit += s._triggered ? 1u : 0u;
+    }
+    DETRAY_HOST void count(const volume_switch_aborter::state &s) {
+        n_volume_switches += s._triggered ? 1u : 0u;
+    }
+    DETRAY_HOST void count(const stuck_track_aborter::state &s) {
+        n_stuck += s._triggered ? 1u : 0u;
+    }
+    DETRAY_HOST void count(const looper_aborter::state &s) {
+        n_loopers += s._triggered ? 1u : 0u;
+    }
+    template <typename state_t>
+    DETRAY_HOST void count(const state_t & /*other*/) {}
+};
+
 }  // namespace detray
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/tracks/detail/track_helper.hpp"
+#include "detray/utils/algebra_cast.hpp"
 
 namespace detray {
 
@@ -34,15 +35,23 @@ struct parameter_resetter : actor {
         /// @}
 
         template <typename mask_group_t, typename index_t,
-                  typename stepper_state_t>
+                  typename det_transform3_t, typename stepper_state_t>
         DETRAY_HOST_DEVICE inline void operator()(
             const mask_group_t& mask_group, const index_t& index,
-            const transform3_t& trf3, stepper_state_t& stepping) const {
+            const det_transform3_t& det_trf3, stepper_state_t& stepping) const {
 
             // Note: How is it possible with "range"???
             const auto& mask = mask_group[index];
 
-            auto local_coordinate = mask.local_frame();
+            // The detector can be given in a different precision than the
+            // track: Reset the track parameters in the track precision
+            const auto& trf3 = detail::cast_transform3<transform3_t>(det_trf3);
+
+            using mask_t = typename mask_group_t::value_type;
+            using local_frame_t =
+                typename mask_t::shape::template local_frame_type<
+                    transform3_t>;
+            auto local_coordinate = local_frame_t{};
 
             // Reset the free vector
             stepping().set_vector(local_coordinate.bound_to_free_vector(
@@ -51,6 +60,11 @@ struct parameter_resetter : actor {
             // Reset the path length
             stepping._s = 0;
 
+            // Reset the material noise from the volume material
+            stepping._mat_noise =
+                matrix_operator().template zero<e_free_size, e_free_size>();
+            stepping._path_in_X0 = 0.f;
+
             // Reset jacobian coordinate transformation at the current surface
             stepping._jac_to_global = local_coordinate.bound_to_free_jacobian(
                 trf3, mask, stepping._bound_params.vector());
@@ -78,7 +92,9 @@ struct parameter_resetter : actor {
             const auto& surface = navigation.current()->surface;
 
             mask_store.template visit<kernel>(
-                surface.mask(), trf_store[surface.transform()], stepping);
+                surface.mask(),
+                stepping._trf_cache(trf_store, surface.transform()),
+                stepping);
         }
     }
 };
@@ -11,7 +11,9 @@
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/detail/covariance_engine.hpp"
 #include "detray/tracks/detail/track_helper.hpp"
+#include "detray/utils/algebra_cast.hpp"
 
 namespace detray {
 
@@ -51,23 +53,33 @@ struct parameter_transporter : actor {
         using free_to_path_matrix = matrix_type<1, e_free_size>;
         // Track helper
         using track_helper = detail::track_helper<matrix_operator>;
+        // Structure aware jacobian and covariance products
+        using covariance_engine = detail::covariance_engine<matrix_operator>;
         // Vector in 3D space
         using vector3 = typename transform3_t::vector3;
 
         /// @}
 
         template <typename mask_group_t, typename index_t,
-                  typename propagator_state_t>
+                  typename det_transform3_t, typename propagator_state_t>
         DETRAY_HOST_DEVICE inline void operator()(
-            const mask_group_t& mask_group, const index_t& index,
-            const transform3_type& trf3, propagator_state_t& propagation) {
+            const mask_group_t& /*mask_group*/, const index_t& /*index*/,
+            const det_transform3_t& det_trf3, propagator_state_t& propagation) {
 
             // Stepper and Navigator states
             auto& stepping = propagation._stepping;
 
-            // Mask
-            const auto& mask = mask_group[index];
-            auto local_coordinate = mask.local_frame();
+            // The detector can be given in a different precision than the
+            // track: Do the covariance transport in the track precision
+            const auto& trf3 =
+                detail::cast_transform3<transform3_type>(det_trf3);
+
+            // Local frame of the mask in the track algebra
+            using mask_t = typename mask_group_t::value_type;
+            using local_frame_t =
+                typename mask_t::shape::template local_frame_type<
+                    transform3_type>;
+            auto local_coordinate = local_frame_t{};
 
             // Free vector
             const auto& free_vec = stepping().vector();
@@ -81,28 +93,30 @@ struct parameter_transporter : actor {
                 local_coordinate.free_to_bound_jacobian(trf3, free_vec);
 
             // Transport jacobian in free coordinate
-            free_matrix& free_transport_jacobian = stepping._jac_transport;
-
-            // Path correction factor
-            free_matrix path_correction = local_coordinate.path_correction(
-                stepping().pos(), stepping().dir(), stepping.dtds(), trf3);
-
-            const free_matrix correction_term =
-                matrix_operator()
-                    .template identity<e_free_size, e_free_size>() +
-                path_correction;
+            const free_matrix& free_transport_jacobian =
+                stepping._jac_transport;
+
+            // Path correction as rank-one update of the free to bound
+            // jacobian: F2B * (I + u * v), with v the path derivative
+            const free_to_bound_matrix corrected_free_to_bound =
+                covariance_engine().correct_free_to_bound(
+                    free_to_bound_jacobian,
+                    local_coordinate.path_derivative(trf3, stepping().pos(),
+                                                     stepping().dir()),
+                    stepping().dir(), stepping.dtds());
+
+            const free_to_bound_matrix transport_jacobian =
+                covariance_engine().transport(corrected_free_to_bound,
+                                              free_transport_jacobian);
 
             bound_matrix new_cov =
                 matrix_operator().template zero<e_bound_size, e_bound_size>();
 
             if (propagation.param_type() == parameter_type::e_free) {
 
-                const matrix_type<e_bound_size, e_free_size> full_jacobian =
-                    free_to_bound_jacobian * correction_term *
-                    free_transport_jacobian;
-
-                new_cov = full_jacobian * stepping().covariance() *
-                          matrix_operator().transpose(full_jacobian);
+                new_cov = covariance_engine().unpack(
+                    covariance_engine().template similarity<e_free_size>(
+                        transport_jacobian, stepping().covariance()));
 
                 propagation.set_param_type(parameter_type::e_bound);
 
@@ -111,13 +125,23 @@ struct parameter_transporter : actor {
                 const bound_to_free_matrix& bound_to_free_jacobian =
                     stepping._jac_to_global;
 
-                stepping._full_jacobian =
-                    free_to_bound_jacobian * correction_term *
-                    free_transport_jacobian * bound_to_free_jacobian;
+                stepping._full_jacobian = covariance_engine().to_bound(
+                    transport_jacobian, bound_to_free_jacobian);
+
+                new_cov = covariance_engine().unpack(
+                    covariance_engine().template similarity<e_bound_size>(
+                        stepping._full_jacobian,
+                        stepping._bound_params.covariance()));
+            }
 
-                new_cov = stepping._full_jacobian *
-                          stepping._bound_params.covariance() *
-                          matrix_operator().transpose(stepping._full_jacobian);
+            // Add the noise from the volume material along the way, which
+            // was already transported to the current position
+            if (stepping._path_in_X0 > 0.f) {
+                new_cov = new_cov +
+                          covariance_engine().unpack(
+                              covariance_engine().template similarity<
+                                  e_free_size>(corrected_free_to_bound,
+                                               stepping._mat_noise));
             }
 
             // Calculate surface-to-surface covariance transport
@@ -141,8 +165,12 @@ struct parameter_transporter : actor {
             // Surface
             const auto& surface = navigation.current()->surface;
 
+            // The surface placement in the track algebra is cached in the
+            // stepper state and reused by the parameter resetter
             mask_store.template visit<kernel>(
-                surface.mask(), trf_store[surface.transform()], propagation);
+                surface.mask(),
+                stepping._trf_cache(trf_store, surface.transform()),
+                propagation);
 
             // Set surface link
             stepping._bound_params.set_surface_link(
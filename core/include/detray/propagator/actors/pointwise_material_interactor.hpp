@@ -11,14 +11,18 @@
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/materials/material_map.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/axis_rotation.hpp"
-#include "detray/utils/ranges.hpp"
 
 namespace detray {
 
-template <typename transform3_t>
+/// @tparam transform3_t algebra of the track parameters
+/// @tparam mat_scalar_t precision of the detector material
+template <typename transform3_t,
+          typename mat_scalar_t = typename transform3_t::scalar_type>
 struct pointwise_material_interactor : actor {
     using transform3_type = transform3_t;
     using matrix_operator = typename transform3_t::matrix_actor;
@@ -27,13 +31,15 @@ struct pointwise_material_interactor : actor {
     template <size_type ROWS, size_type COLS>
     using matrix_type =
         typename matrix_operator::template matrix_type<ROWS, COLS>;
-    using interaction_type = interaction<scalar_type>;
+    /// The material interaction is evaluated in the precision of the detector
+    /// material, which can be different from the track precision
+    using interaction_type = interaction<mat_scalar_t>;
     using vector3 = typename transform3_t::vector3;
     using bound_vector = matrix_type<e_bound_size, 1u>;
     using bound_matrix = matrix_type<e_bound_size, e_bound_size>;
 
     struct state {
-        using vector3 = __plugin::vector3<scalar>;
+        using vector3 = typename transform3_t::vector3;
 
         /// The particle mass
         scalar_type mass{105.7f * unit<scalar_type>::MeV};
@@ -50,6 +56,8 @@ struct pointwise_material_interactor : actor {
         bool do_covariance_transport = true;
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
+        /// Use the interaction tables of the detector, where available
+        bool use_interaction_tables = true;
 
         DETRAY_HOST_DEVICE
         void reset() {
@@ -66,30 +74,60 @@ struct pointwise_material_interactor : actor {
         using state = typename pointwise_material_interactor::state;
 
         template <typename material_group_t, typename index_t,
-                  typename surface_t>
+                  typename surface_t, typename algebra_t, typename tables_t>
         DETRAY_HOST_DEVICE inline bool operator()(
             const material_group_t &material_group,
             const index_t &material_range,
-            const intersection2D<surface_t, transform3_type> &is, state &s,
-            const bound_track_parameters<transform3_type> &bound_params) const {
-
-            const scalar qop = bound_params.qop();
-            const scalar charge = bound_params.charge();
+            const intersection2D<surface_t, algebra_t> &is, state &s,
+            const bound_track_parameters<transform3_type> &bound_params,
+            const tables_t &tables, const std::size_t coll_idx) const {
+
+            const scalar_type qop{static_cast<scalar_type>(bound_params.qop())};
+            const scalar_type charge{
+                static_cast<scalar_type>(bound_params.charge())};
+            const scalar_type mass{static_cast<scalar_type>(s.mass)};
+
+            // Use the tabulated values, if available for the material and
+            // the momentum of the track
+            const auto *table =
+                s.use_interaction_tables
+                    ? tables.find(coll_idx,
+                                  detail::get_material_position(
+                                      material_group, material_range, is),
+                                  s.pdg, mass, charge)
+                    : nullptr;
+            const auto node = table ? table->locate(qop)
+                                    : typename tables_t::table_type::node{};
+            if (not node.in_range) {
+                table = nullptr;
+            }
 
+            // Homogeneous material or the bin of a material map at the
+            // local position of the intersection
             for (const auto &mat :
-                 detray::ranges::subrange(material_group, material_range)) {
+                 detail::get_material(material_group, material_range, is)) {
+
+                // Empty material map bin
+                if (not mat) {
+                    continue;
+                }
 
                 // Energy Loss
                 if (s.do_energy_loss) {
-                    s.e_loss = interaction_type().compute_energy_loss_bethe(
-                        is, mat, s.pdg, s.mass, qop, charge);
+                    s.e_loss =
+                        table ? table->compute_energy_loss_bethe(is, mat, node)
+                              : interaction_type().compute_energy_loss_bethe(
+                                    is, mat, s.pdg, mass, qop, charge);
                 }
 
                 // @todo: include the radiative loss (Bremsstrahlung)
                 if (s.do_energy_loss && s.do_covariance_transport) {
-                    s.sigma_qop = interaction_type()
-                                      .compute_energy_loss_landau_sigma_QOverP(
-                                          is, mat, s.pdg, s.mass, qop, charge);
+                    s.sigma_qop =
+                        table ? table->compute_energy_loss_landau_sigma_QOverP(
+                                    is, mat, node)
+                              : interaction_type()
+                                    .compute_energy_loss_landau_sigma_QOverP(
+                                        is, mat, s.pdg, mass, qop, charge);
                 }
 
                 // Covariance update
@@ -97,8 +135,11 @@ struct pointwise_material_interactor : actor {
                     // @todo: use momentum before or after energy loss in
                     // backward mode?
                     s.projected_scattering_angle =
-                        interaction_type().compute_multiple_scattering_theta0(
-                            is, mat, s.pdg, s.mass, qop, charge);
+                        table ? table->compute_multiple_scattering_theta0(
+                                    is, mat, node)
+                              : interaction_type()
+                                    .compute_multiple_scattering_theta0(
+                                        is, mat, s.pdg, mass, qop, charge);
                 }
             }
 
@@ -123,7 +164,8 @@ struct pointwise_material_interactor : actor {
 
             this->update(stepping._bound_params, interactor_state,
                          static_cast<int>(navigation.direction()),
-                         *navigation.current(), det->material_store());
+                         *navigation.current(), det->material_store(),
+                         det->interaction_tables());
         }
     }
 
@@ -134,14 +176,18 @@ struct pointwise_material_interactor : actor {
     /// @param[in]  nav_dir navigation direction
     /// @param[in]  is intersection
     /// @param[in]  mat_store material store
-    template <typename intersection_t, typename material_store_t>
+    /// @param[in]  tables interaction tables of the material store
+    template <typename intersection_t, typename material_store_t,
+              typename tables_t>
     DETRAY_HOST_DEVICE inline void update(
         bound_track_parameters<transform3_type> &bound_params,
         state &interactor_state, const int nav_dir, const intersection_t &is,
-        const material_store_t &mat_store) const {
+        const material_store_t &mat_store, const tables_t &tables) const {
 
+        const auto &mat_link = is.surface.material();
         auto succeed = mat_store.template visit<kernel>(
-            is.surface.material(), is, interactor_state, bound_params);
+            mat_link, is, interactor_state, bound_params, tables,
+            static_cast<std::size_t>(detail::get<0>(mat_link)));
 
         if (succeed) {
 
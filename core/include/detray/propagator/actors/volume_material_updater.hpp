@@ -0,0 +1,78 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/utils/algebra_cast.hpp"
+
+// System include(s)
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Actor that hands the material of the current volume to the stepper.
+///
+/// The stepper then applies the continuous energy loss and accumulates the
+/// scattering noise during the next step (currently only the @c rk_stepper).
+/// The material is looked up at the track position after every step, so that
+/// volume material maps are sampled once per step.
+///
+/// @tparam transform3_t algebra of the track parameters
+template <typename transform3_t>
+struct volume_material_updater : actor {
+
+    using scalar_type = typename transform3_t::scalar_type;
+
+    struct state {
+        /// Switch off the continuous material interaction
+        bool do_material_interaction = true;
+
+        /// Material of the current volume in the track precision, in case
+        /// the detector is given in a different precision
+        material<scalar_type> mat{};
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &updater_state,
+                                       propagator_state_t &propagation) const {
+
+        auto &navigation = propagation._navigation;
+        auto &stepping = propagation._stepping;
+
+        stepping._mat = nullptr;
+
+        if (not updater_state.do_material_interaction or
+            navigation.is_complete()) {
+            return;
+        }
+
+        const auto *det = navigation.detector();
+        const auto volume = det->volume_by_index(navigation.volume());
+
+        // The material is looked up in the detector precision
+        using detector_t = std::decay_t<decltype(*det)>;
+        using det_transform3_t = typename detector_t::transform3;
+
+        const auto *mat = volume.material_at(
+            detail::cast_point3<det_transform3_t>(stepping().pos()),
+            detail::cast_vector3<det_transform3_t>(stepping().dir()));
+
+        if constexpr (std::is_same_v<typename detector_t::scalar_type,
+                                     scalar_type>) {
+            stepping._mat = mat;
+        } else if (mat != nullptr) {
+            updater_state.mat = detail::cast_material<scalar_type>(*mat);
+            stepping._mat = &(updater_state.mat);
+        }
+    }
+};
+
+}  // namespace detray
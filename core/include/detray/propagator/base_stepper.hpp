@@ -13,6 +13,7 @@
 #include "detray/propagator/actors/parameter_resetter.hpp"
 #include "detray/propagator/constrained_step.hpp"
 #include "detray/tracks/tracks.hpp"
+#include "detray/utils/algebra_cast.hpp"
 
 namespace detray {
 
@@ -23,6 +24,8 @@ enum class id {
     e_linear = 0,
     // True for charged tracks
     e_rk = 1,
+    // Analytic propagation in homogeneous fields
+    e_helix = 2,
 };
 
 }  // namespace stepping
@@ -80,7 +83,8 @@ class base_stepper {
 
             mask_store.template visit<
                 typename parameter_resetter<transform3_t>::kernel>(
-                surface.mask(), trf_store[surface.transform()], *this);
+                surface.mask(), _trf_cache(trf_store, surface.transform()),
+                *this);
         }
 
         /// free track parameter
@@ -118,14 +122,29 @@ class base_stepper {
         typename policy_t::state _policy_state = {};
 
         /// Track path length
-        scalar _path_length{0.};
+        scalar_type _path_length{0.};
 
         /// Track path length from the last surface. It will be reset to 0 when
         /// the track reaches a new surface
-        scalar _s{0.};
+        scalar_type _s{0.};
 
         /// Current step size
-        scalar _step_size{0.};
+        scalar_type _step_size{0.};
+
+        /// Covariance of the free track parameters from the scattering and
+        /// energy loss in volume material since the last surface. The noise
+        /// of every step is added at the end of the step and transported
+        /// along with the track. It will be added to the covariance during
+        /// the covariance transport
+        free_matrix _mat_noise =
+            matrix_operator().template zero<e_free_size, e_free_size>();
+
+        /// Path length in volume material since the last surface in units
+        /// of the radiation length
+        scalar_type _path_in_X0{0.};
+
+        /// Placement of the current surface in the track algebra
+        detail::transform3_cache<transform3_t> _trf_cache{};
 
         /// TODO: Use options?
         /// hypothetical mass of particle (assume pion by default)
@@ -164,15 +183,17 @@ class base_stepper {
 
         /// Set next step size
         DETRAY_HOST_DEVICE
-        inline void set_step_size(const scalar step) { _step_size = step; }
+        inline void set_step_size(const scalar_type step) {
+            _step_size = step;
+        }
 
         /// @returns the current step size of this state.
         DETRAY_HOST_DEVICE
-        inline scalar step_size() const { return _step_size; }
+        inline scalar_type step_size() const { return _step_size; }
 
         /// @returns this states remaining path length.
         DETRAY_HOST_DEVICE
-        inline scalar path_length() const { return _path_length; }
+        inline scalar_type path_length() const { return _path_length; }
     };
 };
 
@@ -33,12 +33,18 @@ enum direction : int {
 /// from actor    - this would be a typical navigation step
 /// from aborter  - this would be a target condition
 /// from user     - this is user given for what reason ever
+/// from curvature - predicted from the local field and momentum of the track,
+///                  is updated by the stepper before every step. It only caps
+///                  the initial step size of the adaptive steppers and is not
+///                  part of the overall constraint (opt-in, see
+///                  @c curvature_constrained_step )
 enum constraint : std::size_t {
     e_accuracy = 0u,
     e_actor = 1u,
     e_aborter = 2u,
     e_user = 3u,
-    e_all = 4u
+    e_curvature = 4u,
+    e_all = 5u
 };
 
 }  // namespace step
@@ -46,6 +52,9 @@ enum constraint : std::size_t {
 /// Struct that represents unconstrained stepping
 struct unconstrained_step {
 
+    /// No step size prediction from the track curvature
+    static constexpr bool predict_curvature{false};
+
     /// Register a new @param step_size constraint
     template <step::constraint type>
     DETRAY_HOST_DEVICE constexpr void set(const scalar /*step_size*/) const {}
@@ -67,6 +76,9 @@ struct unconstrained_step {
 template <template <typename, std::size_t> class array_t = darray>
 struct constrained_step {
 
+    /// No step size prediction from the track curvature
+    static constexpr bool predict_curvature{false};
+
     /// Register a new @param step_size constraint
     template <
         step::constraint type,
@@ -91,6 +103,7 @@ struct constrained_step {
     DETRAY_HOST_DEVICE void release() {
         if constexpr (type == step::constraint::e_all) {
             _constraints = {std::numeric_limits<scalar>::max(),
+                            std::numeric_limits<scalar>::max(),
                             std::numeric_limits<scalar>::max(),
                             std::numeric_limits<scalar>::max(),
                             std::numeric_limits<scalar>::max()};
@@ -99,7 +112,8 @@ struct constrained_step {
         }
     }
 
-    /// @returns the strongest constraint
+    /// @returns the strongest constraint (the curvature prediction is not a
+    /// hard limit and therefore not included)
     DETRAY_HOST_DEVICE scalar min() const {
         scalar min_constr = std::numeric_limits<scalar>::max();
         min_constr =
@@ -111,10 +125,24 @@ struct constrained_step {
         return std::min(min_constr, _constraints[step::constraint::e_user]);
     }
 
-    /// Current step size constraints from accuracy, actors, aborters or user
-    array_t<scalar, 4> _constraints = {
+    /// Current step size constraints from accuracy, actors, aborters, user or
+    /// track curvature
+    array_t<scalar, 5> _constraints = {
+        std::numeric_limits<scalar>::max(), std::numeric_limits<scalar>::max(),
         std::numeric_limits<scalar>::max(), std::numeric_limits<scalar>::max(),
-        std::numeric_limits<scalar>::max(), std::numeric_limits<scalar>::max()};
+        std::numeric_limits<scalar>::max()};
+};
+
+/// Constrained stepping, for which the RK stepper predicts the largest step
+/// size that passes its error estimate from the local field and q/p before
+/// every step (@c step::constraint::e_curvature ). The prediction caps the
+/// initial step size only, so that the navigation trust level is not lowered
+/// when a step was cut by it.
+template <template <typename, std::size_t> class array_t = darray>
+struct curvature_constrained_step : public constrained_step<array_t> {
+
+    /// Predict the step size from the track curvature
+    static constexpr bool predict_curvature{true};
 };
 
 }  // namespace detray
\ No newline at end of file
@@ -0,0 +1,258 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+
+namespace detray::detail {
+
+/// @brief Covariance transport that exploits the structure of the jacobians.
+///
+/// The full jacobian from the departure to the destination surface is
+/// F2B * (I + u * v) * T * B2F with the free-to-bound jacobian F2B, the path
+/// correction u * v, the free transport jacobian T and the bound-to-free
+/// jacobian B2F. The dense products are replaced by:
+///  - a rank-one update of F2B instead of the 8x8 correction term product,
+///  - products that only visit the non-zero blocks of F2B and B2F:
+///    the time and q/p parameters are copied between the frames, the bound
+///    angles only depend on the free direction and the bound local position
+///    only contributes to the free position,
+///  - a similarity transform that only computes the 21 unique elements of
+///    the symmetric result.
+template <typename matrix_operator_t>
+struct covariance_engine {
+
+    /// @name Type definitions for the struct
+    /// @{
+
+    // Matrix actor
+    using matrix_operator = matrix_operator_t;
+    // Size type
+    using size_type = typename matrix_operator_t::size_ty;
+    // Scalar type
+    using scalar_type = typename matrix_operator_t::scalar_type;
+    // 2D matrix type
+    template <size_type ROWS, size_type COLS>
+    using matrix_type =
+        typename matrix_operator::template matrix_type<ROWS, COLS>;
+    // Array type
+    template <size_type N>
+    using array_type = typename matrix_operator::template array_type<N>;
+    // 3-element "vector" type
+    using vector3 = array_type<3>;
+    // Shorthand vector/matrix types related to bound track parameters.
+    using bound_matrix = matrix_type<e_bound_size, e_bound_size>;
+    using bound_to_free_matrix = matrix_type<e_free_size, e_bound_size>;
+    // Shorthand vector/matrix types related to free track parameters.
+    using free_matrix = matrix_type<e_free_size, e_free_size>;
+    using free_to_bound_matrix = matrix_type<e_bound_size, e_free_size>;
+    using free_to_path_matrix = matrix_type<1, e_free_size>;
+    // Packed upper triangle of a symmetric bound matrix (row-wise)
+    using bound_sym_matrix =
+        darray<scalar_type, (e_bound_size * (e_bound_size + 1u)) / 2u>;
+
+    /// @}
+
+    /// @returns the index of the element ( @param i, @param j ) with i <= j
+    /// in the packed symmetric storage
+    DETRAY_HOST_DEVICE
+    static constexpr unsigned int sym_index(const unsigned int i,
+                                            const unsigned int j) {
+        return i * e_bound_size - (i * (i - 1u)) / 2u + j - i;
+    }
+
+    /// @returns the free position (for @param k < 3) and direction index
+    /// (for @param k in [3, 6)): The only non-zero columns of the bound
+    /// position and angle rows of F2B and the only non-zero rows of the
+    /// bound angle columns of B2F
+    DETRAY_HOST_DEVICE
+    static constexpr unsigned int pos_dir(const unsigned int k) {
+        return k < 3u ? e_free_pos0 + k : e_free_dir0 + k - 3u;
+    }
+
+    /// Apply the path correction to the free-to-bound jacobian as a rank-one
+    /// update: F2B * (I + u * v) = F2B + (F2B * u) * v
+    ///
+    /// @param free_to_bound_jacobian F2B at the destination surface
+    /// @param path_derivative v, the derivative of the path length
+    /// @param dir the track direction (position part of u)
+    /// @param dtds the derivative of the direction (direction part of u)
+    ///
+    /// @returns the corrected free-to-bound jacobian
+    DETRAY_HOST_DEVICE
+    inline free_to_bound_matrix correct_free_to_bound(
+        const free_to_bound_matrix& free_to_bound_jacobian,
+        const free_to_path_matrix& path_derivative, const vector3& dir,
+        const vector3& dtds) const {
+
+        free_to_bound_matrix ret = free_to_bound_jacobian;
+
+        // Time and q/p do not depend on the path length: Only the bound
+        // position and angle rows are updated
+        for (unsigned int i = e_bound_loc0; i <= e_bound_theta; ++i) {
+            scalar_type f2b_u{0.f};
+            for (unsigned int k = 0u; k < 3u; ++k) {
+                f2b_u += matrix_operator().element(free_to_bound_jacobian, i,
+                                                   e_free_pos0 + k) *
+                             dir[k] +
+                         matrix_operator().element(free_to_bound_jacobian, i,
+                                                   e_free_dir0 + k) *
+                             dtds[k];
+            }
+            for (unsigned int k = 0u; k < 6u; ++k) {
+                matrix_operator().element(ret, i, pos_dir(k)) +=
+                    f2b_u * matrix_operator().element(path_derivative, 0u,
+                                                      pos_dir(k));
+            }
+        }
+
+        return ret;
+    }
+
+    /// @returns the product of the (corrected) free-to-bound jacobian
+    /// @param free_to_bound_jacobian and the free transport jacobian
+    /// @param free_transport_jacobian
+    DETRAY_HOST_DEVICE
+    inline free_to_bound_matrix transport(
+        const free_to_bound_matrix& free_to_bound_jacobian,
+        const free_matrix& free_transport_jacobian) const {
+
+        free_to_bound_matrix ret;
+
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            for (unsigned int i = e_bound_loc0; i <= e_bound_theta; ++i) {
+                scalar_type elem{0.f};
+                for (unsigned int k = 0u; k < 6u; ++k) {
+                    elem += matrix_operator().element(free_to_bound_jacobian,
+                                                      i, pos_dir(k)) *
+                            matrix_operator().element(free_transport_jacobian,
+                                                      pos_dir(k), j);
+                }
+                matrix_operator().element(ret, i, j) = elem;
+            }
+            matrix_operator().element(ret, e_bound_time, j) =
+                matrix_operator().element(free_to_bound_jacobian,
+                                          e_bound_time, e_free_time) *
+                matrix_operator().element(free_transport_jacobian,
+                                          e_free_time, j);
+            matrix_operator().element(ret, e_bound_qoverp, j) =
+                matrix_operator().element(free_to_bound_jacobian,
+                                          e_bound_qoverp, e_free_qoverp) *
+                matrix_operator().element(free_transport_jacobian,
+                                          e_free_qoverp, j);
+        }
+
+        return ret;
+    }
+
+    /// @returns the full jacobian from the product of @param jacobian (the
+    /// transport from free parameters to the destination surface) and the
+    /// bound-to-free jacobian @param bound_to_free_jacobian
+    DETRAY_HOST_DEVICE
+    inline bound_matrix to_bound(
+        const free_to_bound_matrix& jacobian,
+        const bound_to_free_matrix& bound_to_free_jacobian) const {
+
+        bound_matrix ret;
+
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            // The bound position only changes the free position
+            for (unsigned int j = e_bound_loc0; j <= e_bound_loc1; ++j) {
+                scalar_type elem{0.f};
+                for (unsigned int k = e_free_pos0; k <= e_free_pos2; ++k) {
+                    elem += matrix_operator().element(jacobian, i, k) *
+                            matrix_operator().element(bound_to_free_jacobian,
+                                                      k, j);
+                }
+                matrix_operator().element(ret, i, j) = elem;
+            }
+            // The bound angles change the free position and direction
+            for (unsigned int j = e_bound_phi; j <= e_bound_theta; ++j) {
+                scalar_type elem{0.f};
+                for (unsigned int k = 0u; k < 6u; ++k) {
+                    const unsigned int free_idx{pos_dir(k)};
+                    elem += matrix_operator().element(jacobian, i, free_idx) *
+                            matrix_operator().element(bound_to_free_jacobian,
+                                                      free_idx, j);
+                }
+                matrix_operator().element(ret, i, j) = elem;
+            }
+            matrix_operator().element(ret, i, e_bound_time) =
+                matrix_operator().element(jacobian, i, e_free_time) *
+                matrix_operator().element(bound_to_free_jacobian, e_free_time,
+                                          e_bound_time);
+            matrix_operator().element(ret, i, e_bound_qoverp) =
+                matrix_operator().element(jacobian, i, e_free_qoverp) *
+                matrix_operator().element(bound_to_free_jacobian,
+                                          e_free_qoverp, e_bound_qoverp);
+        }
+
+        return ret;
+    }
+
+    /// Symmetric similarity transform J * C * J^T
+    ///
+    /// @param jacobian J
+    /// @param cov the symmetric covariance C
+    ///
+    /// @returns the unique elements of the transformed covariance
+    template <size_type N>
+    DETRAY_HOST_DEVICE inline bound_sym_matrix similarity(
+        const matrix_type<e_bound_size, N>& jacobian,
+        const matrix_type<N, N>& cov) const {
+
+        // K = C * J^T
+        matrix_type<N, e_bound_size> cov_jt;
+        for (size_type a = 0; a < N; ++a) {
+            for (unsigned int j = 0u; j < e_bound_size; ++j) {
+                scalar_type elem{0.f};
+                for (size_type b = 0; b < N; ++b) {
+                    elem += matrix_operator().element(cov, a, b) *
+                            matrix_operator().element(jacobian, j, b);
+                }
+                matrix_operator().element(cov_jt, a, j) = elem;
+            }
+        }
+
+        // Upper triangle of J * K
+        bound_sym_matrix ret{};
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                scalar_type elem{0.f};
+                for (size_type a = 0; a < N; ++a) {
+                    elem += matrix_operator().element(jacobian, i, a) *
+                            matrix_operator().element(cov_jt, a, j);
+                }
+                ret[sym_index(i, j)] = elem;
+            }
+        }
+
+        return ret;
+    }
+
+    /// @returns the full bound matrix from the packed symmetric storage
+    /// @param sym
+    DETRAY_HOST_DEVICE
+    inline bound_matrix unpack(const bound_sym_matrix& sym) const {
+
+        bound_matrix ret;
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                matrix_operator().element(ret, i, j) = sym[sym_index(i, j)];
+                matrix_operator().element(ret, j, i) = sym[sym_index(i, j)];
+            }
+        }
+
+        return ret;
+    }
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,132 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+/// Stages of the Runge-Kutta-Nystrom 4th order integration of the equations
+/// of motion in a magnetic field.
+///
+/// The stages only use the arithmetic operators and @c cross of the vector
+/// type, so that they can be evaluated for a single track (algebra plugin
+/// vectors and scalars) or for a pack of tracks in lockstep (one SIMD lane
+/// per track, see @c rk_stepper_pack ).
+namespace detray::detail::rkn4 {
+
+/// Precision of a scalar, also if it holds several lanes
+/// @{
+template <typename scalar_t, typename = void>
+struct value_type {
+    using type = scalar_t;
+};
+
+template <typename scalar_t>
+struct value_type<scalar_t, std::void_t<typename scalar_t::value_type>> {
+    using type = typename scalar_t::value_type;
+};
+
+template <typename scalar_t>
+using value_type_t = typename value_type<scalar_t>::type;
+/// @}
+
+/// @returns the position of the second and third Runge-Kutta point, from
+/// the position @param pos , direction @param dir and first stage @param k1
+/// for the step size @param h
+template <typename vector3_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline vector3_t middle_point(const vector3_t& pos,
+                                                 const vector3_t& dir,
+                                                 const vector3_t& k1,
+                                                 const scalar_t& h) {
+    return pos + (h * 0.5f) * dir + (h * h * 0.125f) * k1;
+}
+
+/// @returns the position of the last Runge-Kutta point, from the position
+/// @param pos , direction @param dir and third stage @param k3 for the step
+/// size @param h
+template <typename vector3_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline vector3_t last_point(const vector3_t& pos,
+                                               const vector3_t& dir,
+                                               const vector3_t& k3,
+                                               const scalar_t& h) {
+    return pos + h * dir + (h * h * 0.5f) * k3;
+}
+
+/// @returns the first stage for the charge over momentum @param qop in the
+/// field @param b_field at the initial direction @param dir
+template <typename vector3_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline vector3_t first_stage(const scalar_t& qop,
+                                                const vector3_t& dir,
+                                                const vector3_t& b_field) {
+    using vector::cross;
+    return qop * cross(dir, b_field);
+}
+
+/// @returns the next stage for the charge over momentum @param qop in the
+/// field @param b_field , from the direction @param dir and the previous
+/// stage @param k_prev at the distance @param h
+template <typename vector3_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline vector3_t next_stage(const scalar_t& qop,
+                                               const vector3_t& dir,
+                                               const vector3_t& b_field,
+                                               const vector3_t& k_prev,
+                                               const scalar_t& h) {
+    using vector::cross;
+    return qop * cross(dir + h * k_prev, b_field);
+}
+
+/// @returns the local integration error of the stages @param k1 to
+/// @param k4 for the step size @param h
+template <typename vector3_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline vector3_t error(const vector3_t& k1,
+                                          const vector3_t& k2,
+                                          const vector3_t& k3,
+                                          const vector3_t& k4,
+                                          const scalar_t& h) {
+    return (h * h) * (k1 - k2 - k3 + k4);
+}
+
+/// @returns the position after the step @param h from @param pos with the
+/// direction @param dir and the stages @param k1 to @param k3
+template <typename vector3_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline vector3_t advance_pos(
+    const vector3_t& pos, const vector3_t& dir, const vector3_t& k1,
+    const vector3_t& k2, const vector3_t& k3, const scalar_t& h) {
+    const scalar_t h_6{h * static_cast<value_type_t<scalar_t>>(1. / 6.)};
+    return pos + h * (dir + h_6 * (k1 + k2 + k3));
+}
+
+/// @returns the (not normalized) direction after the step @param h from
+/// @param dir with the stages @param k1 to @param k4
+template <typename vector3_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline vector3_t advance_dir(
+    const vector3_t& dir, const vector3_t& k1, const vector3_t& k2,
+    const vector3_t& k3, const vector3_t& k4, const scalar_t& h) {
+    const scalar_t h_6{h * static_cast<value_type_t<scalar_t>>(1. / 6.)};
+    return dir + h_6 * (k1 + 2.f * (k2 + k3) + k4);
+}
+
+/// @returns the factor by which the step size is adapted to the integration
+/// error @param error_estimate with the tolerance @param tolerance
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t step_size_scaling(
+    const scalar_t tolerance, const scalar_t error_estimate) {
+    return std::min(
+        std::max(static_cast<scalar_t>(0.25f),
+                 std::sqrt(std::sqrt(
+                     (tolerance / std::abs(2.f * error_estimate))))),
+        static_cast<scalar_t>(4));
+}
+
+}  // namespace detray::detail::rkn4
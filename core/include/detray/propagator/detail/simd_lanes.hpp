@@ -0,0 +1,143 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s)
+#include <cstddef>
+
+namespace detray::detail {
+
+/// @brief Scalar of @tparam N tracks that are processed in lockstep.
+///
+/// All arithmetic is done lane by lane in loops of fixed length, which the
+/// compiler maps onto SIMD registers. Plain scalars are broadcast to all
+/// lanes.
+template <typename scalar_t, std::size_t N,
+          template <typename, std::size_t> class array_t = darray>
+struct simd_lanes {
+
+    using value_type = scalar_t;
+
+    /// Number of lanes
+    static constexpr std::size_t width{N};
+
+    /// Default constructor
+    constexpr simd_lanes() = default;
+
+    /// Broadcast @param v to all lanes
+    DETRAY_HOST_DEVICE
+    constexpr simd_lanes(const scalar_t v) {
+        for (std::size_t i = 0u; i < N; ++i) {
+            m_values[i] = v;
+        }
+    }
+
+    /// Access to lane @param i
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr scalar_t& operator[](const std::size_t i) { return m_values[i]; }
+
+    DETRAY_HOST_DEVICE
+    constexpr const scalar_t& operator[](const std::size_t i) const {
+        return m_values[i];
+    }
+    /// @}
+
+    /// Lane-wise arithmetic
+    /// @{
+    DETRAY_HOST_DEVICE
+    friend constexpr simd_lanes operator+(const simd_lanes& a,
+                                          const simd_lanes& b) {
+        simd_lanes r{};
+        for (std::size_t i = 0u; i < N; ++i) {
+            r[i] = a[i] + b[i];
+        }
+        return r;
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr simd_lanes operator-(const simd_lanes& a,
+                                          const simd_lanes& b) {
+        simd_lanes r{};
+        for (std::size_t i = 0u; i < N; ++i) {
+            r[i] = a[i] - b[i];
+        }
+        return r;
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr simd_lanes operator*(const simd_lanes& a,
+                                          const simd_lanes& b) {
+        simd_lanes r{};
+        for (std::size_t i = 0u; i < N; ++i) {
+            r[i] = a[i] * b[i];
+        }
+        return r;
+    }
+    /// @}
+
+    array_t<scalar_t, N> m_values{};
+};
+
+/// @brief 3D vector of @tparam N tracks in SoA layout: One @c simd_lanes per
+/// component.
+template <typename scalar_t, std::size_t N,
+          template <typename, std::size_t> class array_t = darray>
+struct simd_vector3 {
+
+    using lanes_type = simd_lanes<scalar_t, N, array_t>;
+
+    /// Access to the component @param c of all lanes
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr lanes_type& operator[](const unsigned int c) {
+        return m_comps[c];
+    }
+
+    DETRAY_HOST_DEVICE
+    constexpr const lanes_type& operator[](const unsigned int c) const {
+        return m_comps[c];
+    }
+    /// @}
+
+    /// Lane-wise vector arithmetic
+    /// @{
+    DETRAY_HOST_DEVICE
+    friend constexpr simd_vector3 operator+(const simd_vector3& a,
+                                            const simd_vector3& b) {
+        return {{a[0] + b[0], a[1] + b[1], a[2] + b[2]}};
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr simd_vector3 operator-(const simd_vector3& a,
+                                            const simd_vector3& b) {
+        return {{a[0] - b[0], a[1] - b[1], a[2] - b[2]}};
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr simd_vector3 operator*(const lanes_type& s,
+                                            const simd_vector3& v) {
+        return {{s * v[0], s * v[1], s * v[2]}};
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr simd_vector3 cross(const simd_vector3& a,
+                                        const simd_vector3& b) {
+        return {{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+                 a[0] * b[1] - a[1] * b[0]}};
+    }
+    /// @}
+
+    array_t<lanes_type, 3> m_comps{};
+};
+
+}  // namespace detray::detail
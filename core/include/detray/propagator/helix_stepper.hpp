@@ -0,0 +1,267 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersection_kernel.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/navigation_policies.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace detray {
+
+/// Analytic helix stepper for homogeneous magnetic fields
+///
+/// Instead of integrating the equations of motion numerically, the stepper
+/// intersects the helical trajectory with the next candidate surface of the
+/// navigator and advances the track exactly onto it. The free transport
+/// jacobian is given analytically by the helix.
+///
+/// @note The field is evaluated once at the start of every step and is assumed
+/// to be constant along the step. For vanishing fields, the track is advanced
+/// along a straight line.
+///
+/// @tparam magnetic_field_t the type of magnetic field
+/// @tparam transform3_t the algebra type of the track parametrization
+/// @tparam constraint_t the type of constraints on the stepper
+/// @tparam policy_t the navigation policy to be applied after a step
+template <typename magnetic_field_t, typename transform3_t,
+          typename constraint_t = unconstrained_step,
+          typename policy_t = stepper_default_policy>
+class helix_stepper final
+    : public base_stepper<transform3_t, constraint_t, policy_t> {
+
+    public:
+    using base_type = base_stepper<transform3_t, constraint_t, policy_t>;
+    using transform3_type = transform3_t;
+    using policy_type = policy_t;
+    using scalar_type = typename base_type::scalar_type;
+    using point3 = typename transform3_type::point3;
+    using vector3 = typename transform3_type::vector3;
+    using matrix_operator = typename base_type::matrix_operator;
+    using size_type = typename matrix_operator::size_ty;
+    template <size_type ROWS, size_type COLS>
+    using matrix_type =
+        typename matrix_operator::template matrix_type<ROWS, COLS>;
+    using free_track_parameters_type =
+        typename base_type::free_track_parameters_type;
+    using bound_track_parameters_type =
+        typename base_type::bound_track_parameters_type;
+    using helix_type = detail::helix<transform3_type>;
+
+    DETRAY_HOST_DEVICE
+    helix_stepper() {}
+
+    struct state : public base_type::state {
+
+        static constexpr const stepping::id id = stepping::id::e_helix;
+
+        DETRAY_HOST_DEVICE
+        state(const free_track_parameters_type& t,
+              const magnetic_field_t& mag_field)
+            : base_type::state(t), _magnetic_field(mag_field) {}
+
+        template <typename detector_t>
+        DETRAY_HOST_DEVICE state(
+            const bound_track_parameters_type& bound_params,
+            const magnetic_field_t& mag_field, const detector_t& det)
+            : base_type::state(bound_params, det), _magnetic_field(mag_field) {}
+
+        /// Particle hypothesis for the time of flight
+        scalar_type _mass{105.7f * unit<scalar_type>::MeV};
+
+        /// Field strength below which the track is moved on a straight line
+        scalar_type _min_field{1e-6f * unit<scalar_type>::T};
+
+        /// Mask tolerance for the helix intersection with the next candidate
+        scalar_type _mask_tolerance{15.f * unit<scalar_type>::um};
+
+        /// Field vector at the start of the current step
+        vector3 _b_field{0.f, 0.f, 0.f};
+
+        /// Magnetic field view
+        const magnetic_field_t _magnetic_field;
+
+        /// Update the field vector from the current track position
+        DETRAY_HOST_DEVICE
+        inline void update_field() {
+            const point3 pos = this->_track.pos();
+            const typename magnetic_field_t::output_t bvec =
+                _magnetic_field.at(pos[0], pos[1], pos[2]);
+            _b_field = vector3{bvec[0], bvec[1], bvec[2]};
+        }
+
+        /// @returns true if the track should be moved on a straight line
+        DETRAY_HOST_DEVICE
+        inline bool is_field_free() const {
+            return getter::norm(_b_field) < _min_field;
+        }
+
+        /// Update the track state along the helix @param hlx
+        DETRAY_HOST_DEVICE
+        inline void advance_track(const helix_type& hlx) {
+            const scalar_type h{this->_step_size};
+            auto& track = this->_track;
+
+            track.set_pos(hlx.pos(h));
+            track.set_dir(vector::normalize(hlx.dir(h)));
+            advance_time(h);
+
+            this->_path_length += h;
+            this->_s += h;
+        }
+
+        /// Update the track state in a straight line (field free case)
+        DETRAY_HOST_DEVICE
+        inline void advance_track() {
+            auto& track = this->_track;
+            track.set_pos(track.pos() + track.dir() * this->_step_size);
+            advance_time(this->_step_size);
+
+            this->_path_length += this->_step_size;
+            this->_s += this->_step_size;
+        }
+
+        /// Update the track time for the path length @param h :
+        /// dt = h / (beta * c), with c = 1 in native units
+        DETRAY_HOST_DEVICE
+        inline void advance_time(const scalar_type h) {
+            auto& track = this->_track;
+            const scalar_type p{track.p()};
+            const scalar_type beta_inv{
+                std::sqrt(1.f + _mass * _mass / (p * p))};
+
+            track.set_time(track.time() + h * beta_inv);
+        }
+
+        /// Update the jacobian transport analytically along the helix
+        DETRAY_HOST_DEVICE
+        inline void advance_jacobian(const helix_type& hlx) {
+            this->_jac_transport =
+                hlx.jacobian(this->_step_size) * this->_jac_transport;
+        }
+
+        /// Update the jacobian transport for a straight line (field free case)
+        DETRAY_HOST_DEVICE
+        inline void advance_jacobian() {
+            matrix_type<e_free_size, e_free_size> D =
+                matrix_operator().template identity<e_free_size, e_free_size>();
+
+            // d(x,y,z)/d(n_x,n_y,n_z)
+            matrix_type<3, 3> dxdn =
+                this->_step_size * matrix_operator().template identity<3, 3>();
+            matrix_operator().template set_block<3, 3>(D, dxdn, e_free_pos0,
+                                                       e_free_dir0);
+
+            this->_jac_transport = D * this->_jac_transport;
+        }
+
+        /// @returns the derivative of the direction w.r.t. the path length
+        DETRAY_HOST_DEVICE
+        inline vector3 dtds() const {
+            return this->_track.qop() *
+                   vector::cross(this->_track.dir(), _b_field);
+        }
+    };
+
+    /// Take a step exactly onto the next navigation candidate, if possible
+    ///
+    /// @return returning the heartbeat, indicating if the stepping is alive
+    template <typename propagation_state_t>
+    DETRAY_HOST_DEVICE bool step(propagation_state_t& propagation) {
+        // Get stepper and navigator states
+        state& stepping = propagation._stepping;
+        auto& navigation = propagation._navigation;
+
+        // Field is constant along the step
+        stepping.update_field();
+
+        // Straight line distance to the next candidate as first estimate
+        scalar_type step_size{navigation()};
+
+        if (stepping.is_field_free()) {
+            set_step_size(stepping, step_size);
+
+            stepping.advance_track();
+            stepping.advance_jacobian();
+        } else {
+            const helix_type hlx(stepping(), &stepping._b_field);
+
+            // Exact path length to the next candidate along the helix
+            step_size = path_to_next(hlx, stepping, navigation, step_size);
+            set_step_size(stepping, step_size);
+
+            stepping.advance_track(hlx);
+            stepping.advance_jacobian(hlx);
+        }
+
+        // Call navigation update policy
+        policy_t{}(stepping.policy_state(), propagation);
+
+        return true;
+    }
+
+    private:
+    /// Set the step size and navigation direction and apply the constraints
+    DETRAY_HOST_DEVICE
+    inline void set_step_size(state& stepping,
+                              const scalar_type step_size) const {
+        // Update navigation direction
+        const step::direction dir = step_size >= 0.f
+                                        ? step::direction::e_forward
+                                        : step::direction::e_backward;
+        stepping.set_direction(dir);
+
+        // Check constraints
+        if (std::abs(step_size) >
+            std::abs(
+                stepping.constraints().template size<>(stepping.direction()))) {
+            stepping.set_step_size(
+                stepping.constraints().template size<>(stepping.direction()));
+        } else {
+            stepping.set_step_size(step_size);
+        }
+    }
+
+    /// Intersect the helix with the next navigation candidate.
+    ///
+    /// @returns the path length along the helix to the next candidate or the
+    /// straight line estimate @param est, if the helix does not hit the
+    /// candidate surface.
+    template <typename navigation_state_t>
+    DETRAY_HOST_DEVICE inline scalar_type path_to_next(
+        const helix_type& hlx, const state& stepping,
+        const navigation_state_t& navigation, const scalar_type est) const {
+
+        // Work on a copy of the candidate: the navigator owns the cache
+        auto sfi = *navigation.next();
+        if (sfi.surface.barcode().is_invalid()) {
+            return est;
+        }
+
+        const auto* det = navigation.detector();
+        const bool is_hit =
+            det->mask_store().template visit<helix_intersection_update>(
+                sfi.surface.mask(), hlx, sfi, det->transform_store(),
+                stepping._mask_tolerance);
+
+        // Only step onto the surface, if it lies in the direction of travel
+        if (is_hit and sfi.path >= stepping().overstep_tolerance()) {
+            return sfi.path;
+        }
+        return est;
+    }
+};
+
+}  // namespace detray
@@ -14,6 +14,7 @@
 
 // system includes
 #include <climits>
+#include <type_traits>
 
 namespace detray {
 
@@ -89,4 +90,43 @@ struct stepper_default_policy : actor {
     }
 };
 
+/// Navigation update policy that skips the candidate updates while the track
+/// stays inside the safety distance around the position where the safety was
+/// computed (no surface can have been reached there). Otherwise, it behaves
+/// like the @c stepper_default_policy . The safety is computed whenever a step
+/// constraint was hit, since many short steps are expected then.
+struct safety_policy : actor {
+
+    using state = stepper_default_policy::state;
+
+    /// Sets the navigation trust level depending on the safety and the step
+    /// size limit
+    ///
+    /// @param pol_state contains the step size tolerance
+    /// @param propagation state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        state &pol_state, propagator_state_t &propagation) const {
+
+        const auto &stepping = propagation._stepping;
+        auto &navigation = propagation._navigation;
+
+        using nav_scalar_t =
+            typename std::decay_t<decltype(navigation)>::scalar_type;
+
+        // Still inside the safety sphere: keep full trust
+        if (navigation.advance_safety(
+                static_cast<nav_scalar_t>(stepping.step_size()))) {
+            return;
+        }
+
+        stepper_default_policy{}(pol_state, propagation);
+
+        // Step size hit a constraint: get the safety for the next steps
+        if (navigation.trust_level() == navigation::trust_level::e_fair) {
+            navigation.update_safety(stepping());
+        }
+    }
+};
+
 }  // namespace detray
\ No newline at end of file
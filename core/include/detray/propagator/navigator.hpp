@@ -8,22 +8,34 @@
 #pragma once
 
 // Project include(s)
+#include "detray/coordinates/cylindrical2.hpp"
+#include "detray/core/detail/compact_transform_store.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/definitions/containers.hpp"
 #include "detray/definitions/detail/algorithms.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
 #include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/telemetry.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/barcode.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/surface_finders/portal_entry_cache.hpp"
 #include "detray/utils/ranges.hpp"
 
 // vecmem include(s)
 #include <vecmem/containers/data/jagged_vector_buffer.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s)
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 namespace detray {
 
 namespace navigation {
@@ -62,6 +74,82 @@ struct void_inspector {
 
 }  // namespace navigation
 
+namespace detail {
+
+/// Mask store visitor that @returns a conservative (isotropic) distance from
+/// a global position to a surface.
+///
+/// Uses the radial distance for cylinders and the distance to the local
+/// bounding box of the masks otherwise.
+struct safety_distance {
+
+    template <typename mask_group_t, typename mask_range_t,
+              typename transform3_t, typename point3_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const mask_group_t &mask_group,
+                                              const mask_range_t &mask_range,
+                                              const transform3_t &trf,
+                                              const point3_t &glob_pos) const
+        -> typename transform3_t::scalar_type {
+
+        using scalar_t = typename transform3_t::scalar_type;
+        using mask_t = typename mask_group_t::value_type;
+        using frame_t = typename mask_t::local_frame_type;
+        // The placement can be compact: Use the frame's own transform type
+        using cylinder_frame_t =
+            cylindrical2<typename frame_t::transform3_type>;
+
+        const point3_t loc_pos = trf.point_to_local(glob_pos);
+
+        scalar_t dist{std::numeric_limits<scalar_t>::max()};
+        for (const auto &mask :
+             detray::ranges::subrange(mask_group, mask_range)) {
+
+            if constexpr (std::is_same_v<frame_t, cylinder_frame_t>) {
+                const scalar_t rho{
+                    math_ns::sqrt(loc_pos[0] * loc_pos[0] +
+                                  loc_pos[1] * loc_pos[1])};
+                dist = std::min(
+                    dist, math_ns::abs(rho - mask[mask_t::boundaries::e_r]));
+            } else {
+                const auto box = mask.local_min_bounds();
+                scalar_t dist2{0.f};
+                for (unsigned int i = 0u; i < 3u; ++i) {
+                    const scalar_t d{
+                        std::max(std::max(box[i] - loc_pos[i],
+                                          loc_pos[i] - box[i + 3u]),
+                                 scalar_t{0.f})};
+                    dist2 += d * d;
+                }
+                dist = std::min(dist, math_ns::sqrt(dist2));
+            }
+        }
+
+        return dist;
+    }
+};
+
+/// Surface visitor that shrinks the safety distance @param safety to the
+/// distance between the global position @param glob_pos and the surface
+/// @param sf
+struct surface_safety {
+
+    template <typename surface_t, typename mask_store_t,
+              typename transform_store_t, typename point3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const surface_t &sf, const mask_store_t &mask_store,
+        const transform_store_t &transforms, const point3_t &glob_pos,
+        scalar_t &safety) const {
+        safety = std::min(safety,
+                          mask_store.template visit<safety_distance>(
+                              sf.mask(),
+                              detail::placement(transforms, sf.transform()),
+                              glob_pos));
+    }
+};
+
+}  // namespace detail
+
 /// The geometry navigation class.
 ///
 /// The navigator is initialized around a detector object, but is itself
@@ -108,6 +196,10 @@ class navigator {
     using vector_type = typename detector_t::template vector_type<T>;
     using intersection_type = intersection_t;
     using nav_link_type = typename detector_t::surface_type::navigation_link;
+    /// Tracks are intersected with the geometry in the detector precision
+    using ray_type = detail::ray<typename detector_t::transform3>;
+    /// Optional precomputed candidates after a portal crossing
+    using portal_cache_type = portal_entry_cache<detector_t>;
 
     private:
     /// A functor that fills the navigation candidates vector by intersecting
@@ -115,15 +207,18 @@ class navigator {
     struct candidate_search {
 
         /// Test the volume links
-        template <typename track_t>
+        template <typename track_t, typename counter_t>
         DETRAY_HOST_DEVICE void operator()(
             const typename detector_type::surface_type &sf,
             const detector_type &det, const track_t &track,
             vector_type<intersection_type> &candidates,
-            const scalar_type tol) const {
+            const scalar_type tol, counter_t &n_tested) const {
+            // Only what is needed for the mask check: the candidate is
+            // completed once the track reaches it
             det.mask_store().template visit<intersection_initialize>(
-                sf.mask(), candidates, detail::ray(track), sf,
-                det.transform_store(), tol);
+                sf.mask(), candidates, ray_type(track), sf,
+                det.transform_store(), tol, intersection::mode::e_lazy);
+            ++n_tested;
         }
     };
 
@@ -185,6 +280,17 @@ class navigator {
         DETRAY_HOST_DEVICE
         auto detector() const { return _detector; }
 
+        /// @returns a pointer to the portal entry cache (can be null)
+        DETRAY_HOST_DEVICE
+        auto portal_cache() const { return _portal_cache; }
+
+        /// Use the precomputed candidates of @param cache when entering a
+        /// volume through a portal (switched off by passing a nullptr)
+        DETRAY_HOST_DEVICE
+        void set_portal_cache(const portal_cache_type *cache) {
+            _portal_cache = cache;
+        }
+
         /// Scalar representation of the navigation state,
         /// @returns distance to next
         DETRAY_HOST_DEVICE
@@ -265,6 +371,59 @@ class navigator {
             _direction = dir;
         }
 
+        /// @returns the current safety distance (zero if unknown) - const
+        DETRAY_HOST_DEVICE
+        inline auto safety() const -> scalar_type { return _safety; }
+
+        /// Compute the safety distance at the position of @param track : A
+        /// conservative isotropic distance to the nearest surface of the
+        /// current volume.
+        ///
+        /// @note All surfaces of the volume are considered, not only the
+        /// candidates: A bending track can reach surfaces that the straight
+        /// line, from which the candidates were found, misses.
+        template <typename track_t>
+        DETRAY_HOST_DEVICE inline void update_safety(const track_t &track) {
+            _safety_path = 0.f;
+            _safety = 0.f;
+            if (is_exhausted()) {
+                return;
+            }
+
+            _safety = std::numeric_limits<scalar_type>::max();
+            const auto &volume = _detector->volume_by_index(_volume_index);
+            volume.template visit_surfaces<detail::surface_safety>(
+                _detector->mask_store(), _detector->transform_store(),
+                track.pos(), _safety);
+        }
+
+        /// Advance the track by @param step inside the safety sphere.
+        ///
+        /// As long as the accumulated step length stays below the safety, no
+        /// surface can have been reached. The candidates are then moved by
+        /// the step length instead of being intersected again and the state
+        /// keeps its full trust.
+        ///
+        /// @returns false if the safety is exhausted or a cache update has
+        /// been requested already
+        DETRAY_HOST_DEVICE
+        inline bool advance_safety(const scalar_type step) {
+            _safety_path += math_ns::abs(step);
+
+            if (_trust_level != navigation::trust_level::e_full or
+                _safety_path >= _safety) {
+                _safety = 0.f;
+                return false;
+            }
+            for (auto &candidate : *this) {
+                candidate.path -= step;
+            }
+            set_state(navigation::status::e_towards_object,
+                      geometry::barcode{}, navigation::trust_level::e_full);
+
+            return true;
+        }
+
         /// @returns tolerance to determine if we are on object - const
         DETRAY_HOST_DEVICE
         inline auto tolerance() const -> scalar_type {
@@ -425,6 +584,7 @@ class navigator {
         inline void clear() {
             _candidates.clear();
             _next = _candidates.end();
+            _safety = 0.f;
         }
 
         /// Call the navigation inspector
@@ -453,6 +613,18 @@ class navigator {
         /// Detector pointer
         const detector_type *const _detector;
 
+        /// Portal entry cache pointer (optional)
+        const portal_cache_type *_portal_cache{nullptr};
+
+        /// Index of the portal through which the current volume was entered
+        dindex _entry_portal{dindex_invalid};
+
+        /// Safety distance around the position it was computed at
+        scalar_type _safety{0.f};
+
+        /// Step length since the safety was computed
+        scalar_type _safety_path{0.f};
+
         /// Our cache of candidates (intersections with any kind of surface)
         vector_type<intersection_type> _candidates = {};
 
@@ -512,9 +684,24 @@ class navigator {
         detail::call_reserve(navigation.candidates(), 20u);
 
         // Search for neighboring surfaces and fill candidates into cache
-        volume.template visit_neighborhood<candidate_search>(
-            track, *det, track, navigation.candidates(),
-            15.f * unit<scalar_type>::um);
+        // (only the precomputed subset, if the volume was entered through a
+        // cached portal)
+        const ray_type ray(track);
+        // Tracks of the straight line stepper do not bend, whatever their
+        // charge
+        using stepping_t = std::decay_t<decltype(propagation._stepping)>;
+        const scalar_type qop{stepping_t::id == stepping::id::e_linear
+                                  ? 0.f
+                                  : track.qop()};
+        telemetry::counter_t<inspector_t, dindex> n_tested{};
+        if (not cached_candidate_search(ray, qop, navigation, n_tested)) {
+            volume.template visit_neighborhood<candidate_search>(
+                ray, *det, ray, navigation.candidates(),
+                15.f * unit<scalar_type>::um, n_tested);
+        }
+        count_intersections(navigation, n_tested,
+                            navigation.candidates().size(),
+                            navigation.candidates().size(), true);
 
         // Sort all candidates and pick the closest one
         detail::sequential_sort(navigation.candidates().begin(),
@@ -567,6 +754,8 @@ class navigator {
         }
         // Otherwise: did we run into a portal?
         if (navigation.status() == navigation::status::e_on_portal) {
+            // Remember the portal for the initialization of the next volume
+            navigation._entry_portal = navigation.current()->surface.index();
             // Set volume index to the next volume provided by the portal
             navigation.set_volume(navigation.current()->volume_link);
 
@@ -622,7 +811,10 @@ class navigator {
             navigation.n_candidates() == 1) {
 
             // Update next candidate: If not reachable, 'high trust' is broken
-            if (not update_candidate(*navigation.next(), track, det)) {
+            const bool is_reachable{
+                update_candidate(*navigation.next(), track, det)};
+            count_intersections(navigation, 1u, is_reachable ? 1u : 0u, 0u);
+            if (not is_reachable) {
                 navigation.set_state(navigation::status::e_unknown,
                                      geometry::barcode{},
                                      navigation::trust_level::e_no_trust);
@@ -648,7 +840,11 @@ class navigator {
 
             // Else: Track is on module.
             // Ready the next candidate after the current module
-            if (update_candidate(*navigation.next(), track, det)) {
+            const bool is_next_reachable{
+                update_candidate(*navigation.next(), track, det)};
+            count_intersections(navigation, 1u, is_next_reachable ? 1u : 0u,
+                                0u);
+            if (is_next_reachable) {
                 return;
             }
 
@@ -662,6 +858,7 @@ class navigator {
         // - do this when your navigation state is stale, but not invalid
         if (navigation.trust_level() == navigation::trust_level::e_fair) {
 
+            const auto n_tested{navigation.n_candidates()};
             for (auto &candidate : navigation) {
                 // Disregard this candidate if it is not reachable
                 if (not update_candidate(candidate, track, det)) {
@@ -675,6 +872,8 @@ class navigator {
             navigation.set_next(navigation.begin());
             // Ignore unreachable elements (needed to determine exhaustion)
             navigation.set_last(find_invalid(navigation.candidates()));
+            count_intersections(navigation, n_tested,
+                                navigation.n_candidates(), n_tested);
             // Update navigation flow on the new candidate information
             update_navigation_state(track, propagation);
 
@@ -721,6 +920,9 @@ class navigator {
             // called once the cache has been updated to a full trust state).
             // Might lead to exhausted cache.
             ++navigation.next();
+            // Local position and incidence angle on the current surface
+            complete_candidate(*(navigation.next() - 1), track,
+                               navigation.detector());
             // Update state accordingly
             navigation.set_state(
                 navigation.volume() != navigation.current()->volume_link
@@ -741,6 +943,75 @@ class navigator {
         }
     }
 
+    /// Helper method that fills the candidates from the portal entry cache, if
+    /// the current volume was entered through a cached portal.
+    ///
+    /// @param ray the track at the volume entry
+    /// @param qop the charge over momentum of the track (zero, if it does not
+    /// bend)
+    /// @param navigation the navigation state
+    /// @param n_tested counts the tested surfaces
+    ///
+    /// @returns false if the full volume neighborhood has to be searched
+    template <typename counter_t>
+    DETRAY_HOST_DEVICE inline bool cached_candidate_search(
+        const ray_type &ray, const scalar_type qop, state &navigation,
+        counter_t &n_tested) const {
+
+        const dindex portal_idx{navigation._entry_portal};
+        navigation._entry_portal = dindex_invalid;
+
+        // The cache does not cover tracks that bend more strongly
+        const portal_cache_type *cache = navigation.portal_cache();
+        if (cache == nullptr or not cache->covers(portal_idx, qop)) {
+            return false;
+        }
+
+        const auto det = navigation.detector();
+        const auto &sf_lookup = det->surface_lookup();
+        const auto &trf = detail::placement(
+            det->transform_store(), sf_lookup[portal_idx].transform());
+
+        dindex n_listed{0u};
+        for (const dindex sf_idx :
+             cache->search(portal_idx, trf, ray.pos(), ray.dir())) {
+            const auto &sf = sf_lookup[sf_idx];
+            n_listed += sf.is_portal() ? 0u : 1u;
+            candidate_search{}(sf, *det, ray, navigation.candidates(),
+                               15.f * unit<scalar_type>::um, n_tested);
+        }
+
+        // Fall back to the full search if none of the listed sensitive
+        // surfaces is reachable (or if not even a portal was found)
+        const auto &candidates = navigation.candidates();
+        const bool found_sensitive{
+            detail::find_if(candidates.begin(), candidates.end(),
+                            [](const intersection_type &candidate) {
+                                return not candidate.surface.is_portal();
+                            }) != candidates.end()};
+
+        if (candidates.empty() or (n_listed > 0u and not found_sensitive)) {
+            navigation.candidates().clear();
+            return false;
+        }
+        return true;
+    }
+
+    /// Report the number of tested, reachable and sorted candidates to the
+    /// inspector, if it records telemetry (compiles to nothing otherwise)
+    template <typename tested_t, typename accepted_t, typename sorted_t>
+    DETRAY_HOST_DEVICE inline void count_intersections(
+        [[maybe_unused]] state &navigation,
+        [[maybe_unused]] const tested_t n_tested,
+        [[maybe_unused]] const accepted_t n_accepted,
+        [[maybe_unused]] const sorted_t n_sorted,
+        [[maybe_unused]] const bool is_init = false) const {
+        if constexpr (telemetry::is_enabled_v<inspector_t>) {
+            navigation._inspector.count_intersections(
+                navigation, n_tested, n_accepted, n_sorted, is_init);
+        }
+    }
+
     /// Helper method that updates the intersection of a single candidate and
     /// checks reachability
     ///
@@ -762,8 +1033,26 @@ class navigator {
 
         // Check whether this candidate is reachable by the track
         return mask_store.template visit<intersection_update>(
-            candidate.surface.mask(), detail::ray(track), candidate,
-            det->transform_store(), 15.f * unit<scalar_type>::um);
+            candidate.surface.mask(), ray_type(track), candidate,
+            det->transform_store(), 15.f * unit<scalar_type>::um,
+            intersection::mode::e_lazy);
+    }
+
+    /// Helper method that computes the remaining intersection information
+    /// (local position and incidence angle) once a candidate is reached.
+    ///
+    /// @tparam track_t type of the track parametrization
+    ///
+    /// @param candidate the intersection to be completed
+    /// @param track the track information
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void complete_candidate(
+        intersection_type &candidate, const track_t &track,
+        const detector_type *det) const {
+
+        det->mask_store().template visit<intersection_complete>(
+            candidate.surface.mask(), ray_type(track), candidate,
+            det->transform_store());
     }
 
     /// Helper to evict all unreachable/invalid candidates from the cache:
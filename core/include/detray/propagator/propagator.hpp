@@ -11,6 +11,7 @@
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
 #include "detray/propagator/navigator.hpp"
 #include "detray/tracks/tracks.hpp"
 
@@ -107,6 +108,27 @@ struct propagator {
         DETRAY_HOST_DEVICE
         void set_param_type(const parameter_type t) { m_param_type = t; }
 
+        /// Set externally updated bound track parameters @param params on the
+        /// current surface (e.g. after a Kalman update).
+        ///
+        /// The free track parameters are reset accordingly and the next
+        /// navigation candidate is re-evaluated when the propagation resumes.
+        DETRAY_HOST_DEVICE
+        void set_bound_params(const bound_track_parameters_type &params) {
+            const auto *det = _navigation.detector();
+            const auto &surface = det->surface(params.surface_link());
+
+            _stepping._bound_params = params;
+            det->mask_store().template visit<
+                typename parameter_resetter<transform3_type>::kernel>(
+                surface.mask(),
+                _stepping._trf_cache(det->transform_store(),
+                                     surface.transform()),
+                _stepping);
+
+            _navigation.set_high_trust();
+        }
+
         // Is the propagation still alive?
         bool _heartbeat = false;
 
@@ -130,34 +152,118 @@ struct propagator {
                                       actor_states_t &&actor_states = {}) {
 
         // Initialize the navigation
+        begin_stage(propagation, telemetry::stage::e_navigator);
         propagation._heartbeat = _navigator.init(propagation);
 
         // Run all registered actors/aborters after init
+        begin_stage(propagation, telemetry::stage::e_actors);
         run_actors(actor_states, propagation);
 
         // Find next candidate
+        begin_stage(propagation, telemetry::stage::e_navigator);
         propagation._heartbeat &= _navigator.update(propagation);
 
         // Run while there is a heartbeat
         while (propagation._heartbeat) {
 
             // Take the step
+            begin_stage(propagation, telemetry::stage::e_stepper);
             propagation._heartbeat &= _stepper.step(propagation);
 
             // Find next candidate
+            begin_stage(propagation, telemetry::stage::e_navigator);
             propagation._heartbeat &= _navigator.update(propagation);
 
             // Run all registered actors/aborters after update
+            begin_stage(propagation, telemetry::stage::e_actors);
             run_actors(actor_states, propagation);
 
             // And check the status
+            begin_stage(propagation, telemetry::stage::e_navigator);
             propagation._heartbeat &= _navigator.update(propagation);
         }
 
+        end_propagation(propagation);
+
         // Pass on the whether the propagation was successful
         return propagation._navigation.is_complete();
     }
 
+    /// Resumable propagation: Propagates until the next sensitive surface is
+    /// reached and returns control to the caller with the state intact.
+    ///
+    /// The first call initializes the navigation, every following call
+    /// continues from the current surface without re-initializing the
+    /// volume. In between, the bound track parameters can be updated through
+    /// @c state::set_bound_params .
+    ///
+    /// @tparam state_t is the propagation state type
+    /// @tparam actor_state_t is the actor state type
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_states the actor state
+    ///
+    /// @return true if the track is on a sensitive surface and the
+    /// propagation can be resumed, false if the propagation has finished.
+    template <typename state_t, typename actor_states_t = actor_chain<>::state>
+    DETRAY_HOST_DEVICE bool propagate_to_next_sensitive(
+        state_t &propagation, actor_states_t &&actor_states = {}) {
+
+        auto &navigation = propagation._navigation;
+
+        if (not propagation._heartbeat) {
+            // Propagation has already finished
+            if (navigation.status() != navigation::status::e_unknown) {
+                return false;
+            }
+
+            // First call: Initialize the navigation
+            begin_stage(propagation, telemetry::stage::e_navigator);
+            propagation._heartbeat = _navigator.init(propagation);
+
+            begin_stage(propagation, telemetry::stage::e_actors);
+            run_actors(actor_states, propagation);
+
+            begin_stage(propagation, telemetry::stage::e_navigator);
+            propagation._heartbeat &= _navigator.update(propagation);
+        } else {
+            // Resume: Restore the trust in the candidates, in case the track
+            // parameters were updated in the meantime
+            begin_stage(propagation, telemetry::stage::e_navigator);
+            propagation._heartbeat &= _navigator.update(propagation);
+        }
+
+        // Run while there is a heartbeat
+        while (propagation._heartbeat) {
+
+            // Take the step
+            begin_stage(propagation, telemetry::stage::e_stepper);
+            propagation._heartbeat &= _stepper.step(propagation);
+
+            // Find next candidate
+            begin_stage(propagation, telemetry::stage::e_navigator);
+            propagation._heartbeat &= _navigator.update(propagation);
+
+            // Run all registered actors/aborters after update
+            begin_stage(propagation, telemetry::stage::e_actors);
+            run_actors(actor_states, propagation);
+
+            // And check the status
+            begin_stage(propagation, telemetry::stage::e_navigator);
+            propagation._heartbeat &= _navigator.update(propagation);
+
+            // Hand back control on the sensitive surface
+            if (propagation._heartbeat and navigation.is_on_sensitive()) {
+                begin_stage(propagation, telemetry::stage::e_none);
+                return true;
+            }
+        }
+
+        end_propagation(propagation);
+
+        return false;
+    }
+
     /// Propagate method with two while loops. In the CPU, propagate and
     /// propagate_sync() should be equivalent to each other. In the SIMT level
     /// (e.g. GPU), the instruction of threads in the same warp is synchornized
@@ -175,12 +281,15 @@ struct propagator {
                                            actor_states_t &&actor_states = {}) {
 
         // Initialize the navigation
+        begin_stage(propagation, telemetry::stage::e_navigator);
         propagation._heartbeat = _navigator.init(propagation);
 
         // Run all registered actors/aborters after init
+        begin_stage(propagation, telemetry::stage::e_actors);
         run_actors(actor_states, propagation);
 
         // Find next candidate
+        begin_stage(propagation, telemetry::stage::e_navigator);
         propagation._heartbeat &= _navigator.update(propagation);
 
         while (propagation._heartbeat) {
@@ -188,9 +297,11 @@ struct propagator {
             while (propagation._heartbeat) {
 
                 // Take the step
+                begin_stage(propagation, telemetry::stage::e_stepper);
                 propagation._heartbeat &= _stepper.step(propagation);
 
                 // Find next candidate
+                begin_stage(propagation, telemetry::stage::e_navigator);
                 propagation._heartbeat &= _navigator.update(propagation);
 
                 // If the track is on a sensitive surface, break the loop to
@@ -198,25 +309,56 @@ struct propagator {
                 if (propagation._navigation.is_on_sensitive()) {
                     break;
                 } else {
+                    begin_stage(propagation, telemetry::stage::e_actors);
                     run_actors(actor_states, propagation);
 
                     // And check the status
+                    begin_stage(propagation, telemetry::stage::e_navigator);
                     propagation._heartbeat &= _navigator.update(propagation);
                 }
             }
 
             // Synchornized actor
             if (propagation._heartbeat) {
+                begin_stage(propagation, telemetry::stage::e_actors);
                 run_actors(actor_states, propagation);
 
                 // And check the status
+                begin_stage(propagation, telemetry::stage::e_navigator);
                 propagation._heartbeat &= _navigator.update(propagation);
             }
         }
 
+        end_propagation(propagation);
+
         // Pass on the whether the propagation was successful
         return propagation._navigation.is_complete();
     }
+    private:
+    /// Notify a telemetry inspector that the propagation enters the stage
+    /// @param s (compiles to nothing if telemetry is switched off)
+    template <typename state_t>
+    DETRAY_HOST_DEVICE static void begin_stage(
+        [[maybe_unused]] state_t &propagation,
+        [[maybe_unused]] const telemetry::stage s) {
+        if constexpr (telemetry::is_enabled_v<
+                          typename navigator_t::inspector_type>) {
+            propagation._navigation.inspector().begin_stage(
+                s, propagation._navigation);
+        }
+    }
+
+    /// Stop the telemetry timers and hand the counters of the finished track
+    /// to the recorder (compiles to nothing if telemetry is switched off)
+    template <typename state_t>
+    DETRAY_HOST_DEVICE static void end_propagation(
+        [[maybe_unused]] state_t &propagation) {
+        if constexpr (telemetry::is_enabled_v<
+                          typename navigator_t::inspector_type>) {
+            begin_stage(propagation, telemetry::stage::e_none);
+            propagation._navigation.inspector().flush(propagation._stepping);
+        }
+    }
 };
 
 }  // namespace detray
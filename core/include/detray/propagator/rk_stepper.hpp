@@ -8,9 +8,14 @@
 #pragma once
 
 // Project include(s).
+#include "detray/definitions/pdg_particle.hpp"
 #include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/telemetry.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/rkn4.hpp"
 #include "detray/propagator/navigation_policies.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/matrix_helper.hpp"
@@ -22,9 +27,12 @@ namespace detray {
 /// @tparam magnetic_field_t the type of magnetic field
 /// @tparam track_t the type of track that is being advanced by the stepper
 /// @tparam constraint_ the type of constraints on the stepper
+/// @tparam telemetry_t count the RK trials and the field lookups, if this is
+///                     a telemetry type (e.g. @c telemetry::enabled )
 template <typename magnetic_field_t, typename transform3_t,
           typename constraint_t = unconstrained_step,
           typename policy_t = stepper_default_policy,
+          typename telemetry_t = void,
           template <typename, std::size_t> class array_t = darray>
 class rk_stepper final
     : public base_stepper<transform3_t, constraint_t, policy_t> {
@@ -32,6 +40,7 @@ class rk_stepper final
     public:
     using base_type = base_stepper<transform3_t, constraint_t, policy_t>;
     using transform3_type = transform3_t;
+    using scalar_type = typename transform3_type::scalar_type;
     using policy_type = policy_t;
     using point3 = typename transform3_type::point3;
     using vector2 = typename transform3_type::point2;
@@ -61,27 +70,54 @@ class rk_stepper final
             const magnetic_field_t& mag_field, const detector_t& det)
             : base_type::state(bound_params, det), _magnetic_field(mag_field) {}
         /// error tolerance
-        scalar _tolerance{1e-4f};
+        scalar_type _tolerance{1e-4f};
 
         /// step size cutoff value
-        scalar _step_size_cutoff{1e-4f};
+        scalar_type _step_size_cutoff{1e-4f};
 
         /// maximum trial number of RK stepping
         std::size_t _max_rk_step_trials{10000u};
 
+        /// Transport the jacobian and the volume material noise along with
+        /// the track parameters (parameters only, if false)
+        bool _transport_covariance{true};
+
+        /// Whether the work of the stepper is counted
+        static constexpr bool has_telemetry{
+            telemetry::is_enabled_v<telemetry_t>};
+
+        /// total number of RK trials (including the accepted ones)
+        telemetry::counter_t<telemetry_t, std::size_t> _n_rk_trials{};
+
+        /// total number of magnetic field lookups
+        telemetry::counter_t<telemetry_t, std::size_t> _n_field_lookups{};
+
         /// stepping data required for RKN4
         struct {
             vector3 b_first, b_middle, b_last;
             vector3 k1, k2, k3, k4;
-            array_t<scalar, 4> k_qop;
+            array_t<scalar_type, 4> k_qop;
+            /// Noise of the last step in volume material: variance of the
+            /// projected scattering angle and of q/p
+            scalar_type var_theta{0.f}, var_qop{0.f};
         } _step_data;
 
         /// Magnetic field view
         const magnetic_field_t _magnetic_field;
 
+        /// Volume material the track currently traverses (vacuum if null).
+        /// The material is given in the precision of the track, see the
+        /// @c volume_material_updater
+        const detray::material<scalar_type>* _mat{nullptr};
+
+        /// Particle hypothesis for the interaction with the volume material
+        /// (muon by default)
+        int _pdg{pdg_particle::eMuon};
+        scalar_type _mass{105.7f * unit<scalar_type>::MeV};
+
         /// Set the local error tolerenace
         DETRAY_HOST_DEVICE
-        inline void set_tolerance(scalar tol) { _tolerance = tol; };
+        inline void set_tolerance(scalar_type tol) { _tolerance = tol; };
 
         /// Update the track state by Runge-Kutta-Nystrom integration.
         DETRAY_HOST_DEVICE
@@ -91,10 +127,20 @@ class rk_stepper final
         DETRAY_HOST_DEVICE
         inline void advance_jacobian();
 
+        /// @returns the magnetic field at @param pos . The field is looked
+        /// up in its own precision
+        DETRAY_HOST_DEVICE
+        inline vector3 field_at(const point3& pos);
+
         /// evaulate k_n for runge kutta stepping
         DETRAY_HOST_DEVICE
         inline vector3 evaluate_k(const vector3& b_field, const int i,
-                                  const scalar h, const vector3& k_prev);
+                                  const scalar_type h, const vector3& k_prev);
+
+        /// @returns the change of q/p per unit path length due to the
+        /// energy loss in the volume material
+        DETRAY_HOST_DEVICE
+        inline scalar_type dqopds(const scalar_type qop) const;
 
         DETRAY_HOST_DEVICE
         inline vector3 dtds() const { return this->_step_data.k4; }
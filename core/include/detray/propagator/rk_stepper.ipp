@@ -6,28 +6,67 @@
  */
 
 // System include(s)
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 template <typename magnetic_field_t, typename transform3_t,
-          typename constraint_t, typename policy_t,
+          typename constraint_t, typename policy_t, typename telemetry_t,
           template <typename, std::size_t> class array_t>
 void detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
-                        array_t>::state::advance_track() {
+                        telemetry_t, array_t>::state::advance_track() {
 
-    const auto& sd = this->_step_data;
-    const scalar h{this->_step_size};
-    const scalar h_6{h * static_cast<scalar>(1. / 6.)};
+    auto& sd = this->_step_data;
+    const scalar_type h{this->_step_size};
+    const scalar_type h_6{h * static_cast<scalar_type>(1. / 6.)};
     auto& track = this->_track;
-    auto pos = track.pos();
-    auto dir = track.dir();
+    const vector3 pos = track.pos();
+    const vector3 dir = track.dir();
 
     // Update the track parameters according to the equations of motion
-    pos = pos + h * (dir + h_6 * (sd.k1 + sd.k2 + sd.k3));
-    track.set_pos(pos);
-
-    dir = dir + h_6 * (sd.k1 + 2.f * (sd.k2 + sd.k3) + sd.k4);
-    dir = vector::normalize(dir);
-    track.set_dir(dir);
+    track.set_pos(detail::rkn4::advance_pos(pos, dir, sd.k1, sd.k2, sd.k3, h));
+    track.set_dir(vector::normalize(
+        detail::rkn4::advance_dir(dir, sd.k1, sd.k2, sd.k3, sd.k4, h)));
+
+    // Continuous energy loss and scattering in the volume material
+    sd.var_theta = 0.f;
+    sd.var_qop = 0.f;
+    if (this->_mat != nullptr) {
+        const scalar_type qop{track.qop()};
+        const scalar_type q{track.charge()};
+        const interaction<scalar_type> I{};
+
+        track.set_qop(track.qop() +
+                      h_6 * (sd.k_qop[0] + 2.f * (sd.k_qop[1] + sd.k_qop[2]) +
+                             sd.k_qop[3]));
+
+        // Neither the Highland scattering angle nor the Landau width are
+        // additive in the path length: The noise of the step is the increase
+        // of their variance with the total path in material since the last
+        // surface (given as the equivalent path in the current material)
+        const scalar_type X0{this->_mat->X0()};
+        const scalar_type path_before{this->_path_in_X0 * X0};
+        this->_path_in_X0 += std::abs(h) / X0;
+        const scalar_type path_after{this->_path_in_X0 * X0};
+
+        const auto var_theta = [&](const scalar_type path) {
+            const scalar_type theta0{I.compute_multiple_scattering_theta0(
+                path, *(this->_mat), this->_pdg, this->_mass, qop, q)};
+            return theta0 * theta0;
+        };
+        const auto var_qop = [&](const scalar_type path) {
+            const scalar_type sigma_qop{
+                I.compute_energy_loss_landau_sigma_QOverP(
+                    path, *(this->_mat), this->_pdg, this->_mass, qop, q)};
+            return sigma_qop * sigma_qop;
+        };
+
+        sd.var_theta = std::max(var_theta(path_after) - var_theta(path_before),
+                                scalar_type{0.f});
+        sd.var_qop = std::max(var_qop(path_after) - var_qop(path_before),
+                              scalar_type{0.f});
+    }
 
     // Update path length
     this->_path_length += h;
@@ -35,10 +74,10 @@ void detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
 }
 
 template <typename magnetic_field_t, typename transform3_t,
-          typename constraint_t, typename policy_t,
+          typename constraint_t, typename policy_t, typename telemetry_t,
           template <typename, std::size_t> class array_t>
 void detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
-                        array_t>::state::advance_jacobian() {
+                        telemetry_t, array_t>::state::advance_jacobian() {
     /// The calculations are based on ATL-SOFT-PUB-2009-002. The update of the
     /// Jacobian matrix is requires only the calculation of eq. 17 and 18.
     /// Since the terms of eq. 18 are currently 0, this matrix is not needed
@@ -59,15 +98,15 @@ void detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
     /// missing Lambda part) and only exists for dFdu' in dlambda/dlambda.
 
     const auto& sd = this->_step_data;
-    const scalar h{this->_step_size};
+    const scalar_type h{this->_step_size};
     // const auto& mass = this->_mass;
     auto& track = this->_track;
     const auto dir = track.dir();
     const auto qop = track.qop();
 
     // Half step length
-    const scalar half_h{h * 0.5f};
-    const scalar h_6{h * static_cast<scalar>(1. / 6.)};
+    const scalar_type half_h{h * 0.5f};
+    const scalar_type h_6{h * static_cast<scalar_type>(1. / 6.)};
     /*---------------------------------------------------------------------------
      * k_{n} is always in the form of [ A(T) X B ] where A is a function of r'
      * and B is magnetic field and X symbol is for cross product. Hence dk{n}dT
@@ -123,6 +162,21 @@ void detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
     matrix_operator().set_block(D, dGdT, 4u, 4u);
     matrix_operator().set_block(D, dGdL, 4u, 7u);
 
+    // Energy loss in the volume material: d(qop_n+1)/d(qop_n). Neglects the
+    // momentum dependence of the stopping power itself, so that
+    // d/dqop (qop³ * E) = (3 - beta²) * qop² * E
+    if (this->_mat != nullptr) {
+        const scalar_type p{track.charge() / qop};
+        const scalar_type m{this->_mass};
+        const scalar_type beta2{p * p / (p * p + m * m)};
+        const scalar_type dqop{
+            h_6 * (sd.k_qop[0] + 2.f * (sd.k_qop[1] + sd.k_qop[2]) +
+                   sd.k_qop[3])};
+
+        matrix_operator().element(D, e_free_qoverp, e_free_qoverp) =
+            1.f + dqop * (3.f - beta2) / qop;
+    }
+
     /// Calculate (4,4) element of equation (17)
     /// NOTE: Let's skip this element for the moment
     /// const auto p = getter::norm(track.mom());
@@ -130,91 +184,177 @@ void detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
     /// h * mass * mass * qop * getter::perp(vector2{1, mass / p});
 
     this->_jac_transport = D * this->_jac_transport;
+
+    // Transport the noise from the volume material to the end of the step
+    // and add the noise of the step: The scattering deflects the direction
+    // in the two planes perpendicular to the track and, on average, displaces
+    // the position by h/2 times the deflection over the step
+    if (this->_path_in_X0 > 0.f) {
+        auto& noise = this->_mat_noise;
+        noise = D * noise * matrix_operator().transpose(D);
+
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                // Projection onto the plane perpendicular to the track
+                const scalar_type var{
+                    sd.var_theta * ((i == j ? 1.f : 0.f) - dir[i] * dir[j])};
+
+                matrix_operator().element(noise, e_free_pos0 + i,
+                                          e_free_pos0 + j) +=
+                    h * h * var / 3.f;
+                matrix_operator().element(noise, e_free_pos0 + i,
+                                          e_free_dir0 + j) += half_h * var;
+                matrix_operator().element(noise, e_free_dir0 + i,
+                                          e_free_pos0 + j) += half_h * var;
+                matrix_operator().element(noise, e_free_dir0 + i,
+                                          e_free_dir0 + j) += var;
+            }
+        }
+        matrix_operator().element(noise, e_free_qoverp, e_free_qoverp) +=
+            sd.var_qop;
+    }
 }
 
 template <typename magnetic_field_t, typename transform3_t,
-          typename constraint_t, typename policy_t,
+          typename constraint_t, typename policy_t, typename telemetry_t,
           template <typename, std::size_t> class array_t>
 auto detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
-                        array_t>::state::evaluate_k(const vector3& b_field,
-                                                    const int i, const scalar h,
-                                                    const vector3& k_prev)
+                        telemetry_t,
+                        array_t>::state::field_at(const point3& pos)
     -> vector3 {
+
+    using field_scalar_t = std::decay_t<decltype(
+        std::declval<typename magnetic_field_t::output_t>()[0])>;
+
+    const typename magnetic_field_t::output_t bvec =
+        _magnetic_field.at(static_cast<field_scalar_t>(pos[0]),
+                           static_cast<field_scalar_t>(pos[1]),
+                           static_cast<field_scalar_t>(pos[2]));
+    if constexpr (telemetry::is_enabled_v<telemetry_t>) {
+        ++_n_field_lookups;
+    }
+
+    return {static_cast<scalar_type>(bvec[0]),
+            static_cast<scalar_type>(bvec[1]),
+            static_cast<scalar_type>(bvec[2])};
+}
+
+template <typename magnetic_field_t, typename transform3_t,
+          typename constraint_t, typename policy_t, typename telemetry_t,
+          template <typename, std::size_t> class array_t>
+auto detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
+                        telemetry_t, array_t>::state::
+    evaluate_k(const vector3& b_field, const int i, const scalar_type h,
+               const vector3& k_prev) -> vector3 {
     auto& track = this->_track;
+    auto& sd = this->_step_data;
 
-    const auto qop = track.qop();
-    const auto dir = track.dir();
+    const vector3 dir = track.dir();
 
-    vector3 k_new;
+    // q/p at the current Runge-Kutta point (changes in volume material)
+    scalar_type qop{track.qop()};
+    if (this->_mat != nullptr) {
+        if (i > 0) {
+            qop += h * sd.k_qop[static_cast<std::size_t>(i - 1)];
+        }
+        sd.k_qop[static_cast<std::size_t>(i)] = dqopds(qop);
+    }
 
     if (i == 0) {
-        k_new = qop * vector::cross(dir, b_field);
-    } else {
-        k_new = qop * vector::cross(dir + h * k_prev, b_field);
+        return detail::rkn4::first_stage(qop, dir, b_field);
+    }
+    return detail::rkn4::next_stage(qop, dir, b_field, k_prev, h);
+}
+
+template <typename magnetic_field_t, typename transform3_t,
+          typename constraint_t, typename policy_t, typename telemetry_t,
+          template <typename, std::size_t> class array_t>
+auto detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
+                        telemetry_t,
+                        array_t>::state::dqopds(const scalar_type qop) const
+    -> scalar_type {
+
+    // No energy loss in vacuum
+    if (this->_mat == nullptr) {
+        return 0.f;
     }
 
-    return k_new;
+    const scalar_type q{this->_track.charge()};
+    const scalar_type p{q / qop};
+    const scalar_type E{std::sqrt(p * p + this->_mass * this->_mass)};
+
+    // Mean energy loss per unit path length (linear stopping power)
+    const scalar_type stopping_power{
+        interaction<scalar_type>().compute_energy_loss_bethe(
+            unit<scalar_type>::mm, *(this->_mat), this->_pdg, this->_mass,
+            qop, q) /
+        unit<scalar_type>::mm};
+
+    // dE/ds = -|dE/dx|, dp/ds = E/p * dE/ds and d(q/p)/ds = -q/p² * dp/ds
+    return qop * qop * qop * E * stopping_power / (q * q);
 }
 
 template <typename magnetic_field_t, typename transform3_t,
-          typename constraint_t, typename policy_t,
+          typename constraint_t, typename policy_t, typename telemetry_t,
           template <typename, std::size_t> class array_t>
 template <typename propagation_state_t>
 bool detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
+                        telemetry_t,
                         array_t>::step(propagation_state_t& propagation) {
 
     // Get stepper and navigator states
     state& stepping = propagation._stepping;
-    auto& magnetic_field = stepping._magnetic_field;
     auto& navigation = propagation._navigation;
 
     auto& sd = stepping._step_data;
 
-    scalar error_estimate{0.f};
+    scalar_type error_estimate{0.f};
 
     // First Runge-Kutta point
-    const vector3 spos = stepping().pos();
-    const typename magnetic_field_t::output_t bvec =
-        magnetic_field.at(spos[0], spos[1], spos[2]);
-    sd.b_first[0] = bvec[0];
-    sd.b_first[1] = bvec[1];
-    sd.b_first[2] = bvec[2];
+    sd.b_first = stepping.field_at(stepping().pos());
 
     sd.k1 = stepping.evaluate_k(sd.b_first, 0, 0.f, vector3{0.f, 0.f, 0.f});
 
-    const auto try_rk4 = [&](const scalar& h) -> bool {
-        // State the square and half of the step size
-        const scalar h2{h * h};
-        const scalar half_h{h * 0.5f};
-        auto pos = stepping().pos();
-        auto dir = stepping().dir();
+    // Predict the largest step size that passes the error estimate from the
+    // local curvature of the track: In a homogeneous field, the leading term
+    // of the estimate is h^4 * |qop * B|^2 * |k1| / 4 (opt-in)
+    if constexpr (constraint_t::predict_curvature) {
+        const scalar_type qop_b{stepping().qop() * getter::norm(sd.b_first)};
+        const scalar_type err_coeff{0.25f * qop_b * qop_b *
+                                    getter::norm(sd.k1)};
+
+        stepping.template release_step<step::constraint::e_curvature>();
+        if (err_coeff > 0.f) {
+            stepping.template set_constraint<step::constraint::e_curvature>(
+                0.9f * std::sqrt(std::sqrt(stepping._tolerance / err_coeff)));
+        }
+    }
+
+    const auto try_rk4 = [&](const scalar_type& h) -> bool {
+        // State the half of the step size
+        const scalar_type half_h{h * 0.5f};
+        const vector3 pos = stepping().pos();
+        const vector3 dir = stepping().dir();
 
         // Second Runge-Kutta point
-        const vector3 pos1 = pos + half_h * dir + h2 * 0.125f * sd.k1;
-        const typename magnetic_field_t::output_t bvec1 =
-            magnetic_field.at(pos1[0], pos1[1], pos1[2]);
-        sd.b_middle[0] = bvec1[0];
-        sd.b_middle[1] = bvec1[1];
-        sd.b_middle[2] = bvec1[2];
+        const vector3 pos1 = detail::rkn4::middle_point(pos, dir, sd.k1, h);
+        sd.b_middle = stepping.field_at(pos1);
         sd.k2 = stepping.evaluate_k(sd.b_middle, 1, half_h, sd.k1);
 
         // Third Runge-Kutta point
         sd.k3 = stepping.evaluate_k(sd.b_middle, 2, half_h, sd.k2);
 
         // Last Runge-Kutta point
-        const vector3 pos2 = pos + h * dir + h2 * 0.5f * sd.k3;
-        const typename magnetic_field_t::output_t bvec2 =
-            magnetic_field.at(pos2[0], pos2[1], pos2[2]);
-        sd.b_last[0] = bvec2[0];
-        sd.b_last[1] = bvec2[1];
-        sd.b_last[2] = bvec2[2];
+        const vector3 pos2 = detail::rkn4::last_point(pos, dir, sd.k3, h);
+        sd.b_last = stepping.field_at(pos2);
         sd.k4 = stepping.evaluate_k(sd.b_last, 3, h, sd.k3);
 
         // Compute and check the local integration error estimate
         // @Todo
-        const vector3 err_vec = h2 * (sd.k1 - sd.k2 - sd.k3 + sd.k4);
+        const vector3 err_vec =
+            detail::rkn4::error(sd.k1, sd.k2, sd.k3, sd.k4, h);
         error_estimate =
-            std::max(getter::norm(err_vec), static_cast<scalar>(1e-20));
+            std::max(getter::norm(err_vec), static_cast<scalar_type>(1e-20));
 
         return (error_estimate <= stepping._tolerance);
     };
@@ -222,17 +362,23 @@ bool detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
     // Initial step size estimate
     stepping.set_step_size(navigation());
 
-    scalar step_size_scaling{1.f};
+    // Don't start with a step size that is predicted to fail
+    const scalar_type curv_step{
+        stepping.constraints()
+            .template size<step::constraint::e_curvature>()};
+    if (std::abs(stepping._step_size) > curv_step) {
+        stepping.set_step_size(stepping._step_size < 0.f ? -curv_step
+                                                         : curv_step);
+    }
+
+    scalar_type step_size_scaling{1.f};
     std::size_t n_step_trials{0u};
 
     // Adjust initial step size to integration error
     while (!try_rk4(stepping._step_size)) {
 
-        step_size_scaling = std::min(
-            std::max(0.25f * unit<scalar>::mm,
-                     std::sqrt(std::sqrt((stepping._tolerance /
-                                          std::abs(2.f * error_estimate))))),
-            static_cast<scalar>(4));
+        step_size_scaling = detail::rkn4::step_size_scaling(
+            stepping._tolerance, error_estimate);
 
         stepping._step_size *= step_size_scaling;
 
@@ -252,6 +398,9 @@ bool detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
         }
         n_step_trials++;
     }
+    if constexpr (telemetry::is_enabled_v<telemetry_t>) {
+        stepping._n_rk_trials += n_step_trials + 1u;
+    }
 
     // Update navigation direction
     const step::direction step_dir = stepping._step_size >= 0.f
@@ -271,7 +420,9 @@ bool detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
     stepping.advance_track();
 
     // Advance jacobian transport
-    stepping.advance_jacobian();
+    if (stepping._transport_covariance) {
+        stepping.advance_jacobian();
+    }
 
     // Call navigation update policy
     policy_t{}(stepping.policy_state(), propagation);
@@ -0,0 +1,209 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/propagator/detail/rkn4.hpp"
+#include "detray/propagator/detail/simd_lanes.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+
+namespace detray {
+
+/// Runge-Kutta-Nystrom 4th order stepper that advances a pack of tracks in
+/// lockstep.
+///
+/// The track state is kept in SoA layout, one array of @tparam N lanes per
+/// component. The stages of the integration are the same as in the scalar
+/// @c rk_stepper (see @c detail::rkn4 ), evaluated on @c detail::simd_lanes ,
+/// so that every operation is a loop over the lanes. This way, the compiler
+/// maps one component of the whole pack onto a SIMD register, independent of
+/// the algebra plugin (which only vectorizes within a single 3-vector). The
+/// field lookups are done lane by lane.
+///
+/// The lanes can diverge: Every lane carries its own step size and path
+/// limit (e.g. the distance to its next surface). A lane is masked out as
+/// soon as it has reached its path limit or the step size control gave up
+/// on it. Finished lanes are refilled with pending tracks during
+/// @c propagate (repacking), so that the pack stays populated.
+///
+/// @note The pack transports the track parameters forward in vacuum. It does
+/// not navigate: The path limit of a lane has to be given by the caller, e.g.
+/// as the distance to the next surface of the track, and the lane stops
+/// there. Finding the next surface, the covariance transport and the
+/// material interaction remain with the scalar @c rk_stepper .
+///
+/// @tparam magnetic_field_t the type of magnetic field
+/// @tparam transform3_t the algebra type of the tracks
+/// @tparam N the number of tracks per pack (e.g. 4, 8 or 16)
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t = darray>
+class rk_stepper_pack {
+
+    public:
+    using transform3_type = transform3_t;
+    using scalar_type = typename transform3_type::scalar_type;
+    using vector3 = typename transform3_type::vector3;
+    using free_track_parameters_type = free_track_parameters<transform3_t>;
+
+    /// Number of lanes
+    static constexpr std::size_t width{N};
+
+    /// One value per lane
+    template <typename T>
+    using lanes = array_t<T, N>;
+    /// Scalar per lane with lane-wise arithmetic
+    using scalar_lanes = detail::simd_lanes<scalar_type, N, array_t>;
+    /// 3D vector per lane in SoA layout
+    using lane_vector3 = detail::simd_vector3<scalar_type, N, array_t>;
+
+    DETRAY_HOST_DEVICE
+    rk_stepper_pack() {}
+
+    struct state {
+
+        DETRAY_HOST_DEVICE
+        explicit state(const magnetic_field_t& mag_field)
+            : _magnetic_field(mag_field) {
+            for (std::size_t i = 0u; i < N; ++i) {
+                _track_idx[i] = dindex_invalid;
+                _alive[i] = false;
+                _aborted[i] = false;
+            }
+        }
+
+        /// error tolerance
+        scalar_type _tolerance{1e-4f};
+
+        /// step size cutoff value
+        scalar_type _step_size_cutoff{1e-4f};
+
+        /// maximum trial number of RK stepping per step
+        std::size_t _max_rk_step_trials{10000u};
+
+        /// total number of RK trials of all lanes (including accepted ones)
+        std::size_t _n_rk_trials{0u};
+
+        /// SoA track state
+        lane_vector3 _pos{};
+        lane_vector3 _dir{};
+        scalar_lanes _qop{};
+
+        /// Step size of the next step per lane
+        scalar_lanes _step_size{};
+        /// Path length that was travelled per lane
+        scalar_lanes _path_length{};
+        /// Path length after which a lane is finished
+        scalar_lanes _path_limit{};
+
+        /// Lane mask: tracks that are still being propagated
+        lanes<bool> _alive{};
+        /// Tracks for which the step size control failed
+        lanes<bool> _aborted{};
+        /// Position of the track of a lane in the input collection
+        lanes<dindex> _track_idx{};
+
+        /// stepping data required for RKN4
+        struct {
+            lane_vector3 b_first, b_middle, b_last;
+            lane_vector3 k1, k2, k3, k4;
+        } _step_data;
+
+        /// Magnetic field view
+        const magnetic_field_t _magnetic_field;
+
+        /// Set the local error tolerenace
+        DETRAY_HOST_DEVICE
+        inline void set_tolerance(scalar_type tol) { _tolerance = tol; };
+
+        /// Load the track @param track into lane @param i and let it travel
+        /// the path length @param path_limit
+        DETRAY_HOST_DEVICE
+        inline void load(const std::size_t i,
+                         const free_track_parameters_type& track,
+                         const scalar_type path_limit,
+                         const dindex track_idx = dindex_invalid);
+
+        /// Write the track state of lane @param i back into @param track
+        DETRAY_HOST_DEVICE
+        inline void unload(const std::size_t i,
+                           free_track_parameters_type& track) const;
+
+        /// @returns true if any lane still needs to be propagated
+        DETRAY_HOST_DEVICE
+        inline bool any_alive() const;
+
+        /// Update the track state of the lanes in @param mask by
+        /// Runge-Kutta-Nystrom integration with the step sizes @param h
+        DETRAY_HOST_DEVICE
+        inline void advance_track(const scalar_lanes& h,
+                                  const lanes<bool>& mask);
+
+        /// Look up the magnetic field @param b_field at the positions
+        /// @param pos of the lanes in @param mask
+        DETRAY_HOST_DEVICE
+        inline void field_at(const lane_vector3& pos, lane_vector3& b_field,
+                             const lanes<bool>& mask) const;
+    };
+
+    /// Take a step in all alive lanes, using an adaptive Runge-Kutta
+    /// algorithm per lane.
+    ///
+    /// @return returning the heartbeat, indicating if any lane is alive
+    DETRAY_HOST_DEVICE bool step(state& stepping) const;
+
+    /// Propagate all tracks in @param tracks over the path length
+    /// @param path_limit . Finished lanes are written back and refilled with
+    /// pending tracks every @param repack_interval steps.
+    ///
+    /// @returns the number of tracks that reached their path limit
+    template <typename track_container_t>
+    DETRAY_HOST std::size_t propagate(
+        state& stepping, track_container_t& tracks,
+        const scalar_type path_limit,
+        const std::size_t repack_interval = 1u) const;
+
+    /// Propagate every track in @param tracks over its own path length in
+    /// @param path_limits (e.g. the distance to its next surface).
+    ///
+    /// @returns the number of tracks that reached their path limit
+    template <typename track_container_t, typename limit_container_t,
+              typename std::enable_if_t<
+                  not std::is_arithmetic_v<limit_container_t>, bool> = true>
+    DETRAY_HOST std::size_t propagate(
+        state& stepping, track_container_t& tracks,
+        const limit_container_t& path_limits,
+        const std::size_t repack_interval = 1u) const;
+
+    private:
+    /// Write finished lanes back to @param tracks and refill them from
+    /// position @param next onwards, with the path limits given by
+    /// @param path_limit for the position of the track
+    template <typename track_container_t, typename path_limit_fn_t>
+    DETRAY_HOST void repack(state& stepping, track_container_t& tracks,
+                            std::size_t& next,
+                            const path_limit_fn_t& path_limit,
+                            std::size_t& n_success) const;
+
+    /// Propagate with the path limits given by @param path_limit
+    template <typename track_container_t, typename path_limit_fn_t>
+    DETRAY_HOST std::size_t propagate_impl(
+        state& stepping, track_container_t& tracks,
+        const path_limit_fn_t& path_limit,
+        const std::size_t repack_interval) const;
+};
+
+}  // namespace detray
+
+#include "detray/propagator/rk_stepper_pack.ipp"
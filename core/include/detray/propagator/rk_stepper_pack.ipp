@@ -0,0 +1,313 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+void detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::
+    state::load(const std::size_t i, const free_track_parameters_type& track,
+                const scalar_type path_limit, const dindex track_idx) {
+    const vector3 pos = track.pos();
+    const vector3 dir = track.dir();
+    for (unsigned int c = 0u; c < 3u; ++c) {
+        _pos[c][i] = pos[c];
+        _dir[c][i] = dir[c];
+    }
+    _qop[i] = track.qop();
+
+    // Start with a step size that covers the whole path
+    _step_size[i] = path_limit;
+    _path_length[i] = 0.f;
+    _path_limit[i] = path_limit;
+
+    _alive[i] = true;
+    _aborted[i] = false;
+    _track_idx[i] = track_idx;
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+void detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::
+    state::unload(const std::size_t i,
+                  free_track_parameters_type& track) const {
+    track.set_pos(vector3{_pos[0][i], _pos[1][i], _pos[2][i]});
+    track.set_dir(vector3{_dir[0][i], _dir[1][i], _dir[2][i]});
+    track.set_qop(_qop[i]);
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+bool detray::rk_stepper_pack<magnetic_field_t, transform3_t, N,
+                             array_t>::state::any_alive() const {
+    bool alive{false};
+    for (std::size_t i = 0u; i < N; ++i) {
+        alive |= _alive[i];
+    }
+    return alive;
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+void detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::
+    state::advance_track(const scalar_lanes& h, const lanes<bool>& mask) {
+
+    const auto& sd = this->_step_data;
+
+    // Update the track parameters according to the equations of motion
+    const lane_vector3 pos =
+        detail::rkn4::advance_pos(_pos, _dir, sd.k1, sd.k2, sd.k3, h);
+    const lane_vector3 dir =
+        detail::rkn4::advance_dir(_dir, sd.k1, sd.k2, sd.k3, sd.k4, h);
+
+    for (std::size_t i = 0u; i < N; ++i) {
+        const scalar_type norm{std::sqrt(dir[0][i] * dir[0][i] +
+                                         dir[1][i] * dir[1][i] +
+                                         dir[2][i] * dir[2][i])};
+        for (unsigned int c = 0u; c < 3u; ++c) {
+            _pos[c][i] = mask[i] ? pos[c][i] : _pos[c][i];
+            _dir[c][i] = mask[i] ? dir[c][i] / norm : _dir[c][i];
+        }
+
+        // Update path length
+        _path_length[i] += mask[i] ? h[i] : 0.f;
+    }
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+void detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::
+    state::field_at(const lane_vector3& pos, lane_vector3& b_field,
+                    const lanes<bool>& mask) const {
+
+    for (std::size_t i = 0u; i < N; ++i) {
+        // Masked lanes might be outside of the field map
+        if (not mask[i]) {
+            b_field[0][i] = b_field[1][i] = b_field[2][i] = 0.f;
+            continue;
+        }
+        const typename magnetic_field_t::output_t bvec =
+            _magnetic_field.at(static_cast<scalar>(pos[0][i]),
+                               static_cast<scalar>(pos[1][i]),
+                               static_cast<scalar>(pos[2][i]));
+        b_field[0][i] = bvec[0];
+        b_field[1][i] = bvec[1];
+        b_field[2][i] = bvec[2];
+    }
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+bool detray::rk_stepper_pack<magnetic_field_t, transform3_t, N,
+                             array_t>::step(state& stepping) const {
+
+    auto& sd = stepping._step_data;
+
+    // Lanes that still have to find an acceptable step size
+    lanes<bool> pending{stepping._alive};
+    // Lanes that accepted their step in the current trial
+    lanes<bool> accepted{};
+    lanes<std::size_t> n_step_trials{};
+
+    scalar_lanes h{};
+    lanes<scalar_type> error_estimate{};
+
+    // First Runge-Kutta point
+    stepping.field_at(stepping._pos, sd.b_first, pending);
+    sd.k1 =
+        detail::rkn4::first_stage(stepping._qop, stepping._dir, sd.b_first);
+
+    // Initial step size: Don't step beyond the path limit
+    for (std::size_t i = 0u; i < N; ++i) {
+        h[i] = std::min(stepping._step_size[i],
+                        stepping._path_limit[i] - stepping._path_length[i]);
+    }
+
+    bool any_pending{stepping.any_alive()};
+
+    while (any_pending) {
+
+        const scalar_lanes half_h{h * 0.5f};
+
+        // Second Runge-Kutta point
+        const lane_vector3 pos1 = detail::rkn4::middle_point(
+            stepping._pos, stepping._dir, sd.k1, h);
+        stepping.field_at(pos1, sd.b_middle, pending);
+        sd.k2 = detail::rkn4::next_stage(stepping._qop, stepping._dir,
+                                         sd.b_middle, sd.k1, half_h);
+
+        // Third Runge-Kutta point
+        sd.k3 = detail::rkn4::next_stage(stepping._qop, stepping._dir,
+                                         sd.b_middle, sd.k2, half_h);
+
+        // Last Runge-Kutta point
+        const lane_vector3 pos2 =
+            detail::rkn4::last_point(stepping._pos, stepping._dir, sd.k3, h);
+        stepping.field_at(pos2, sd.b_last, pending);
+        sd.k4 = detail::rkn4::next_stage(stepping._qop, stepping._dir,
+                                         sd.b_last, sd.k3, h);
+
+        // Compute and check the local integration error estimate
+        const lane_vector3 err_vec =
+            detail::rkn4::error(sd.k1, sd.k2, sd.k3, sd.k4, h);
+        for (std::size_t i = 0u; i < N; ++i) {
+            error_estimate[i] = std::max(
+                std::sqrt(err_vec[0][i] * err_vec[0][i] +
+                          err_vec[1][i] * err_vec[1][i] +
+                          err_vec[2][i] * err_vec[2][i]),
+                static_cast<scalar_type>(1e-20));
+
+            accepted[i] =
+                pending[i] and (error_estimate[i] <= stepping._tolerance);
+        }
+
+        // Advance the lanes that found their step size
+        stepping.advance_track(h, accepted);
+
+        // Adjust the step sizes to the integration error
+        any_pending = false;
+        for (std::size_t i = 0u; i < N; ++i) {
+            if (not pending[i]) {
+                continue;
+            }
+            ++n_step_trials[i];
+
+            const scalar_type step_size_scaling{
+                detail::rkn4::step_size_scaling(stepping._tolerance,
+                                                error_estimate[i])};
+
+            if (accepted[i]) {
+                pending[i] = false;
+                // Step size estimate for the next step
+                stepping._step_size[i] = h[i] * step_size_scaling;
+
+                // The lane has reached its target
+                if (stepping._path_limit[i] - stepping._path_length[i] <
+                    stepping._step_size_cutoff) {
+                    stepping._alive[i] = false;
+                }
+                continue;
+            }
+
+            h[i] *= step_size_scaling;
+
+            // If step size becomes too small or there are too many trials,
+            // the track is not moving: abort the lane
+            if (std::abs(h[i]) < std::abs(stepping._step_size_cutoff) or
+                n_step_trials[i] > stepping._max_rk_step_trials) {
+                pending[i] = false;
+                stepping._alive[i] = false;
+                stepping._aborted[i] = true;
+                continue;
+            }
+            any_pending = true;
+        }
+    }
+
+    for (std::size_t i = 0u; i < N; ++i) {
+        stepping._n_rk_trials += n_step_trials[i];
+    }
+
+    return stepping.any_alive();
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+template <typename track_container_t>
+std::size_t
+detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::propagate(
+    state& stepping, track_container_t& tracks, const scalar_type path_limit,
+    const std::size_t repack_interval) const {
+
+    return propagate_impl(
+        stepping, tracks,
+        [path_limit](const std::size_t /*trk_idx*/) { return path_limit; },
+        repack_interval);
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+template <typename track_container_t, typename limit_container_t,
+          typename std::enable_if_t<not std::is_arithmetic_v<limit_container_t>,
+                                    bool>>
+std::size_t
+detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::propagate(
+    state& stepping, track_container_t& tracks,
+    const limit_container_t& path_limits,
+    const std::size_t repack_interval) const {
+
+    assert(path_limits.size() == tracks.size());
+
+    return propagate_impl(
+        stepping, tracks,
+        [&path_limits](const std::size_t trk_idx) {
+            return static_cast<scalar_type>(path_limits[trk_idx]);
+        },
+        repack_interval);
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+template <typename track_container_t, typename path_limit_fn_t>
+std::size_t
+detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::
+    propagate_impl(state& stepping, track_container_t& tracks,
+                   const path_limit_fn_t& path_limit,
+                   const std::size_t repack_interval) const {
+
+    std::size_t next{0u};
+    std::size_t n_success{0u};
+    std::size_t n_steps{0u};
+
+    // Fill the pack
+    repack(stepping, tracks, next, path_limit, n_success);
+
+    while (stepping.any_alive()) {
+        step(stepping);
+        ++n_steps;
+
+        // Replace the finished tracks by pending ones
+        if (n_steps % std::max(repack_interval, std::size_t{1u}) == 0u or
+            not stepping.any_alive()) {
+            repack(stepping, tracks, next, path_limit, n_success);
+        }
+    }
+
+    return n_success;
+}
+
+template <typename magnetic_field_t, typename transform3_t, std::size_t N,
+          template <typename, std::size_t> class array_t>
+template <typename track_container_t, typename path_limit_fn_t>
+void detray::rk_stepper_pack<magnetic_field_t, transform3_t, N, array_t>::
+    repack(state& stepping, track_container_t& tracks, std::size_t& next,
+           const path_limit_fn_t& path_limit, std::size_t& n_success) const {
+
+    for (std::size_t i = 0u; i < N; ++i) {
+        if (stepping._alive[i]) {
+            continue;
+        }
+
+        // Write back the result of a finished lane
+        const dindex trk_idx{stepping._track_idx[i]};
+        if (trk_idx != dindex_invalid) {
+            stepping.unload(i, tracks[trk_idx]);
+            n_success += stepping._aborted[i] ? 0u : 1u;
+            stepping._track_idx[i] = dindex_invalid;
+        }
+
+        // Refill the lane
+        if (next < tracks.size()) {
+            stepping.load(i, tracks[next], path_limit(next),
+                          static_cast<dindex>(next));
+            ++next;
+        }
+    }
+}
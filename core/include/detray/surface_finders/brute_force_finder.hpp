@@ -19,6 +19,7 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <cstddef>
 #include <type_traits>
 
 namespace detray {
@@ -145,6 +146,11 @@ class brute_force_collection {
         return {m_surfaces, dindex_range{m_offsets[i], m_offsets[i + 1u]}};
     }
 
+    /// Reserve memory for a total of @param n surfaces
+    DETRAY_HOST void reserve(const std::size_t n) noexcept(false) {
+        m_surfaces.reserve(n);
+    }
+
     /// Add a new surface collection
     template <
         typename sf_container_t,
@@ -12,11 +12,13 @@
 #include "detray/definitions/detail/algorithms.hpp"
 #include "detray/definitions/grid_axis.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
 #include "detray/definitions/qualifiers.hpp"
 
 // System include(s).
 #include <cstddef>
 #include <iterator>
+#include <limits>
 
 namespace detray::n_axis {
 
@@ -168,6 +170,11 @@ struct regular {
 ///
 /// @note The bin search makes this type comparatively expensive. Only use when
 /// absolutely needed.
+///
+/// @note If a uniform lookup table was appended to the bin edges (see
+/// @c add_lookup_table ), the bin search is restricted to the few edges that
+/// overlap the lookup cell of the value, which makes it effectively constant
+/// time. Otherwise, a binary search over all edges is performed.
 template <typename dcontainers = host_container_types,
           typename scalar_t = scalar>
 struct irregular {
@@ -214,17 +221,89 @@ struct irregular {
     /// @returns the corresponding bin index
     DETRAY_HOST_DEVICE
     int bin(const scalar_t v) const {
-        auto bins_begin =
-            m_bin_edges->begin() +
-            static_cast<index_type>(detray::detail::get<0>(*m_edges_range));
-        auto bins_end =
-            m_bin_edges->begin() +
-            static_cast<index_type>(detray::detail::get<1>(*m_edges_range));
+        const dindex offset{detray::detail::get<0>(*m_edges_range)};
+        const dindex n_bins{nbins()};
+        const dindex lut_offset{offset + n_bins + 1u};
+
+        // Fast path: Only search the edges of the lookup cell
+        if (lut_offset + 1u < static_cast<dindex>(m_bin_edges->size()) and
+            math_ns::isnan((*m_bin_edges)[lut_offset])) {
+
+            const scalar_t min{(*m_bin_edges)[offset]};
+            if (not(v > min)) {
+                return -1;
+            }
+            const scalar_t max{(*m_bin_edges)[offset + n_bins]};
+            const auto n_cells{
+                static_cast<dindex>((*m_bin_edges)[lut_offset + 1u])};
+            const scalar_t x{static_cast<scalar_t>(n_cells) * (v - min) /
+                             (max - min)};
+            const dindex cell{x < static_cast<scalar_t>(n_cells)
+                                  ? static_cast<dindex>(x)
+                                  : n_cells - 1u};
+
+            const int pos{lower_edge(
+                v,
+                static_cast<dindex>((*m_bin_edges)[lut_offset + 2u + cell]),
+                static_cast<dindex>((*m_bin_edges)[lut_offset + 3u + cell]))};
+
+            // Guard against rounding errors in the cell calculation
+            if ((*m_bin_edges)[offset + static_cast<dindex>(pos) - 1u] < v and
+                (static_cast<dindex>(pos) == n_bins or
+                 not((*m_bin_edges)[offset + static_cast<dindex>(pos)] < v))) {
+                return pos - 1;
+            }
+        }
 
-        return static_cast<int>(
-                   detray::detail::lower_bound(bins_begin, bins_end, v) -
-                   bins_begin) -
-               1;
+        return lower_edge(v, 0u, n_bins) - 1;
+    }
+
+    /// Append a uniform lookup table for the bin search to the bin edges.
+    ///
+    /// The span of the axis is divided into @param n_cells cells of equal
+    /// width and for every cell boundary, the position of the first bin edge
+    /// that is not smaller than the boundary is stored. The table is placed
+    /// directly behind the bin edges of the axis, so that it is shared by all
+    /// views and device copies of the edges container:
+    /// [NaN marker, number of cells, n_cells + 1 edge positions]
+    ///
+    /// @param edges the bin edges container, which must end with the edges of
+    ///              the axis
+    /// @param range index range of the axis into @param edges
+    template <typename edges_container_t>
+    DETRAY_HOST static void add_lookup_table(edges_container_t &edges,
+                                             const dindex_range &range,
+                                             const dindex n_cells) {
+        const dindex offset{detray::detail::get<0>(range)};
+        const dindex last{detray::detail::get<1>(range)};
+
+        // Can only be added directly after the edges
+        if (n_cells == 0u or last <= offset or
+            static_cast<dindex>(edges.size()) != last + 1u) {
+            return;
+        }
+        const scalar_t min{edges[offset]};
+        const scalar_t max{edges[last]};
+        if (not(max > min)) {
+            return;
+        }
+        const scalar_t width{(max - min) / static_cast<scalar_t>(n_cells)};
+
+        edges.push_back(std::numeric_limits<scalar_t>::quiet_NaN());
+        edges.push_back(static_cast<scalar_t>(n_cells));
+        for (dindex cell = 0u; cell <= n_cells; ++cell) {
+            const scalar_t x{cell == n_cells
+                                 ? max
+                                 : min + static_cast<scalar_t>(cell) * width};
+            const auto bins_begin =
+                edges.begin() + static_cast<index_type>(offset);
+            const auto pos{detray::detail::lower_bound(
+                               bins_begin,
+                               edges.begin() + static_cast<index_type>(last),
+                               x) -
+                           bins_begin};
+            edges.push_back(static_cast<scalar_t>(pos));
+        }
     }
 
     /// Access function to a range with binned neighborhood
@@ -307,6 +386,24 @@ struct irregular {
 
         return {min, max};
     }
+
+    private:
+    /// @returns the position (relative to the first edge of the axis) of the
+    /// first lower bin edge in [@param first, @param last) that is not smaller
+    /// than the value @param v
+    DETRAY_HOST_DEVICE
+    int lower_edge(const scalar_t v, const dindex first,
+                   const dindex last) const {
+        auto bins_begin =
+            m_bin_edges->begin() +
+            static_cast<index_type>(detray::detail::get<0>(*m_edges_range));
+
+        return static_cast<int>(
+            detray::detail::lower_bound(
+                bins_begin + static_cast<index_type>(first),
+                bins_begin + static_cast<index_type>(last), v) -
+            bins_begin);
+    }
 };
 
 }  // namespace detray::n_axis
@@ -8,6 +8,8 @@
 #pragma once
 
 // Project include(s).
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/definitions/indexing.hpp"
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/surface_finders/grid/grid.hpp"
 
@@ -16,7 +18,9 @@
 
 // System include(s).
 #include <cstddef>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace detray {
 
@@ -181,20 +185,72 @@ class grid_collection<
     DETRAY_HOST constexpr auto push_back(
         const typename grid_type::template type<true> &gr) noexcept(false)
         -> void {
+        // Offsets of the new grid into the global storage
+        const auto edges_offset{static_cast<dindex>(m_bin_edges.size())};
         m_offsets.push_back(static_cast<size_type>(m_bins.size()));
 
         const auto *grid_bins = gr.data().bin_data();
         m_bins.insert(m_bins.end(), grid_bins->begin(), grid_bins->end());
 
-        const auto *axes_data = gr.axes().data().axes_data();
-        m_axes_data.insert(m_axes_data.end(), axes_data->begin(),
-                           axes_data->end());
+        // The ranges in the axes data point into the grid's own bin edges
+        append_axes_data(*(gr.axes().data().axes_data()), edges_offset,
+                         std::make_index_sequence<grid_type::Dim>{});
 
         const auto *bin_edges = gr.axes().data().edges();
         m_bin_edges.insert(m_bin_edges.end(), bin_edges->begin(),
                            bin_edges->end());
     }
 
+    /// Add all grids of another collection @param other to this collection.
+    DETRAY_HOST auto append(const grid_collection &other) noexcept(false)
+        -> void {
+        const auto bins_offset{static_cast<size_type>(m_bins.size())};
+        const auto edges_offset{static_cast<dindex>(m_bin_edges.size())};
+
+        m_offsets.reserve(m_offsets.size() + other.m_offsets.size());
+        for (const size_type offset : other.m_offsets) {
+            m_offsets.push_back(bins_offset + offset);
+        }
+        m_bins.insert(m_bins.end(), other.m_bins.begin(), other.m_bins.end());
+
+        append_axes_data(other.m_axes_data, edges_offset,
+                         std::make_index_sequence<grid_type::Dim>{});
+
+        m_bin_edges.insert(m_bin_edges.end(), other.m_bin_edges.begin(),
+                           other.m_bin_edges.end());
+    }
+
+    private:
+    /// Append the axes data of one or multiple grids @param axes_data and
+    /// shift their ranges by @param edges_offset into the bin edges storage.
+    template <std::size_t... I>
+    DETRAY_HOST auto append_axes_data(const axes_storage_type &axes_data,
+                                      const dindex edges_offset,
+                                      std::index_sequence<I...>) -> void {
+        m_axes_data.reserve(m_axes_data.size() + axes_data.size());
+        for (std::size_t i = 0u; i < axes_data.size(); i += grid_type::Dim) {
+            (m_axes_data.push_back(
+                 shift_edges_range<I>(axes_data[i + I], edges_offset)),
+             ...);
+        }
+    }
+
+    /// @returns the edges range of axis @tparam I, shifted by @param offset
+    template <std::size_t I>
+    DETRAY_HOST static auto shift_edges_range(dindex_range range,
+                                              const dindex offset)
+        -> dindex_range {
+        using binning_t =
+            std::tuple_element_t<I, typename multi_axis_t::binnings>;
+
+        range[0] += offset;
+        // The irregular binning keeps the end of the edges range
+        if constexpr (binning_t::type == n_axis::binning::e_irregular) {
+            range[1] += offset;
+        }
+        return range;
+    }
+
     private:
     /// Offsets for the respective grids into the bin storage
     vector_type<size_type> m_offsets{};
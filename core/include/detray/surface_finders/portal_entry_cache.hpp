@@ -0,0 +1,245 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Precomputed candidate lists for tracks that enter a volume through
+/// a portal ("portal-entry caching").
+///
+/// For every portal that links to another volume, the entry position on the
+/// portal and the track direction are binned coarsely. Every bin holds the
+/// indices (in the detector surface lookup) of all surfaces of the adjacent
+/// volume that a straight track from the bin can reach, plus all portals of
+/// that volume. The navigator then only has to intersect this subset when it
+/// initializes the volume after a portal crossing.
+///
+/// The cache is built on the host by the @c portal_entry_cache_builder . The
+/// candidate lists account for the bending of tracks down to a minimum
+/// momentum, which is recorded per portal as the maximal |q/p|. A cache that
+/// was built without magnetic field only covers straight lines (maximal
+/// |q/p| of zero).
+///
+/// @tparam detector_t the detector type the cache is used with.
+template <typename detector_t>
+class portal_entry_cache {
+
+    public:
+    template <typename T>
+    using vector_type = typename detector_t::template vector_type<T>;
+    using scalar_type = typename detector_t::scalar_type;
+    using point3 = typename detector_t::point3;
+    using vector3 = typename detector_t::vector3;
+    using size_type = dindex;
+
+    /// Binning of a single portal
+    struct portal_entry {
+        /// Local bounding box of the portal (min and max x, y, z)
+        darray<scalar_type, 6> box{};
+        /// Number of bins in local x, y, z and in global phi and cos(theta)
+        darray<dindex, 5> n_bins{1u, 1u, 1u, 1u, 1u};
+        /// Index of the first bin of the portal
+        dindex offset{0u};
+        /// Maximal |q/p| of the tracks that the candidate lists cover
+        scalar_type max_qop{0.f};
+    };
+
+    using view_type =
+        dmulti_view<dvector_view<dindex>, dvector_view<portal_entry>,
+                    dvector_view<dindex_range>, dvector_view<dindex>>;
+    using const_view_type = dmulti_view<
+        dvector_view<const dindex>, dvector_view<const portal_entry>,
+        dvector_view<const dindex_range>, dvector_view<const dindex>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<dindex>, dvector_buffer<portal_entry>,
+                      dvector_buffer<dindex_range>, dvector_buffer<dindex>>;
+
+    /// Default constructor
+    constexpr portal_entry_cache() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit portal_entry_cache(vecmem::memory_resource &resource)
+        : m_portal_links(&resource),
+          m_portals(&resource),
+          m_bins(&resource),
+          m_surfaces(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename cache_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<cache_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE portal_entry_cache(cache_view_t &view)
+        : m_portal_links(detail::get<0>(view.m_view)),
+          m_portals(detail::get<1>(view.m_view)),
+          m_bins(detail::get<2>(view.m_view)),
+          m_surfaces(detail::get<3>(view.m_view)) {}
+
+    /// @returns the number of cached portals
+    DETRAY_HOST_DEVICE
+    auto n_portals() const -> size_type {
+        return static_cast<size_type>(m_portals.size());
+    }
+
+    /// @returns the total number of bins of all portals
+    DETRAY_HOST_DEVICE
+    auto n_bins() const -> size_type {
+        return static_cast<size_type>(m_bins.size());
+    }
+
+    /// @returns the total number of stored surface indices
+    DETRAY_HOST_DEVICE
+    auto n_entries() const -> size_type {
+        return static_cast<size_type>(m_surfaces.size());
+    }
+
+    /// @returns true if the portal with surface index @param sf_idx is cached
+    DETRAY_HOST_DEVICE
+    auto contains(const dindex sf_idx) const -> bool {
+        return sf_idx < m_portal_links.size() and
+               m_portal_links[sf_idx] != dindex_invalid;
+    }
+
+    /// @returns true if the portal with surface index @param sf_idx is cached
+    /// and its candidate lists cover tracks with charge over momentum
+    /// @param qop
+    DETRAY_HOST_DEVICE
+    auto covers(const dindex sf_idx, const scalar_type qop) const -> bool {
+        return contains(sf_idx) and
+               math_ns::abs(qop) <= m_portals[m_portal_links[sf_idx]].max_qop;
+    }
+
+    /// Find the candidate surfaces for a track that enters the adjacent volume
+    /// through a portal.
+    ///
+    /// @param sf_idx index of the portal in the surface lookup
+    /// @param trf the placement of the portal
+    /// @param glob_pos the global position of the track on the portal
+    /// @param glob_dir the (normalized) global direction of the track
+    ///
+    /// @returns the range of surface indices in the adjacent volume, empty if
+    /// the portal is not cached
+    template <typename transform3_t>
+    DETRAY_HOST_DEVICE auto search(const dindex sf_idx,
+                                   const transform3_t &trf,
+                                   const point3 &glob_pos,
+                                   const vector3 &glob_dir) const {
+        if (not contains(sf_idx)) {
+            return detray::ranges::subrange(m_surfaces, dindex_range{0u, 0u});
+        }
+        const portal_entry &entry = m_portals[m_portal_links[sf_idx]];
+        const point3 loc_pos = trf.point_to_local(glob_pos);
+
+        // Local position bins
+        dindex gbin{0u};
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            gbin = gbin * entry.n_bins[i] +
+                   bin(loc_pos[i], entry.box[i], entry.box[i + 3u],
+                       entry.n_bins[i]);
+        }
+        // Global direction bins
+        constexpr scalar_type pi{constant<scalar_type>::pi};
+        gbin = gbin * entry.n_bins[3] +
+               bin(math_ns::atan2(glob_dir[1], glob_dir[0]), -pi, pi,
+                   entry.n_bins[3]);
+        gbin = gbin * entry.n_bins[4] +
+               bin(glob_dir[2], -1.f, 1.f, entry.n_bins[4]);
+
+        return detray::ranges::subrange(m_surfaces,
+                                        m_bins[entry.offset + gbin]);
+    }
+
+    /// @returns the bin index of @param x in [@param min, @param max) with
+    /// @param n bins. Values outside the range fall into the edge bins.
+    DETRAY_HOST_DEVICE
+    static constexpr auto bin(const scalar_type x, const scalar_type min,
+                              const scalar_type max, const dindex n) -> dindex {
+        if (n <= 1u or not(x > min)) {
+            return 0u;
+        }
+        const scalar_type b{static_cast<scalar_type>(n) * (x - min) /
+                            (max - min)};
+
+        return b < static_cast<scalar_type>(n) ? static_cast<dindex>(b)
+                                               : n - 1u;
+    }
+
+    /// Add a new portal @param entry for the surface with index @param sf_idx
+    /// and the candidate lists of all its bins in @param bin_surfaces
+    ///
+    /// @note consecutive bins with the same candidates share their storage
+    template <typename bin_container_t>
+    DETRAY_HOST auto push_back(const dindex sf_idx, portal_entry entry,
+                               const bin_container_t &bin_surfaces) -> void {
+        if (m_portal_links.size() <= sf_idx) {
+            m_portal_links.resize(sf_idx + 1u, dindex_invalid);
+        }
+        m_portal_links[sf_idx] = static_cast<dindex>(m_portals.size());
+
+        entry.offset = static_cast<dindex>(m_bins.size());
+        m_portals.push_back(entry);
+
+        const typename bin_container_t::value_type *prev{nullptr};
+        for (const auto &surfaces : bin_surfaces) {
+            // Reuse the storage of the previous bin if the content is equal
+            if (prev != nullptr and surfaces == *prev) {
+                m_bins.push_back(m_bins.back());
+                continue;
+            }
+            const auto first{static_cast<dindex>(m_surfaces.size())};
+            m_surfaces.insert(m_surfaces.end(), surfaces.begin(),
+                              surfaces.end());
+            m_bins.push_back({first, static_cast<dindex>(m_surfaces.size())});
+            prev = &surfaces;
+        }
+    }
+
+    /// @return the view on the cache - non-const
+    DETRAY_HOST
+    auto get_data() -> view_type {
+        return view_type{
+            detray::get_data(m_portal_links), detray::get_data(m_portals),
+            detray::get_data(m_bins), detray::get_data(m_surfaces)};
+    }
+
+    /// @return the view on the cache - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_portal_links), detray::get_data(m_portals),
+            detray::get_data(m_bins), detray::get_data(m_surfaces)};
+    }
+
+    private:
+    /// Index into the portal entries for every surface in the detector
+    vector_type<dindex> m_portal_links{};
+    /// Binning of every cached portal
+    vector_type<portal_entry> m_portals{};
+    /// Range of candidate surfaces for every bin
+    vector_type<dindex_range> m_bins{};
+    /// Flat storage of the candidate surface indices
+    vector_type<dindex> m_surfaces{};
+};
+
+}  // namespace detray
@@ -1,4 +1,3 @@
-
 /** Detray library, part of the ACTS project (R&D line)
  *
  * (c) 2021-2023 CERN for the benefit of the ACTS project
@@ -9,17 +8,436 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/surface_finders/grid/detail/axis_helpers.hpp"
 #include "detray/tools/associator.hpp"
 #include "detray/tools/generators.hpp"
+#include "detray/utils/for_each.hpp"
 #include "detray/utils/ranges.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
 
+namespace detail {
+
+/// @returns the tolerance that is added to a bin with edges @param edges
+inline scalar bin_tolerance_add(const std::array<scalar, 2> &edges,
+                                const scalar tolerance,
+                                const bool absolute_tolerance) {
+    return absolute_tolerance ? tolerance : tolerance * (edges[1] - edges[0]);
+}
+
+/// @returns the contour of the bin ( @param bin_0 , @param bin_1 ) of a disc
+/// grid @param grid in the global x-y plane
+template <typename point2_t, typename grid_t>
+inline std::vector<point2_t> polar_bin_contour(
+    const grid_t &grid, const dindex bin_0, const dindex bin_1,
+    const std::array<scalar, 2> &bin_tolerance, const bool absolute_tolerance) {
+
+    const auto r_borders = grid.template get_axis<0>().bin_edges(bin_0);
+    const auto phi_borders = grid.template get_axis<1>().bin_edges(bin_1);
+
+    const scalar r_add{
+        bin_tolerance_add(r_borders, bin_tolerance[0], absolute_tolerance)};
+    const scalar phi_add{
+        bin_tolerance_add(phi_borders, bin_tolerance[1], absolute_tolerance)};
+
+    return r_phi_polygon<scalar, point2_t>(
+        r_borders[0] - r_add, r_borders[1] + r_add, phi_borders[0] - phi_add,
+        phi_borders[1] + phi_add);
+}
+
+/// @returns the contour of the bin ( @param bin_0 , @param bin_1 ) of a
+/// cylinder grid @param grid in the z-phi plane
+template <typename point2_t, typename grid_t>
+inline std::vector<point2_t> cylindrical_bin_contour(
+    const grid_t &grid, const dindex bin_0, const dindex bin_1,
+    const std::array<scalar, 2> &bin_tolerance, const bool absolute_tolerance) {
+
+    const auto z_borders = grid.template get_axis<0>().bin_edges(bin_0);
+    const auto phi_borders = grid.template get_axis<1>().bin_edges(bin_1);
+
+    const scalar z_add{
+        bin_tolerance_add(z_borders, bin_tolerance[0], absolute_tolerance)};
+    const scalar phi_add{
+        bin_tolerance_add(phi_borders, bin_tolerance[1], absolute_tolerance)};
+
+    const scalar z_min{z_borders[0] - z_add};
+    const scalar z_max{z_borders[1] + z_add};
+    const scalar phi_min{phi_borders[0] - phi_add};
+    const scalar phi_max{phi_borders[1] + phi_add};
+
+    return {{z_min, phi_min}, {z_min, phi_max}, {z_max, phi_max},
+            {z_max, phi_min}};
+}
+
+/// @returns the contours of the surface @param sf in the global x-y plane (one
+/// per mask of the surface)
+template <typename point2_t, typename point3_t, typename surface_t,
+          typename transform_container_t, typename mask_container_t>
+inline std::vector<std::vector<point2_t>> polar_contours(
+    const surface_t &sf, const transform_container_t &transforms,
+    const mask_container_t &surface_masks) {
+
+    const auto &transform = transforms[sf.transform()];
+
+    auto vertices_per_masks =
+        surface_masks.template visit<vertexer<point2_t, point3_t>>(sf.mask());
+
+    std::vector<std::vector<point2_t>> contours;
+    contours.reserve(vertices_per_masks.size());
+    for (const auto &vertices : vertices_per_masks) {
+        if (vertices.empty()) {
+            continue;
+        }
+        std::vector<point2_t> surface_contour;
+        surface_contour.reserve(vertices.size());
+        for (const auto &v : vertices) {
+            const point3_t vg = transform.point_to_global(v);
+            surface_contour.push_back({vg[0], vg[1]});
+        }
+        contours.push_back(std::move(surface_contour));
+    }
+
+    return contours;
+}
+
+/// @returns the contours of the surface @param sf in the z-phi plane (one per
+/// mask of the surface). A contour is split in two, if the surface crosses
+/// the phi boundary.
+template <typename point2_t, typename point3_t, typename surface_t,
+          typename transform_container_t, typename mask_container_t>
+inline std::vector<std::vector<std::vector<point2_t>>> cylindrical_contours(
+    const surface_t &sf, const transform_container_t &transforms,
+    const mask_container_t &surface_masks) {
+
+    const auto &transform = transforms[sf.transform()];
+
+    auto vertices_per_masks =
+        surface_masks.template visit<vertexer<point2_t, point3_t>>(sf.mask());
+
+    std::vector<std::vector<std::vector<point2_t>>> contours;
+    contours.reserve(vertices_per_masks.size());
+    for (const auto &vertices : vertices_per_masks) {
+        if (vertices.empty()) {
+            continue;
+        }
+        // Create a surface contour
+        std::vector<point2_t> surface_contour;
+        surface_contour.reserve(vertices.size());
+        scalar phi_min = std::numeric_limits<scalar>::max();
+        scalar phi_max = -std::numeric_limits<scalar>::max();
+        // We poentially need the split vertices
+        std::vector<point2_t> s_c_neg;
+        std::vector<point2_t> s_c_pos;
+        scalar z_min_neg = std::numeric_limits<scalar>::max();
+        scalar z_max_neg = -std::numeric_limits<scalar>::max();
+        scalar z_min_pos = std::numeric_limits<scalar>::max();
+        scalar z_max_pos = -std::numeric_limits<scalar>::max();
+
+        for (const auto &v : vertices) {
+            const point3_t vg = transform.point_to_global(v);
+            scalar phi = std::atan2(vg[1], vg[0]);
+            phi_min = std::min(phi, phi_min);
+            phi_max = std::max(phi, phi_max);
+            surface_contour.push_back({vg[2], phi});
+            if (phi < 0.) {
+                s_c_neg.push_back({vg[2], phi});
+                z_min_neg = std::min(vg[2], z_min_neg);
+                z_max_neg = std::max(vg[2], z_max_neg);
+            } else {
+                s_c_pos.push_back({vg[2], phi});
+                z_min_pos = std::min(vg[2], z_min_pos);
+                z_max_pos = std::max(vg[2], z_max_pos);
+            }
+        }
+        // Check for phi wrapping
+        if (phi_max - phi_min > constant<scalar>::pi and
+            phi_max * phi_min < 0.) {
+            s_c_neg.push_back({z_max_neg, -constant<scalar>::pi});
+            s_c_neg.push_back({z_min_neg, -constant<scalar>::pi});
+            s_c_pos.push_back({z_max_pos, constant<scalar>::pi});
+            s_c_pos.push_back({z_min_pos, constant<scalar>::pi});
+            contours.push_back({std::move(s_c_neg), std::move(s_c_pos)});
+        } else {
+            contours.push_back({std::move(surface_contour)});
+        }
+    }
+
+    return contours;
+}
+
+/// @returns true if one of the surface contours @param sf_contours should be
+/// associated with the bin contour @param bin_contour of a disc grid
+template <typename point2_t>
+inline bool is_associated_polar(
+    const std::vector<point2_t> &bin_contour,
+    const std::vector<std::vector<point2_t>> &sf_contours) {
+
+    // Run with two different associators: center of gravity and edge
+    // intersection
+    center_of_gravity_generic cgs_assoc;
+    edges_intersect_generic edges_assoc;
+
+    // Usually one mask per surface, but design allows - a single association
+    // is sufficient though
+    for (const auto &surface_contour : sf_contours) {
+        if (cgs_assoc(bin_contour, surface_contour) or
+            edges_assoc(bin_contour, surface_contour)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @returns true if one of the surface contours @param sf_contours should be
+/// associated with the bin contour @param bin_contour of a cylinder grid
+template <typename point2_t>
+inline bool is_associated_cylindrical(
+    const std::vector<point2_t> &bin_contour,
+    const std::vector<std::vector<std::vector<point2_t>>> &sf_contours) {
+
+    center_of_gravity_rectangle cgs_assoc;
+    edges_intersect_generic edges_assoc;
+
+    for (const auto &split_contours : sf_contours) {
+        // Check the association (with potential splits)
+        for (const auto &s_c : split_contours) {
+            if (cgs_assoc(bin_contour, s_c) or edges_assoc(bin_contour, s_c)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// @brief Region on a grid axis that is covered by the contours of its bins
+/// (including the bin tolerance)
+struct axis_bin_coverage {
+    /// Covered interval per bin
+    std::vector<std::array<scalar, 2>> bins{};
+    /// Maximal extension of a covered interval beyond its nominal bin edges
+    std::array<scalar, 2> reach{0.f, 0.f};
+    /// Whether the bin contours cover the full circle
+    std::vector<bool> full_circle{};
+
+    /// Set the covered interval @param cov for the bin with the nominal
+    /// edges @param edges
+    void add(const std::array<scalar, 2> &edges,
+             const std::array<scalar, 2> &cov) {
+        bins.push_back(cov);
+        reach[0] = std::max(reach[0], edges[0] - cov[0]);
+        reach[1] = std::max(reach[1], cov[1] - edges[1]);
+    }
+};
+
+/// @returns the indices of the bins on the axis @param axis whose nominal
+/// range overlaps with the interval @param interval extended by the coverage
+/// reach in @param cov
+template <typename axis_t>
+inline std::vector<dindex> candidate_bins(
+    const axis_t &axis, const axis_bin_coverage &cov,
+    const std::array<scalar, 2> &interval) {
+
+    const dindex n_bins{axis.nbins()};
+    const scalar lower{interval[0] - cov.reach[1]};
+    const scalar upper{interval[1] + cov.reach[0]};
+
+    std::vector<dindex> candidates;
+
+    const bool is_circular{axis.bounds() == n_axis::bounds::e_circular};
+    // The open axes index the over- and underflow bins differently: Test all
+    if (axis.bounds() == n_axis::bounds::e_open or
+        (is_circular and upper - lower >= 2.f * constant<scalar>::pi)) {
+        candidates.resize(n_bins);
+        for (dindex i = 0u; i < n_bins; ++i) {
+            candidates[i] = i;
+        }
+        return candidates;
+    }
+
+    const dindex_range range =
+        axis.range(lower, std::array<scalar, 2>{0.f, upper - lower});
+
+    // Pad by one bin, in case a contour only touches the interval
+    if (is_circular) {
+        const dindex n_candidates{(range[1] + n_bins - range[0]) % n_bins +
+                                  3u};
+        const dindex first{(range[0] + n_bins - 1u) % n_bins};
+        for (dindex i = 0u; i < std::min(n_candidates, n_bins); ++i) {
+            candidates.push_back((first + i) % n_bins);
+        }
+    } else {
+        const dindex first{range[0] > 0u ? range[0] - 1u : 0u};
+        const dindex last{std::min(range[1] + 1u, n_bins - 1u)};
+        for (dindex i = first; i <= last; ++i) {
+            candidates.push_back(i);
+        }
+    }
+
+    return candidates;
+}
+
+/// @returns whether the intervals @param a and @param b overlap (optionally
+/// periodic in 2pi)
+inline bool overlaps(const std::array<scalar, 2> &a,
+                     const std::array<scalar, 2> &b,
+                     const bool periodic = false) {
+    if (not periodic) {
+        return a[0] <= b[1] and b[0] <= a[1];
+    }
+    constexpr scalar two_pi{2.f * constant<scalar>::pi};
+    for (const scalar shift : {-two_pi, 0.f, two_pi}) {
+        if (a[0] + shift <= b[1] and b[0] <= a[1] + shift) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @returns the squared distance of the origin to the segment [ @param p0,
+/// @param p1 ] in the x-y plane
+template <typename point2_t>
+inline scalar origin_distance2(const point2_t &p0, const point2_t &p1) {
+    const scalar dx{p1[0] - p0[0]};
+    const scalar dy{p1[1] - p0[1]};
+    const scalar len2{dx * dx + dy * dy};
+    scalar t{len2 > 0.f ? -(p0[0] * dx + p0[1] * dy) / len2 : 0.f};
+    t = std::clamp(t, scalar{0}, scalar{1});
+    const scalar x{p0[0] + t * dx};
+    const scalar y{p0[1] + t * dy};
+    return x * x + y * y;
+}
+
+/// @returns the bounding ranges in r and phi of the contour @param contour ,
+/// which is given in the x-y plane
+template <typename point2_t>
+inline std::array<std::array<scalar, 2>, 2> polar_bounds(
+    const std::vector<point2_t> &contour) {
+
+    constexpr scalar pi{constant<scalar>::pi};
+
+    point2_t cgs = {0.f, 0.f};
+    for (const auto &v : contour) {
+        cgs = cgs + v;
+    }
+    cgs = 1.f / static_cast<scalar>(contour.size()) * cgs;
+
+    scalar r2_min{cgs[0] * cgs[0] + cgs[1] * cgs[1]};
+    scalar r2_max{r2_min};
+    for (std::size_t i = 0u; i < contour.size(); ++i) {
+        const auto &v = contour[i];
+        const auto &w = contour[(i + 1u) % contour.size()];
+        r2_max = std::max(r2_max, v[0] * v[0] + v[1] * v[1]);
+        r2_min = std::min(r2_min, origin_distance2(v, w));
+    }
+
+    const scalar phi_ref{math_ns::atan2(cgs[1], cgs[0])};
+    const std::array<scalar, 2> full_phi{phi_ref - pi, phi_ref + pi};
+
+    // The contour encloses the origin
+    if (center_of_gravity_generic{}(contour,
+                                    std::vector<point2_t>{{0.f, 0.f}})) {
+        return {{{0.f, math_ns::sqrt(r2_max)}, full_phi}};
+    }
+
+    // Phi range relative to the center of gravity
+    scalar d_min{0.f};
+    scalar d_max{0.f};
+    for (const auto &v : contour) {
+        scalar d{math_ns::atan2(v[1], v[0]) - phi_ref};
+        d = d > pi ? d - 2.f * pi : (d <= -pi ? d + 2.f * pi : d);
+        d_min = std::min(d_min, d);
+        d_max = std::max(d_max, d);
+    }
+
+    const std::array<scalar, 2> r_range{math_ns::sqrt(r2_min),
+                                        math_ns::sqrt(r2_max)};
+    // The edges of contours that span a wide angle can pass close to the
+    // origin and sweep a larger angle than the vertices: Test all phi bins
+    if (d_max - d_min > 0.5f * pi) {
+        return {{r_range, full_phi}};
+    }
+    return {{r_range, {phi_ref + d_min, phi_ref + d_max}}};
+}
+
+/// @returns the bounding ranges in z and phi of the contour @param contour ,
+/// which is given in the z-phi plane
+template <typename point2_t>
+inline std::array<std::array<scalar, 2>, 2> cylindrical_bounds(
+    const std::vector<point2_t> &contour) {
+
+    std::array<std::array<scalar, 2>, 2> bounds{
+        {{std::numeric_limits<scalar>::max(),
+          -std::numeric_limits<scalar>::max()},
+         {std::numeric_limits<scalar>::max(),
+          -std::numeric_limits<scalar>::max()}}};
+
+    for (const auto &v : contour) {
+        for (std::size_t i = 0u; i < 2u; ++i) {
+            bounds[i][0] = std::min(bounds[i][0], v[i]);
+            bounds[i][1] = std::max(bounds[i][1], v[i]);
+        }
+    }
+    return bounds;
+}
+
+/// Find the bins that could be covered by one of the contours with the local
+/// bounding ranges @param bounds
+///
+/// @param axis_0 the first grid axis (r or z)
+/// @param axis_1 the second grid axis (phi)
+/// @param cov_0 coverage of the bin contours on the first axis
+/// @param cov_1 coverage of the bin contours on the second axis
+/// @param periodic whether the bin coverage in phi is periodic
+/// @param candidates the unique candidate bins
+template <typename axis_0_t, typename axis_1_t>
+inline void find_candidates(
+    const axis_0_t &axis_0, const axis_1_t &axis_1,
+    const axis_bin_coverage &cov_0, const axis_bin_coverage &cov_1,
+    const std::vector<std::array<std::array<scalar, 2>, 2>> &bounds,
+    const bool periodic, std::vector<std::array<dindex, 2>> &candidates) {
+
+    for (const auto &bound : bounds) {
+        const std::vector<dindex> bins_1 =
+            candidate_bins(axis_1, cov_1, bound[1]);
+
+        for (const dindex bin_0 : candidate_bins(axis_0, cov_0, bound[0])) {
+            if (not overlaps(cov_0.bins[bin_0], bound[0])) {
+                continue;
+            }
+            // The bin contour can reach every phi
+            if (cov_0.full_circle[bin_0]) {
+                for (dindex bin_1 = 0u; bin_1 < axis_1.nbins(); ++bin_1) {
+                    candidates.push_back({bin_0, bin_1});
+                }
+                continue;
+            }
+            for (const dindex bin_1 : bins_1) {
+                if (overlaps(cov_1.bins[bin_1], bound[1], periodic)) {
+                    candidates.push_back({bin_0, bin_1});
+                }
+            }
+        }
+    }
+
+    // The candidates of different contours can overlap
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+}
+
+}  // namespace detail
+
 /// Run the bin association of surfaces (via their contour) to a given 2D grid.
 ///
 /// @param context is the context to win which the association is done
@@ -51,32 +469,15 @@ static inline void bin_association(const context_t & /*context*/,
     // Disk type bin association
     if constexpr (std::is_same_v<typename grid_t::local_frame,
                                  polar2<transform_t>>) {
-        // Run with two different associators: center of gravity and edge
-        // intersection
-        center_of_gravity_generic cgs_assoc;
-        edges_intersect_generic edges_assoc;
 
         // Loop over all bins and associate the surfaces
         for (unsigned int bin_0 = 0; bin_0 < axis_0.nbins(); ++bin_0) {
             for (unsigned int bin_1 = 0; bin_1 < axis_1.nbins(); ++bin_1) {
 
-                auto r_borders = axis_0.bin_edges(bin_0);
-                auto phi_borders = axis_1.bin_edges(bin_1);
-
-                scalar r_add =
-                    absolute_tolerance
-                        ? bin_tolerance[0]
-                        : bin_tolerance[0] * (r_borders[1] - r_borders[0]);
-                scalar phi_add =
-                    absolute_tolerance
-                        ? bin_tolerance[1]
-                        : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
-
                 // Create a contour for the bin
-                std::vector<point2_t> bin_contour =
-                    r_phi_polygon<scalar, point2_t>(
-                        r_borders[0] - r_add, r_borders[1] + r_add,
-                        phi_borders[0] - phi_add, phi_borders[1] + phi_add);
+                const std::vector<point2_t> bin_contour =
+                    detail::polar_bin_contour<point2_t>(
+                        grid, bin_0, bin_1, bin_tolerance, absolute_tolerance);
 
                 // Run through the surfaces and associate them by contour
                 for (auto sf : surfaces) {
@@ -86,32 +487,12 @@ static inline void bin_association(const context_t & /*context*/,
                         continue;
                     }
 
-                    // Unroll the mask container and generate vertices
-                    const auto &transform = transforms[sf.transform()];
-
-                    auto vertices_per_masks =
-                        surface_masks
-                            .template visit<vertexer<point2_t, point3_t>>(
-                                sf.mask());
-
-                    // Usually one mask per surface, but design allows - a
-                    // single association  is sufficient though
-                    for (auto &vertices : vertices_per_masks) {
-                        if (not vertices.empty()) {
-                            // Create a surface contour
-                            std::vector<point2_t> surface_contour;
-                            surface_contour.reserve(vertices.size());
-                            for (const auto &v : vertices) {
-                                auto vg = transform.point_to_global(v);
-                                surface_contour.push_back({vg[0], vg[1]});
-                            }
-                            // The association has worked
-                            if (cgs_assoc(bin_contour, surface_contour) or
-                                edges_assoc(bin_contour, surface_contour)) {
-                                grid.populate({bin_0, bin_1}, sf);
-                                break;
-                            }
-                        }
+                    // The association has worked
+                    if (detail::is_associated_polar(
+                            bin_contour,
+                            detail::polar_contours<point2_t, point3_t>(
+                                sf, transforms, surface_masks))) {
+                        grid.populate({bin_0, bin_1}, sf);
                     }
                 }
             }
@@ -119,37 +500,13 @@ static inline void bin_association(const context_t & /*context*/,
     } else if constexpr (std::is_same_v<typename grid_t::local_frame,
                                         cylindrical2<transform_t>>) {
 
-        center_of_gravity_rectangle cgs_assoc;
-        edges_intersect_generic edges_assoc;
-
         // Loop over all bins and associate the surfaces
         for (unsigned int bin_0 = 0; bin_0 < axis_0.nbins(); ++bin_0) {
             for (unsigned int bin_1 = 0; bin_1 < axis_1.nbins(); ++bin_1) {
 
-                auto z_borders = axis_0.bin_edges(bin_0);
-                auto phi_borders = axis_1.bin_edges(bin_1);
-
-                scalar z_add =
-                    absolute_tolerance
-                        ? bin_tolerance[0]
-                        : bin_tolerance[0] * (z_borders[1] - z_borders[0]);
-                scalar phi_add =
-                    absolute_tolerance
-                        ? bin_tolerance[1]
-                        : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
-
-                scalar z_min = z_borders[0];
-                scalar z_max = z_borders[1];
-                scalar phi_min_rep = phi_borders[0];
-                scalar phi_max_rep = phi_borders[1];
-
-                point2_t p0_bin = {z_min - z_add, phi_min_rep - phi_add};
-                point2_t p1_bin = {z_min - z_add, phi_max_rep + phi_add};
-                point2_t p2_bin = {z_max + z_add, phi_max_rep + phi_add};
-                point2_t p3_bin = {z_max + z_add, phi_min_rep - phi_add};
-
-                std::vector<point2_t> bin_contour = {p0_bin, p1_bin, p2_bin,
-                                                     p3_bin};
+                const std::vector<point2_t> bin_contour =
+                    detail::cylindrical_bin_contour<point2_t>(
+                        grid, bin_0, bin_1, bin_tolerance, absolute_tolerance);
 
                 // Loop over the surfaces within a volume
                 for (auto sf : surfaces) {
@@ -159,87 +516,180 @@ static inline void bin_association(const context_t & /*context*/,
                         continue;
                     }
 
-                    // Unroll the mask container and generate vertices
-                    const auto &transform = transforms[sf.transform()];
-
-                    auto vertices_per_masks =
-                        surface_masks
-                            .template visit<vertexer<point2_t, point3_t>>(
-                                sf.mask());
-
-                    for (auto &vertices : vertices_per_masks) {
-
-                        if (not vertices.empty()) {
-                            // Create a surface contour
-                            std::vector<point2_t> surface_contour;
-                            surface_contour.reserve(vertices.size());
-                            scalar phi_min = std::numeric_limits<scalar>::max();
-                            scalar phi_max =
-                                -std::numeric_limits<scalar>::max();
-                            // We poentially need the split vertices
-                            std::vector<point2_t> s_c_neg;
-                            std::vector<point2_t> s_c_pos;
-                            scalar z_min_neg =
-                                std::numeric_limits<scalar>::max();
-                            scalar z_max_neg =
-                                -std::numeric_limits<scalar>::max();
-                            scalar z_min_pos =
-                                std::numeric_limits<scalar>::max();
-                            scalar z_max_pos =
-                                -std::numeric_limits<scalar>::max();
-
-                            for (const auto &v : vertices) {
-                                const point3_t vg =
-                                    transform.point_to_global(v);
-                                scalar phi = std::atan2(vg[1], vg[0]);
-                                phi_min = std::min(phi, phi_min);
-                                phi_max = std::max(phi, phi_max);
-                                surface_contour.push_back({vg[2], phi});
-                                if (phi < 0.) {
-                                    s_c_neg.push_back({vg[2], phi});
-                                    z_min_neg = std::min(vg[2], z_min_neg);
-                                    z_max_neg = std::max(vg[2], z_max_neg);
-                                } else {
-                                    s_c_pos.push_back({vg[2], phi});
-                                    z_min_pos = std::min(vg[2], z_min_pos);
-                                    z_max_pos = std::max(vg[2], z_max_pos);
-                                }
-                            }
-                            // Check for phi wrapping
-                            std::vector<std::vector<point2_t>> surface_contours;
-                            if (phi_max - phi_min > constant<scalar>::pi and
-                                phi_max * phi_min < 0.) {
-                                s_c_neg.push_back(
-                                    {z_max_neg, -constant<scalar>::pi});
-                                s_c_neg.push_back(
-                                    {z_min_neg, -constant<scalar>::pi});
-                                s_c_pos.push_back(
-                                    {z_max_pos, constant<scalar>::pi});
-                                s_c_pos.push_back(
-                                    {z_min_pos, constant<scalar>::pi});
-                                surface_contours = {s_c_neg, s_c_pos};
-                            } else {
-                                surface_contours = {surface_contour};
-                            }
-
-                            // Check the association (with potential splits)
-                            bool associated = false;
-                            for (const auto &s_c : surface_contours) {
-                                if (cgs_assoc(bin_contour, s_c) or
-                                    edges_assoc(bin_contour, s_c)) {
-                                    associated = true;
-                                    break;
-                                }
-                            }
-
-                            // Register if associated
-                            if (associated) {
-                                grid.populate({{bin_0, bin_1}}, sf);
-                                break;
-                            }
-                        }
+                    // Register if associated
+                    if (detail::is_associated_cylindrical(
+                            bin_contour,
+                            detail::cylindrical_contours<point2_t, point3_t>(
+                                sf, transforms, surface_masks))) {
+                        grid.populate({{bin_0, bin_1}}, sf);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Run the bin association of surfaces (via their contour) to a given 2D grid
+/// by only testing the bins that are close to a surface.
+///
+/// The bins that can be covered by a surface are found from the bounding
+/// range of its contour in the local frame of the grid, using the bin lookup
+/// of the grid axes. Only these candidate bins are then tested with the same
+/// associators as in @c bin_association , so that the result is identical,
+/// while the cost scales with the number of surfaces instead of the number of
+/// surfaces times the number of bins. The surfaces are independent of each
+/// other and can be processed concurrently by passing a parallel loop.
+///
+/// @param context is the context to win which the association is done
+/// @param surfaces a range of detector surfaces
+/// @param transforms the transforms that belong to the surfaces
+/// @param surface_masks the masks that belong to the surfaces
+/// @param grid either a cylinder or disc grid to be filled
+/// @param tolerance is the bin_tolerance in the two local coordinates
+/// @param absolute_tolerance is an indicator if the tolerance is to be
+///        taken absolute or relative
+/// @param for_each loop that calls a functor for every surface index
+///        in [0, n) (serial by default)
+template <typename context_t, typename surface_container_t,
+          typename transform_container_t, typename mask_container_t,
+          typename grid_t, typename for_each_t = detail::serial_for_each,
+          std::enable_if_t<grid_t::Dim == 2, bool> = true>
+static inline void spatial_hash_bin_association(
+    const context_t & /*context*/, const surface_container_t &surfaces,
+    const transform_container_t &transforms,
+    const mask_container_t &surface_masks, grid_t &grid,
+    const std::array<scalar, 2> &bin_tolerance, bool absolute_tolerance = true,
+    for_each_t &&for_each = {}) {
+
+    using transform_t = typename transform_container_t::value_type;
+    using point2_t = typename transform_t::point2;
+    using point3_t = typename transform_t::point3;
+    using surface_t = detray::ranges::range_value_t<surface_container_t>;
+
+    constexpr bool is_polar{
+        std::is_same_v<typename grid_t::local_frame, polar2<transform_t>>};
+    constexpr bool is_cylindrical{std::is_same_v<typename grid_t::local_frame,
+                                                 cylindrical2<transform_t>>};
+
+    if constexpr (is_polar or is_cylindrical) {
+
+        constexpr scalar pi{constant<scalar>::pi};
+
+        const auto &axis_0 = grid.template get_axis<0>();
+        const auto &axis_1 = grid.template get_axis<1>();
+
+        // Local region that is covered by the bin contours
+        detail::axis_bin_coverage cov_0{}, cov_1{};
+
+        scalar max_phi_width{0.f};
+        for (dindex bin_1 = 0u; bin_1 < axis_1.nbins(); ++bin_1) {
+            const auto edges = axis_1.bin_edges(bin_1);
+            const scalar add{detail::bin_tolerance_add(
+                edges, bin_tolerance[1], absolute_tolerance)};
+            cov_1.add(edges, {edges[0] - add, edges[1] + add});
+            max_phi_width =
+                std::max(max_phi_width, edges[1] - edges[0] + 2.f * add);
+        }
+
+        // The corners of a polar bin contour are connected by straight lines:
+        // The inner edge comes closer to the origin than the lower r-edge
+        // and wider bins do not stay inside their phi wedge
+        const bool phi_wedges{is_cylindrical or max_phi_width < pi};
+        const scalar chord_factor{
+            is_polar and phi_wedges ? math_ns::cos(0.5f * max_phi_width)
+                                    : 1.f};
+
+        for (dindex bin_0 = 0u; bin_0 < axis_0.nbins(); ++bin_0) {
+            const auto edges = axis_0.bin_edges(bin_0);
+            const scalar add{detail::bin_tolerance_add(
+                edges, bin_tolerance[0], absolute_tolerance)};
+            const scalar lower{edges[0] - add};
+            const scalar upper{edges[1] + add};
+
+            if constexpr (is_polar) {
+                // The contour passes through the origin
+                const bool full_circle{lower <= 0.f or not phi_wedges};
+                cov_0.full_circle.push_back(full_circle);
+                cov_0.add(edges, {lower > 0.f ? chord_factor * lower : 0.f,
+                                  std::max(upper, -lower)});
+            } else {
+                cov_0.full_circle.push_back(false);
+                cov_0.add(edges, {lower, upper});
+            }
+        }
+
+        // Copy the surface handles for random access
+        std::vector<surface_t> sf_handles;
+        for (const auto &sf : surfaces) {
+            sf_handles.push_back(sf);
+        }
+
+        // Find the bins of every surface
+        std::vector<std::vector<n_axis::multi_bin<2>>> sf_bins(
+            sf_handles.size());
+
+        auto associate = [&](const std::size_t sf_idx) {
+            const surface_t &sf = sf_handles[sf_idx];
+
+            // Add only sensitive surfaces to the grid
+            if (sf.is_portal()) {
+                return;
+            }
+
+            // Local bounding ranges of the surface contours
+            std::vector<std::array<std::array<scalar, 2>, 2>> bounds;
+            std::vector<std::array<dindex, 2>> candidates;
+
+            if constexpr (is_polar) {
+                const auto contours =
+                    detail::polar_contours<point2_t, point3_t>(
+                        sf, transforms, surface_masks);
+
+                for (const auto &contour : contours) {
+                    bounds.push_back(detail::polar_bounds(contour));
+                }
+                detail::find_candidates(axis_0, axis_1, cov_0, cov_1, bounds,
+                                        true, candidates);
+                for (const auto &bins : candidates) {
+                    if (detail::is_associated_polar(
+                            detail::polar_bin_contour<point2_t>(
+                                grid, bins[0], bins[1], bin_tolerance,
+                                absolute_tolerance),
+                            contours)) {
+                        sf_bins[sf_idx].push_back({bins[0], bins[1]});
                     }
                 }
+            } else {
+                const auto contours =
+                    detail::cylindrical_contours<point2_t, point3_t>(
+                        sf, transforms, surface_masks);
+
+                for (const auto &split_contours : contours) {
+                    for (const auto &contour : split_contours) {
+                        bounds.push_back(detail::cylindrical_bounds(contour));
+                    }
+                }
+                detail::find_candidates(axis_0, axis_1, cov_0, cov_1, bounds,
+                                        false, candidates);
+                for (const auto &bins : candidates) {
+                    if (detail::is_associated_cylindrical(
+                            detail::cylindrical_bin_contour<point2_t>(
+                                grid, bins[0], bins[1], bin_tolerance,
+                                absolute_tolerance),
+                            contours)) {
+                        sf_bins[sf_idx].push_back({bins[0], bins[1]});
+                    }
+                }
+            }
+        };
+
+        for_each(sf_handles.size(), associate);
+
+        // Fill the grid in surface order, which yields the same bin content
+        // ordering as the full bin loop
+        for (std::size_t sf_idx = 0u; sf_idx < sf_handles.size(); ++sf_idx) {
+            for (const auto &mbin : sf_bins[sf_idx]) {
+                grid.populate(mbin, sf_handles[sf_idx]);
             }
         }
     }
@@ -115,4 +115,38 @@ struct bin_associator {
     }
 };
 
+/// Fill a grid surface finder by bin association, where only the bins close
+/// to a surface are tested.
+///
+/// @param grid the grid that should be filled
+/// @param det the detector from which to get the surface placements
+/// @param vol the volume the grid belongs to
+/// @param ctx the geometry context
+struct spatial_hash_bin_associator {
+
+    template <typename detector_t, typename volume_type, typename grid_t,
+              typename... Args>
+    DETRAY_HOST auto operator()(grid_t &grid, detector_t &det,
+                                const volume_type &vol,
+                                const typename detector_t::geometry_context ctx,
+                                Args &&...) const -> void {
+        this->operator()(grid, vol, det.surfaces(vol), det.transform_store(),
+                         det.mask_store(), ctx);
+    }
+
+    template <typename grid_t, typename volume_t, typename surface_container,
+              typename mask_container, typename transform_container,
+              typename context_t, typename... Args>
+    DETRAY_HOST auto operator()(grid_t &grid, const volume_t &,
+                                const surface_container &surfaces,
+                                const transform_container &transforms,
+                                const mask_container &masks,
+                                const context_t ctx, Args &&...) const -> void {
+        // Fill the surfaces into the grid by matching their contour onto the
+        // grid bins in their vicinity
+        spatial_hash_bin_association(ctx, surfaces, transforms, masks, grid,
+                                     {0.1f, 0.1f}, false);
+    }
+};
+
 }  // namespace detray::detail
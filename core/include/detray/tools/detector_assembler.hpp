@@ -0,0 +1,336 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/tools/store_deduplicator.hpp"
+#include "detray/tools/surface_factory_interface.hpp"
+#include "detray/utils/for_each.hpp"
+
+// System include(s)
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Holds the data of a single volume independently of the detector.
+///
+/// All links of the surfaces and sensitives (transform, mask and material)
+/// are relative to the volume-local stores. The material links refer to the
+/// detector material store instead, if the fragment does not hold any
+/// material of its own.
+template <typename detector_t>
+struct volume_fragment {
+
+    using volume_type = typename detector_t::volume_type;
+
+    /// Construct the fragment of a volume with shape @param id , that will
+    /// end up at position @param index in the detector volume container
+    DETRAY_HOST
+    volume_fragment(const volume_id id, const dindex index) : volume{id} {
+        volume.set_index(index);
+    }
+
+    /// Generate surfaces for the volume with the factory @param factory
+    DETRAY_HOST
+    void add_surfaces(
+        const std::shared_ptr<surface_factory_interface<detector_t>>& factory,
+        const typename detector_t::geometry_context ctx = {}) {
+        (*factory)(volume, surfaces, transforms, masks, ctx);
+    }
+
+    /// Let surfaces with identical masks or material share a single entry.
+    /// Global material links are left untouched.
+    DETRAY_HOST
+    void deduplicate() {
+        // Deduplicate over the surfaces and sensitives in one pass
+        const auto n_surfaces{static_cast<std::ptrdiff_t>(surfaces.size())};
+        surfaces.insert(surfaces.end(), sensitives.begin(), sensitives.end());
+
+        if (materials.total_size() > 0u) {
+            store_deduplicator{}(surfaces, masks, materials);
+        } else {
+            store_deduplicator{}(surfaces, masks);
+        }
+
+        sensitives.assign(surfaces.begin() + n_surfaces, surfaces.end());
+        surfaces.erase(surfaces.begin() + n_surfaces, surfaces.end());
+    }
+
+    /// The volume descriptor (links are set during the merge)
+    volume_type volume;
+    /// Placement of the volume
+    typename detector_t::transform3 placement{};
+
+    /// Surfaces that are added to the default accelerator
+    typename detector_t::surface_container_t surfaces{};
+    /// Surfaces that are only placed in the accelerator of @c add_accelerator
+    /// (their indices follow the indices of @c surfaces )
+    typename detector_t::surface_container_t sensitives{};
+    typename detector_t::transform_container transforms{};
+    typename detector_t::mask_container masks{};
+    typename detector_t::material_container materials{};
+
+    /// Optional: Builds an accelerator for the @c sensitives and links it to
+    /// the volume. Called during the merge, once the data of the fragment was
+    /// added to the detector and the surface links are final.
+    std::function<void(detector_t&, volume_type&,
+                       const typename detector_t::surface_container_t&)>
+        add_accelerator{};
+};
+
+/// @brief Builds detector volumes in two phases.
+///
+/// In the first phase, the volumes are constructed into independent
+/// @c volume_fragment s, which can be done concurrently. In the second phase,
+/// the offsets of the fragment data in the detector stores are obtained from
+/// a prefix sum over the fragments, the surface links are updated in one
+/// sweep and the fragment stores are appended to the detector in bulk. The
+/// detector is therefore never modified concurrently.
+///
+/// The loop over the fragments is injected with @tparam for_each_t , which
+/// has the signature 'void(std::size_t n, fn)' (see @c serial_for_each ).
+/// detray::io provides a threaded loop.
+template <typename detector_t, typename for_each_t = detail::serial_for_each>
+class detector_assembler {
+
+    using geo_obj_ids = typename detector_t::geo_obj_ids;
+    using mask_types = typename detector_t::mask_container::value_types;
+    using material_types = typename detector_t::material_container::value_types;
+
+    static constexpr std::size_t n_mask_types{
+        detector_t::mask_container::n_collections()};
+    static constexpr std::size_t n_material_types{
+        detector_t::material_container::n_collections()};
+
+    /// Offsets of the data of a fragment in the detector stores
+    struct fragment_offsets {
+        dindex volume{0u};
+        dindex transform{0u};
+        dindex surface{0u};
+        std::array<dindex, n_mask_types> masks{};
+        std::array<dindex, n_material_types> materials{};
+    };
+
+    public:
+    using fragment_type = volume_fragment<detector_t>;
+
+    /// Build the fragments in the loop @param for_each
+    DETRAY_HOST
+    explicit detector_assembler(for_each_t for_each = {})
+        : m_for_each{std::move(for_each)} {}
+
+    /// Phase one: Build the volume fragments in the loop
+    ///
+    /// @param det the detector the volumes will be added to (not modified)
+    /// @param vol_ids the shape ids of the new volumes
+    /// @param fill callable that fills the fragment with the i-th volume
+    ///             and has the signature 'void(fragment_type&, std::size_t)'
+    ///
+    /// @returns the volume fragments in the order of @param vol_ids
+    template <typename fill_fn_t>
+    DETRAY_HOST auto build_local(const detector_t& det,
+                                 const std::vector<volume_id>& vol_ids,
+                                 fill_fn_t&& fill) const
+        -> std::vector<fragment_type> {
+
+        const auto vol_offset{static_cast<dindex>(det.volumes().size())};
+
+        std::vector<fragment_type> fragments;
+        fragments.reserve(vol_ids.size());
+        for (std::size_t i = 0u; i < vol_ids.size(); ++i) {
+            fragments.emplace_back(vol_ids[i],
+                                   vol_offset + static_cast<dindex>(i));
+        }
+
+        m_for_each(fragments.size(), [&fragments, &fill](const std::size_t i) {
+            fill(fragments[i], i);
+        });
+
+        return fragments;
+    }
+
+    /// Phase two: Merge the volume fragments @param fragments into the
+    /// detector @param det
+    ///
+    /// @note can throw an exception if the fragments are inconsistent
+    DETRAY_HOST
+    void merge(detector_t& det, std::vector<fragment_type>&& fragments,
+               const typename detector_t::geometry_context ctx = {}) const
+        noexcept(false) {
+
+        if (fragments.empty()) {
+            return;
+        }
+
+        // The fragment volume indices must still be valid
+        assert(fragments.front().volume.index() == det.volumes().size());
+
+        // Prefix sum over the fragments
+        std::vector<fragment_offsets> offsets(fragments.size());
+
+        fragment_offsets total{};
+        total.volume = static_cast<dindex>(det.volumes().size());
+        total.transform = static_cast<dindex>(det.transform_store().size(ctx));
+        total.surface = static_cast<dindex>(det.n_surfaces());
+        total.masks = sizes(det.mask_store());
+        total.materials = sizes(det.material_store());
+
+        for (std::size_t i = 0u; i < fragments.size(); ++i) {
+            const fragment_type& frag = fragments[i];
+            offsets[i] = total;
+
+            total.volume++;
+            // The volume placement comes before the surface transforms
+            total.transform +=
+                1u + static_cast<dindex>(frag.transforms.size(ctx));
+            total.surface += static_cast<dindex>(frag.surfaces.size() +
+                                                 frag.sensitives.size());
+            add(total.masks, sizes(frag.masks));
+            add(total.materials, sizes(frag.materials));
+        }
+
+        // Fix the surface links in the loop
+        m_for_each(fragments.size(), [&fragments, &offsets](std::size_t i) {
+            update_links(fragments[i], offsets[i]);
+        });
+
+        // Bulk merge into the detector
+        det.volumes().reserve(total.volume);
+        det.transform_store().reserve(total.transform, ctx);
+        det.surface_lookup().reserve(total.surface);
+        det.surface_store().template get<default_acc_id>().reserve(
+            total.surface);
+        // Material maps cannot be reserved, only reserve the masks
+        reserve(det.mask_store(), total.masks);
+
+        for (fragment_type& frag : fragments) {
+            auto& vol = det.volumes().emplace_back(frag.volume);
+
+            vol.set_transform(det.transform_store().size(ctx));
+            det.transform_store().push_back(frag.placement, ctx);
+            det.append_transforms(std::move(frag.transforms), ctx);
+
+            for (const auto& sf : frag.surfaces) {
+                det.add_surface_to_lookup(sf);
+            }
+            for (const auto& sf : frag.sensitives) {
+                det.add_surface_to_lookup(sf);
+            }
+            det.append_portals(std::move(frag.surfaces));
+            // All surfaces are filled into the default accelerator
+            vol.template set_link<static_cast<geo_obj_ids>(0)>(
+                default_acc_id,
+                det.surface_store().template size<default_acc_id>() - 1u);
+
+            det.append_masks(std::move(frag.masks));
+            det.append_materials(std::move(frag.materials));
+
+            if (frag.add_accelerator) {
+                frag.add_accelerator(det, vol, frag.sensitives);
+            }
+        }
+    }
+
+    /// Build and merge the volumes in one go (see @c build_local )
+    template <typename fill_fn_t>
+    DETRAY_HOST void operator()(detector_t& det,
+                                const std::vector<volume_id>& vol_ids,
+                                fill_fn_t&& fill,
+                                const typename detector_t::geometry_context
+                                    ctx = {}) const {
+        merge(det, build_local(det, vol_ids, std::forward<fill_fn_t>(fill)),
+              ctx);
+    }
+
+    private:
+    static constexpr auto default_acc_id{detector_t::sf_finders::id::e_default};
+
+    /// Shift the links of all surfaces in the fragment @param frag by the
+    /// offsets @param off of its data in the detector stores
+    DETRAY_HOST
+    static void update_links(fragment_type& frag,
+                             const fragment_offsets& off) {
+
+        // Otherwise, the material links are global already
+        const bool local_material{frag.materials.total_size() > 0u};
+
+        dindex sf_idx{off.surface};
+        auto update = [&off, local_material, &sf_idx](auto& sf) {
+            sf.update_transform(off.transform + 1u);
+            sf.update_mask(off.masks[mask_types::to_index(sf.mask().id())]);
+
+            const std::size_t mat_type_idx{
+                material_types::to_index(sf.material().id())};
+            // Surfaces without material
+            if (local_material and mat_type_idx < n_material_types) {
+                sf.update_material(off.materials[mat_type_idx]);
+            }
+            sf.set_index(sf_idx++);
+        };
+
+        for (auto& sf : frag.surfaces) {
+            update(sf);
+        }
+        for (auto& sf : frag.sensitives) {
+            update(sf);
+        }
+    }
+
+    /// @returns the sizes of all collections in the store @param store
+    template <typename store_t>
+    DETRAY_HOST static auto sizes(const store_t& store) {
+        return sizes(store,
+                     std::make_index_sequence<store_t::n_collections()>{});
+    }
+
+    template <typename store_t, std::size_t... I>
+    DETRAY_HOST static auto sizes(const store_t& store,
+                                  std::index_sequence<I...> /*seq*/) {
+        using types = typename store_t::value_types;
+        return std::array<dindex, sizeof...(I)>{
+            store.template size<types::to_id(I)>()...};
+    }
+
+    /// Reserve the sizes @param n for all collections in the store @param store
+    template <typename store_t, std::size_t N>
+    DETRAY_HOST static void reserve(store_t& store,
+                                    const std::array<dindex, N>& n) {
+        reserve(store, n, std::make_index_sequence<N>{});
+    }
+
+    template <typename store_t, std::size_t N, std::size_t... I>
+    DETRAY_HOST static void reserve(store_t& store,
+                                    const std::array<dindex, N>& n,
+                                    std::index_sequence<I...> /*seq*/) {
+        using types = typename store_t::value_types;
+        (store.template reserve<types::to_id(I)>(n[I], {}), ...);
+    }
+
+    /// Add the sizes @param rhs to @param lhs
+    template <std::size_t N>
+    DETRAY_HOST static void add(std::array<dindex, N>& lhs,
+                                const std::array<dindex, N>& rhs) {
+        for (std::size_t i = 0u; i < N; ++i) {
+            lhs[i] += rhs[i];
+        }
+    }
+
+    /// Loop over the fragments
+    for_each_t m_for_each;
+};
+
+}  // namespace detray
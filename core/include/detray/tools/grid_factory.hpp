@@ -401,8 +401,15 @@ class grid_factory {
         // Assemble the grid and return it
         axes_t axes(std::move(axes_data), std::move(bin_edges));
 
+        // Allocate the bins of all axes
+        const auto n_bins_per_axis = axes.nbins();
+        dindex n_global_bins{1u};
+        for (dindex i = 0u; i < axes_t::Dim; ++i) {
+            n_global_bins *= n_bins_per_axis[i];
+        }
+
         vector_type<bin_t> bin_data{};
-        bin_data.resize(axes.nbins()[0] * axes.nbins()[1],
+        bin_data.resize(n_global_bins,
                         populator_impl_t::template init<
                             typename grid_type<axes_t>::value_type>());
 
@@ -434,6 +441,10 @@ class grid_factory {
                                      1u)});
             bin_edges.insert(bin_edges.end(), bin_edges_loc.begin(),
                              bin_edges_loc.end());
+            // Speed up the bin search with one lookup cell per bin
+            std::tuple_element_t<I, binnings>::add_lookup_table(
+                bin_edges, axes_data.back(),
+                static_cast<dindex>(bin_edges_loc.size() - 1u));
         }
     }
 
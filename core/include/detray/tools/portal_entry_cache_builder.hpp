@@ -0,0 +1,335 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/surface_finders/portal_entry_cache.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Mask store visitor that @returns the local bounding box of all masks of a
+/// surface (min and max x, y, z) and the volume link of the surface
+struct surface_bounds {
+
+    template <typename mask_group_t, typename mask_range_t, typename scalar_t>
+    DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                       const mask_range_t &mask_range,
+                                       const scalar_t envelope) const
+        -> std::pair<darray<scalar_t, 6>, dindex> {
+
+        constexpr scalar_t inf{std::numeric_limits<scalar_t>::infinity()};
+        darray<scalar_t, 6> box{inf, inf, inf, -inf, -inf, -inf};
+        dindex volume_link{dindex_invalid};
+
+        // All masks of a surface share the local frame
+        for (const auto &mask :
+             detray::ranges::subrange(mask_group, mask_range)) {
+            const auto mask_box = mask.local_min_bounds(envelope);
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                box[i] = std::min(box[i], static_cast<scalar_t>(mask_box[i]));
+                box[i + 3u] = std::max(box[i + 3u],
+                                       static_cast<scalar_t>(mask_box[i + 3u]));
+            }
+            volume_link = static_cast<dindex>(mask.volume_link());
+        }
+
+        return {box, volume_link};
+    }
+};
+
+}  // namespace detail
+
+/// @brief Builds the portal entry cache for a detector.
+///
+/// For every portal that links to another volume, the local bounding box of
+/// the portal is split into position cells and the global track direction
+/// into (phi, cos(theta)) cells. For every combination, the surfaces of the
+/// adjacent volume that can be reached by a straight line starting in the
+/// position cell with a direction in the direction cell are collected. The
+/// test is conservative: It compares the bounding spheres of the cell and the
+/// surface with the cone of directions. The cone is opened up by the largest
+/// deviation of a track from its initial direction over the distance to the
+/// surface, given by the field strength and the minimal momentum in the
+/// configuration, and by an additional angular tolerance.
+///
+/// @note With the default configuration (no field), the cache is only valid
+/// for straight line propagation: It covers no track with |q/p| > 0, unless
+/// the track is propagated by the line stepper.
+template <typename detector_t>
+class portal_entry_cache_builder {
+
+    public:
+    using scalar_type = typename detector_t::scalar_type;
+    using point3 = typename detector_t::point3;
+    using vector3 = typename detector_t::vector3;
+    using cache_type = portal_entry_cache<detector_t>;
+
+    struct config {
+        /// Number of bins per (non-degenerate) local axis of a portal
+        dindex n_pos_bins{2u};
+        /// Number of bins of the global track direction in phi
+        dindex n_phi_bins{8u};
+        /// Number of bins of the global track direction in cos(theta)
+        dindex n_theta_bins{4u};
+        /// Additional opening angle of the direction cones (safety margin)
+        scalar_type angular_tolerance{0.1f};
+        /// Maximal magnetic field strength in the detector (straight lines
+        /// only, if zero)
+        scalar_type bfield{0.f};
+        /// Minimal momentum of the tracks that the cache covers in the field
+        scalar_type min_p{1.f * unit<scalar_type>::GeV};
+        /// Envelope around the bounding boxes of portals and surfaces
+        scalar_type envelope{1.f * unit<scalar_type>::mm};
+    };
+
+    /// Default constructor
+    portal_entry_cache_builder() = default;
+
+    /// Constructor from a configuration @param cfg
+    explicit portal_entry_cache_builder(const config &cfg) : m_cfg{cfg} {}
+
+    /// @returns access to the configuration
+    config &get_config() { return m_cfg; }
+
+    /// Build the cache for the detector @param det with memory resource
+    /// @param resource
+    DETRAY_HOST
+    auto build(const detector_t &det, vecmem::memory_resource &resource) const
+        -> cache_type {
+
+        const auto &sf_lookup = det.surface_lookup();
+        const auto &transforms = det.transform_store();
+
+        // Bounding information for every surface in the detector
+        std::vector<bounds> sf_bounds;
+        sf_bounds.reserve(sf_lookup.size());
+        std::vector<std::vector<dindex>> vol_surfaces(det.volumes().size());
+
+        for (const auto &sf : sf_lookup) {
+            const auto [box, vol_link] =
+                det.mask_store().template visit<detail::surface_bounds>(
+                    sf.mask(), m_cfg.envelope);
+            const auto &trf = transforms[sf.transform()];
+
+            const point3 loc_center{0.5f * (box[0] + box[3]),
+                                    0.5f * (box[1] + box[4]),
+                                    0.5f * (box[2] + box[5])};
+            sf_bounds.push_back({box, trf.point_to_global(loc_center),
+                                 half_diagonal(box), vol_link});
+
+            vol_surfaces.at(sf.volume()).push_back(sf.index());
+        }
+
+        cache_type cache{resource};
+
+        // Largest curvature of the tracks that are covered: Without field,
+        // the candidate lists only hold for tracks that do not bend
+        const scalar_type max_qop{m_cfg.bfield > 0.f ? 1.f / m_cfg.min_p
+                                                     : 0.f};
+        const scalar_type kappa{m_cfg.bfield > 0.f ? m_cfg.bfield * max_qop
+                                                   : 0.f};
+
+        for (const auto &sf : sf_lookup) {
+            const bounds &pt_bounds = sf_bounds[sf.index()];
+
+            // Only portals that lead to another volume
+            if (not sf.is_portal() or
+                pt_bounds.volume_link >= vol_surfaces.size() or
+                pt_bounds.volume_link == sf.volume() or
+                not std::isfinite(pt_bounds.radius)) {
+                continue;
+            }
+
+            const auto &trf = transforms[sf.transform()];
+            const auto &candidates = vol_surfaces[pt_bounds.volume_link];
+
+            // Set up the binning of the portal
+            typename cache_type::portal_entry entry{};
+            entry.box = pt_bounds.box;
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                const scalar_type extent{entry.box[i + 3u] - entry.box[i]};
+                entry.n_bins[i] =
+                    extent > 2.f * m_cfg.envelope ? m_cfg.n_pos_bins : 1u;
+            }
+            entry.n_bins[3] = m_cfg.n_phi_bins;
+            entry.n_bins[4] = m_cfg.n_theta_bins;
+            entry.max_qop = max_qop;
+
+            // Collect the candidates of every bin
+            std::vector<std::vector<dindex>> bin_surfaces;
+            bin_surfaces.reserve(entry.n_bins[0] * entry.n_bins[1] *
+                                 entry.n_bins[2] * entry.n_bins[3] *
+                                 entry.n_bins[4]);
+
+            for (dindex ix = 0u; ix < entry.n_bins[0]; ++ix) {
+                for (dindex iy = 0u; iy < entry.n_bins[1]; ++iy) {
+                    for (dindex iz = 0u; iz < entry.n_bins[2]; ++iz) {
+
+                        // Position cell of the portal
+                        darray<scalar_type, 6> cell{};
+                        const darray<dindex, 3> idx{ix, iy, iz};
+                        for (unsigned int i = 0u; i < 3u; ++i) {
+                            const scalar_type w{
+                                (entry.box[i + 3u] - entry.box[i]) /
+                                static_cast<scalar_type>(entry.n_bins[i])};
+                            cell[i] = entry.box[i] +
+                                      static_cast<scalar_type>(idx[i]) * w;
+                            cell[i + 3u] = cell[i] + w;
+                        }
+                        const point3 cell_center = trf.point_to_global(
+                            point3{0.5f * (cell[0] + cell[3]),
+                                   0.5f * (cell[1] + cell[4]),
+                                   0.5f * (cell[2] + cell[5])});
+                        const scalar_type cell_radius{half_diagonal(cell)};
+
+                        for (dindex iphi = 0u; iphi < entry.n_bins[3];
+                             ++iphi) {
+                            for (dindex ith = 0u; ith < entry.n_bins[4];
+                                 ++ith) {
+                                auto &bin = bin_surfaces.emplace_back();
+                                const auto [axis, opening] =
+                                    direction_cone(entry, iphi, ith);
+
+                                for (const dindex cand_idx : candidates) {
+                                    const bounds &cand = sf_bounds[cand_idx];
+                                    if (sf_lookup[cand_idx].is_portal() or
+                                        is_reachable(cell_center, cell_radius,
+                                                     axis, opening, kappa,
+                                                     cand)) {
+                                        bin.push_back(cand_idx);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            cache.push_back(sf.index(), entry, bin_surfaces);
+        }
+
+        return cache;
+    }
+
+    private:
+    /// Global bounding sphere and local box of a surface
+    struct bounds {
+        darray<scalar_type, 6> box;
+        point3 center;
+        scalar_type radius;
+        dindex volume_link;
+    };
+
+    /// @returns half the diagonal of the box @param box
+    static scalar_type half_diagonal(const darray<scalar_type, 6> &box) {
+        const scalar_type dx{box[3] - box[0]};
+        const scalar_type dy{box[4] - box[1]};
+        const scalar_type dz{box[5] - box[2]};
+
+        return 0.5f * std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    /// @returns the unit vector for the angles @param phi and @param cos_theta
+    static vector3 unit_vector(const scalar_type phi,
+                               const scalar_type cos_theta) {
+        const scalar_type sin_theta{
+            std::sqrt(std::max(scalar_type{0.f}, 1.f - cos_theta * cos_theta))};
+
+        return {std::cos(phi) * sin_theta, std::sin(phi) * sin_theta,
+                cos_theta};
+    }
+
+    /// @returns the central axis and the opening angle of the direction bin
+    /// ( @param iphi, @param itheta )
+    auto direction_cone(const typename cache_type::portal_entry &entry,
+                        const dindex iphi, const dindex itheta) const
+        -> std::pair<vector3, scalar_type> {
+
+        constexpr scalar_type pi{constant<scalar_type>::pi};
+        const scalar_type w_phi{2.f * pi /
+                                static_cast<scalar_type>(entry.n_bins[3])};
+        const scalar_type w_cos{2.f /
+                                static_cast<scalar_type>(entry.n_bins[4])};
+        const scalar_type phi_min{-pi + static_cast<scalar_type>(iphi) * w_phi};
+        const scalar_type cos_min{-1.f +
+                                  static_cast<scalar_type>(itheta) * w_cos};
+
+        const vector3 axis =
+            unit_vector(phi_min + 0.5f * w_phi, cos_min + 0.5f * w_cos);
+
+        // Sample the border and inside of the bin for the largest deviation
+        constexpr dindex n_samples{5u};
+        scalar_type opening{0.f};
+        for (dindex i = 0u; i < n_samples; ++i) {
+            for (dindex j = 0u; j < n_samples; ++j) {
+                const scalar_type f_i{static_cast<scalar_type>(i) /
+                                      static_cast<scalar_type>(n_samples - 1u)};
+                const scalar_type f_j{static_cast<scalar_type>(j) /
+                                      static_cast<scalar_type>(n_samples - 1u)};
+                const vector3 dir =
+                    unit_vector(phi_min + f_i * w_phi, cos_min + f_j * w_cos);
+                opening = std::max(opening, angle(axis, dir));
+            }
+        }
+
+        return {axis, opening + m_cfg.angular_tolerance};
+    }
+
+    /// @returns the angle between the unit vectors @param a and @param b
+    static scalar_type angle(const vector3 &a, const vector3 &b) {
+        return std::acos(
+            std::clamp(vector::dot(a, b), scalar_type{-1.f}, scalar_type{1.f}));
+    }
+
+    /// @returns whether a track from the sphere at @param center with
+    /// @param radius in a direction inside the cone around @param axis with
+    /// @param opening angle and with a curvature of at most @param kappa can
+    /// reach the bounding sphere @param target
+    static bool is_reachable(const point3 &center, const scalar_type radius,
+                             const vector3 &axis, const scalar_type opening,
+                             const scalar_type kappa, const bounds &target) {
+        // Unbounded surfaces are always potential candidates
+        if (not std::isfinite(target.radius)) {
+            return true;
+        }
+        const vector3 diff = target.center - center;
+        const scalar_type dist{getter::norm(diff)};
+        const scalar_type r{radius + target.radius};
+        if (dist <= r) {
+            return true;
+        }
+        // Angular radius of the target, as seen from the cell
+        const scalar_type beta{std::asin(r / dist)};
+        // Angle between the initial direction and the chord of a circle
+        // with curvature kappa over the distance to the target
+        const scalar_type bending{
+            std::asin(std::min(scalar_type{1.f}, 0.5f * (dist + r) * kappa))};
+
+        return angle(axis, (1.f / dist) * diff) <= opening + beta + bending;
+    }
+
+    config m_cfg{};
+};
+
+}  // namespace detray
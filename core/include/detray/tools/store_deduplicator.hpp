@@ -0,0 +1,226 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/masks/masks.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_rod.hpp"
+#include "detray/materials/material_slab.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Combine the hash @param seed with the hash of the value @param v
+template <typename T>
+DETRAY_HOST inline void hash_combine(std::size_t &seed, const T &v) {
+    seed ^= std::hash<T>{}(v) + 0x9e3779b9u + (seed << 6) + (seed >> 2);
+}
+
+/// @returns the hash of the boundary values and volume link of a mask @param m
+template <typename shape_t, typename links_t, typename algebra_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST inline std::size_t entry_hash(
+    const mask<shape_t, links_t, algebra_t, array_t> &m) {
+    std::size_t seed{0u};
+    for (const auto v : m.values()) {
+        hash_combine(seed, v);
+    }
+    hash_combine(seed, m.volume_link());
+    return seed;
+}
+
+/// @returns whether the masks @param lhs and @param rhs can be shared
+template <typename shape_t, typename links_t, typename algebra_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST inline bool entry_equal(
+    const mask<shape_t, links_t, algebra_t, array_t> &lhs,
+    const mask<shape_t, links_t, algebra_t, array_t> &rhs) {
+    return lhs == rhs;
+}
+
+/// @returns the hash of the material parameters of @param mat
+template <typename scalar_t, typename R>
+DETRAY_HOST inline std::size_t material_hash(
+    const material<scalar_t, R> &mat) {
+    std::size_t seed{0u};
+    hash_combine(seed, mat.X0());
+    hash_combine(seed, mat.L0());
+    hash_combine(seed, mat.Ar());
+    hash_combine(seed, mat.Z());
+    hash_combine(seed, mat.mass_density());
+    hash_combine(seed, static_cast<int>(mat.state()));
+    return seed;
+}
+
+/// @returns whether the materials @param lhs and @param rhs are the same,
+/// including the density and state (not compared by @c material::operator== )
+template <typename scalar_t, typename R>
+DETRAY_HOST inline bool material_equal(const material<scalar_t, R> &lhs,
+                                       const material<scalar_t, R> &rhs) {
+    return lhs == rhs and lhs.mass_density() == rhs.mass_density() and
+           lhs.state() == rhs.state();
+}
+
+/// @returns the hash of the material and thickness of a slab @param slab
+template <typename scalar_t>
+DETRAY_HOST inline std::size_t entry_hash(
+    const material_slab<scalar_t> &slab) {
+    std::size_t seed{material_hash(slab.get_material())};
+    hash_combine(seed, slab.thickness());
+    return seed;
+}
+
+/// @returns whether the slabs @param lhs and @param rhs can be shared
+template <typename scalar_t>
+DETRAY_HOST inline bool entry_equal(const material_slab<scalar_t> &lhs,
+                                    const material_slab<scalar_t> &rhs) {
+    return material_equal(lhs.get_material(), rhs.get_material()) and
+           lhs.thickness() == rhs.thickness();
+}
+
+/// @returns the hash of the material and radius of a rod @param rod
+template <typename scalar_t>
+DETRAY_HOST inline std::size_t entry_hash(const material_rod<scalar_t> &rod) {
+    std::size_t seed{material_hash(rod.get_material())};
+    hash_combine(seed, rod.radius());
+    return seed;
+}
+
+/// @returns whether the rods @param lhs and @param rhs can be shared
+template <typename scalar_t>
+DETRAY_HOST inline bool entry_equal(const material_rod<scalar_t> &lhs,
+                                    const material_rod<scalar_t> &rhs) {
+    return material_equal(lhs.get_material(), rhs.get_material()) and
+           lhs.radius() == rhs.radius();
+}
+
+/// Checks whether the entries of a store collection can be deduplicated
+/// @{
+template <typename T, typename = void>
+struct is_deduplicable : public std::false_type {};
+
+template <typename T>
+struct is_deduplicable<
+    T, std::void_t<decltype(entry_hash(std::declval<const T &>()))>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_deduplicable_v = is_deduplicable<T>::value;
+/// @}
+
+}  // namespace detail
+
+/// @brief Merges identical masks and homogeneous materials in the stores of a
+/// volume and lets the surfaces share the remaining entries.
+///
+/// Masks are shared if their boundary values and volume links agree, material
+/// slabs and rods if their material parameters and thickness (radius) agree.
+/// Other store entries, like material maps, are left untouched. The surface
+/// links have to refer to the stores that are passed in, i.e. the pass needs
+/// to run before the stores are appended to the detector.
+struct store_deduplicator {
+
+    /// Deduplicate the masks @param masks of the surfaces @param surfaces
+    template <typename surface_container_t, typename mask_container_t>
+    DETRAY_HOST void operator()(surface_container_t &surfaces,
+                                mask_container_t &masks) const {
+        deduplicate(
+            masks, surfaces, [](auto &sf) -> auto & { return sf.mask(); },
+            std::make_index_sequence<mask_container_t::n_collections()>{});
+    }
+
+    /// Deduplicate the masks @param masks and materials @param materials of
+    /// the surfaces @param surfaces
+    template <typename surface_container_t, typename mask_container_t,
+              typename material_container_t>
+    DETRAY_HOST void operator()(surface_container_t &surfaces,
+                                mask_container_t &masks,
+                                material_container_t &materials) const {
+        (*this)(surfaces, masks);
+        deduplicate(
+            materials, surfaces,
+            [](auto &sf) -> auto & { return sf.material(); },
+            std::make_index_sequence<material_container_t::n_collections()>{});
+    }
+
+    private:
+    /// Deduplicate all collections of the store @param store
+    template <typename store_t, typename surface_container_t,
+              typename link_getter_t, std::size_t... I>
+    DETRAY_HOST static void deduplicate(store_t &store,
+                                        surface_container_t &surfaces,
+                                        link_getter_t link,
+                                        std::index_sequence<I...> /*seq*/) {
+        (deduplicate<store_t::value_types::to_id(I)>(store, surfaces, link),
+         ...);
+    }
+
+    /// Deduplicate the collection with id @tparam id of the store @param store
+    template <auto id, typename store_t, typename surface_container_t,
+              typename link_getter_t>
+    DETRAY_HOST static void deduplicate(store_t &store,
+                                        surface_container_t &surfaces,
+                                        link_getter_t link) {
+
+        using value_t = typename store_t::template get_type<id>;
+
+        if constexpr (detail::is_deduplicable_v<value_t>) {
+            auto &coll = store.template get<id>();
+
+            // New position of every entry
+            std::vector<dindex> new_index(coll.size());
+            // Unique entries by hash
+            std::unordered_map<std::size_t, std::vector<dindex>> unique;
+
+            dindex n_unique{0u};
+            for (std::size_t i = 0u; i < coll.size(); ++i) {
+                auto &candidates = unique[detail::entry_hash(coll[i])];
+
+                bool found{false};
+                for (const dindex j : candidates) {
+                    if (detail::entry_equal(coll[j], coll[i])) {
+                        new_index[i] = j;
+                        found = true;
+                        break;
+                    }
+                }
+                if (not found) {
+                    // Compact the collection in place
+                    if (n_unique != i) {
+                        coll[n_unique] = std::move(coll[i]);
+                    }
+                    candidates.push_back(n_unique);
+                    new_index[i] = n_unique++;
+                }
+            }
+            coll.erase(coll.begin() + n_unique, coll.end());
+
+            // Relink the surfaces
+            for (auto &sf : surfaces) {
+                auto &sf_link = link(sf);
+                if (sf_link.id() == id and sf_link.index() < new_index.size()) {
+                    sf_link.set_index(new_index[sf_link.index()]);
+                }
+            }
+        }
+    }
+};
+
+}  // namespace detray
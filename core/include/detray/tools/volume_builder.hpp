@@ -9,11 +9,13 @@
 
 // Project include(s).
 #include "detray/definitions/geometry.hpp"
+#include "detray/tools/store_deduplicator.hpp"
 #include "detray/tools/volume_builder_interface.hpp"
 
 // System include(s)
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace detray {
 
@@ -56,6 +58,28 @@ class volume_builder : public volume_builder_interface<detector_t> {
     DETRAY_HOST
     auto get_vol_index() -> dindex override { return m_volume->index(); }
 
+    /// Let surfaces with identical masks or homogeneous material share a
+    /// single store entry, when the volume is built (@param do_dedup )
+    DETRAY_HOST
+    void set_deduplication(const bool do_dedup = true) {
+        m_deduplicate = do_dedup;
+    }
+
+    /// Adds homogeneous material of type @tparam mat_id , constructed from
+    /// @param args , to the surface at position @param sf_idx in the volume
+    /// (in the order in which the surfaces were added by the factories)
+    template <typename detector_t::materials::id mat_id, typename... Args>
+    DETRAY_HOST void add_surface_material(const std::size_t sf_idx,
+                                          Args&&... args) {
+        using material_link_t =
+            typename detector_t::surface_type::material_link;
+
+        m_surfaces.at(sf_idx).material() =
+            material_link_t{mat_id, m_materials.template size<mat_id>()};
+        m_materials.template emplace_back<mat_id>({},
+                                                  std::forward<Args>(args)...);
+    }
+
     DETRAY_HOST
     auto operator()() const -> const
         typename detector_t::volume_type& override {
@@ -72,10 +96,14 @@ class volume_builder : public volume_builder_interface<detector_t> {
         m_volume->set_transform(det.transform_store().size());
         det.transform_store().push_back(m_trf);
 
+        if (m_deduplicate) {
+            store_deduplicator{}(m_surfaces, m_masks, m_materials);
+        }
         add_objects_per_volume(ctx, det);
         m_surfaces.clear();
         m_transforms.clear(ctx);
         m_masks.clear_all();
+        m_materials.clear_all();
 
         // Pass to decorator builders
         return m_volume;
@@ -137,12 +165,15 @@ class volume_builder : public volume_builder_interface<detector_t> {
         const auto trf_offset = det.transform_store().size(ctx);
         det.append_transforms(std::move(m_transforms), ctx);
 
-        // Update mask and transform index of surfaces and set a
+        // Update mask, material and transform index of surfaces and set a
         // unique barcode (index of surface in container)
         auto sf_offset{static_cast<dindex>(det.portals().size())};
         for (auto& sf : m_surfaces) {
             det.mask_store().template visit<detail::mask_index_update>(
                 sf.mask(), sf);
+            det.material_store()
+                .template visit<detail::material_index_update>(sf.material(),
+                                                               sf);
             sf.update_transform(trf_offset);
             sf.set_index(sf_offset++);
             det.add_surface_to_lookup(sf);
@@ -160,16 +191,20 @@ class volume_builder : public volume_builder_interface<detector_t> {
             default_acc_id,
             det.surface_store().template size<default_acc_id>() - 1u);
 
-        // Append masks
+        // Append masks and material
         det.append_masks(std::move(m_masks));
+        det.append_materials(std::move(m_materials));
     }
 
     typename detector_t::volume_type* m_volume{};
     typename detector_t::transform3 m_trf{};
+    /// Whether to merge identical masks and homogeneous material
+    bool m_deduplicate{false};
 
     typename detector_t::surface_container_t m_surfaces{};
     typename detector_t::transform_container m_transforms{};
     typename detector_t::mask_container m_masks{};
+    typename detector_t::material_container m_materials{};
 };
 
 namespace detail {
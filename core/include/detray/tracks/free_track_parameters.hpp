@@ -132,6 +132,11 @@ struct free_track_parameters {
     DETRAY_HOST_DEVICE
     scalar_type time() const { return track_helper().time(m_vector); }
 
+    DETRAY_HOST_DEVICE
+    void set_time(const scalar_type t) {
+        matrix_operator().element(m_vector, e_free_time, 0u) = t;
+    }
+
     DETRAY_HOST_DEVICE
     scalar_type charge() const { return track_helper().charge(m_vector); }
 
@@ -0,0 +1,119 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/materials/material.hpp"
+
+// System include(s)
+#include <type_traits>
+
+namespace detray::detail {
+
+/// Conversions between algebra types of different precision, e.g. between the
+/// detector geometry (float) and the track state (double). Calling them with
+/// the matching algebra type is a no-op.
+/// @{
+
+/// @returns the 3D vector @param v in the algebra @tparam dst_transform3_t
+template <typename dst_transform3_t, typename vector3_t>
+DETRAY_HOST_DEVICE inline auto cast_vector3(const vector3_t &v) ->
+    typename dst_transform3_t::vector3 {
+    using dst_vector3_t = typename dst_transform3_t::vector3;
+    using scalar_t = typename dst_transform3_t::scalar_type;
+
+    if constexpr (std::is_same_v<vector3_t, dst_vector3_t>) {
+        return v;
+    } else {
+        return {static_cast<scalar_t>(v[0]), static_cast<scalar_t>(v[1]),
+                static_cast<scalar_t>(v[2])};
+    }
+}
+
+/// @returns the 3D point @param p in the algebra @tparam dst_transform3_t
+template <typename dst_transform3_t, typename point3_t>
+DETRAY_HOST_DEVICE inline auto cast_point3(const point3_t &p) ->
+    typename dst_transform3_t::point3 {
+    using dst_point3_t = typename dst_transform3_t::point3;
+    using scalar_t = typename dst_transform3_t::scalar_type;
+
+    if constexpr (std::is_same_v<point3_t, dst_point3_t>) {
+        return p;
+    } else {
+        return {static_cast<scalar_t>(p[0]), static_cast<scalar_t>(p[1]),
+                static_cast<scalar_t>(p[2])};
+    }
+}
+
+/// @returns the transform @param trf in the algebra @tparam dst_transform3_t
+/// (a reference to @param trf if no conversion is needed)
+template <typename dst_transform3_t, typename transform3_t>
+DETRAY_HOST_DEVICE inline decltype(auto) cast_transform3(
+    const transform3_t &trf) {
+
+    if constexpr (std::is_same_v<transform3_t, dst_transform3_t>) {
+        return (trf);
+    } else {
+        return dst_transform3_t{cast_vector3<dst_transform3_t>(
+                                    trf.translation()),
+                                cast_vector3<dst_transform3_t>(trf.x()),
+                                cast_vector3<dst_transform3_t>(trf.y()),
+                                cast_vector3<dst_transform3_t>(trf.z())};
+    }
+}
+
+/// @returns the material @param mat in the precision @tparam dst_scalar_t
+template <typename dst_scalar_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline material<dst_scalar_t> cast_material(
+    const material<scalar_t> &mat) {
+    return {static_cast<dst_scalar_t>(mat.X0()),
+            static_cast<dst_scalar_t>(mat.L0()),
+            static_cast<dst_scalar_t>(mat.Ar()),
+            static_cast<dst_scalar_t>(mat.Z()),
+            static_cast<dst_scalar_t>(mat.mass_density()), mat.state()};
+}
+/// @}
+
+/// @brief Hands out the surface placements in the algebra @tparam transform3_t
+///
+/// If the transform store does not hand out references to transforms of the
+/// requested type (different precision or compact placements), the transform
+/// of the current surface is converted once and kept until the track moves
+/// on to another surface. This way, the covariance transport and the
+/// parameter reset on the same surface share the conversion.
+template <typename transform3_t>
+struct transform3_cache {
+
+    /// @returns the transform at @param trf_idx in @param trf_store in the
+    /// algebra @tparam transform3_t
+    template <typename transform_store_t>
+    DETRAY_HOST_DEVICE inline decltype(auto) operator()(
+        const transform_store_t &trf_store, const dindex trf_idx) {
+
+        using stored_t = decltype(trf_store[trf_idx]);
+
+        if constexpr (std::is_same_v<stored_t, const transform3_t &>) {
+            return trf_store[trf_idx];
+        } else {
+            if (trf_idx != m_trf_idx) {
+                m_trf = cast_transform3<transform3_t>(trf_store[trf_idx]);
+                m_trf_idx = trf_idx;
+            }
+            return static_cast<const transform3_t &>(m_trf);
+        }
+    }
+
+    /// Index of the cached transform in the store
+    dindex m_trf_idx{dindex_invalid};
+    /// The converted transform
+    transform3_t m_trf{};
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,33 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s)
+#include <cstddef>
+
+namespace detray::detail {
+
+/// Calls a functor for every index in [0, n) on the calling thread.
+///
+/// Host tools that can distribute independent work items (e.g. the bin
+/// association or the detector assembler) take a loop of this signature as
+/// argument. Threaded loops are injected by the caller, so that detray::core
+/// does not spawn threads itself.
+struct serial_for_each {
+    template <typename fn_t>
+    DETRAY_HOST void operator()(const std::size_t n, fn_t &&fn) const {
+        for (std::size_t i = 0u; i < n; ++i) {
+            fn(i);
+        }
+    }
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,384 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/telemetry.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/navigator.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+#include <x86intrin.h>
+#endif
+
+namespace detray::telemetry {
+
+/// Per track counters
+enum class counter : unsigned int {
+    e_steps = 0u,
+    e_rk_trials = 1u,
+    e_field_lookups = 2u,
+    e_inits = 3u,
+    e_intersections_tested = 4u,
+    e_intersections_accepted = 5u,
+    e_candidates_sorted = 6u,
+    // Changes of the navigation trust level
+    e_no_trust_transitions = 7u,
+    e_fair_trust_transitions = 8u,
+    e_high_trust_transitions = 9u,
+    e_full_trust_transitions = 10u,
+    e_volume_switches = 11u,
+    e_stepper_ticks = 12u,
+    e_navigator_ticks = 13u,
+    e_actor_ticks = 14u,
+    e_size = 15u,
+};
+
+/// Number of counters per track
+inline constexpr std::size_t n_counters{
+    static_cast<std::size_t>(counter::e_size)};
+
+/// Names of the counters in the JSON output
+inline constexpr std::array<const char *, n_counters> counter_names{
+    "steps",
+    "rk_trials",
+    "field_lookups",
+    "inits",
+    "intersections_tested",
+    "intersections_accepted",
+    "candidates_sorted",
+    "no_trust_transitions",
+    "fair_trust_transitions",
+    "high_trust_transitions",
+    "full_trust_transitions",
+    "volume_switches",
+    "stepper_ticks",
+    "navigator_ticks",
+    "actor_ticks"};
+
+/// Counter values of a single track
+using track_counters = std::array<std::uint64_t, n_counters>;
+
+/// @returns the current value of the time stamp counter (or of a steady
+/// clock in nanoseconds, if no time stamp counter is available)
+DETRAY_HOST inline std::uint64_t ticks() {
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+    return static_cast<std::uint64_t>(__rdtsc());
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+}
+
+/// @brief Histogram of a counter over many tracks.
+///
+/// The values are binned in powers of two: Bin 0 holds the value zero and
+/// bin i the values in [2^(i-1), 2^i).
+struct histogram {
+
+    static constexpr std::size_t n_bins{65u};
+
+    std::array<std::uint64_t, n_bins> bins{};
+    std::uint64_t n_entries{0u};
+    std::uint64_t sum{0u};
+    std::uint64_t min{std::numeric_limits<std::uint64_t>::max()};
+    std::uint64_t max{0u};
+
+    /// Add the value @param v
+    DETRAY_HOST
+    void fill(const std::uint64_t v) {
+        std::size_t bin{0u};
+        for (std::uint64_t x = v; x > 0u; x >>= 1u) {
+            ++bin;
+        }
+        ++bins[bin];
+        ++n_entries;
+        sum += v;
+        min = std::min(min, v);
+        max = std::max(max, v);
+    }
+
+    /// Add the entries of another histogram @param other
+    DETRAY_HOST
+    void merge(const histogram &other) {
+        for (std::size_t i = 0u; i < n_bins; ++i) {
+            bins[i] += other.bins[i];
+        }
+        n_entries += other.n_entries;
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+
+    /// @returns the mean value
+    DETRAY_HOST
+    double mean() const {
+        return n_entries == 0u ? 0.
+                               : static_cast<double>(sum) /
+                                     static_cast<double>(n_entries);
+    }
+};
+
+/// @brief Aggregates the counters of many tracks (one recorder per thread).
+class recorder {
+
+    public:
+    /// Add the counters of a finished track @param counters
+    DETRAY_HOST
+    void add(const track_counters &counters) {
+        for (std::size_t i = 0u; i < n_counters; ++i) {
+            m_histograms[i].fill(counters[i]);
+        }
+        ++m_n_tracks;
+    }
+
+    /// Add the tracks of another recorder @param other (e.g. of a different
+    /// thread)
+    DETRAY_HOST
+    void merge(const recorder &other) {
+        for (std::size_t i = 0u; i < n_counters; ++i) {
+            m_histograms[i].merge(other.m_histograms[i]);
+        }
+        m_n_tracks += other.m_n_tracks;
+    }
+
+    /// @returns the number of recorded tracks
+    DETRAY_HOST
+    std::uint64_t n_tracks() const { return m_n_tracks; }
+
+    /// @returns the histogram of the counter @param c
+    DETRAY_HOST
+    const histogram &get(const counter c) const {
+        return m_histograms[static_cast<std::size_t>(c)];
+    }
+
+    /// Write the histograms to @param os in JSON format
+    DETRAY_HOST
+    void write_json(std::ostream &os) const {
+        os << "{\n  \"n_tracks\": " << m_n_tracks << ",\n";
+        os << "  \"binning\": \"log2\",\n  \"counters\": {";
+        for (std::size_t i = 0u; i < n_counters; ++i) {
+            const histogram &h = m_histograms[i];
+            os << (i == 0u ? "\n" : ",\n") << "    \"" << counter_names[i]
+               << "\": {\"sum\": " << h.sum
+               << ", \"min\": " << (h.n_entries == 0u ? 0u : h.min)
+               << ", \"max\": " << h.max << ", \"mean\": " << h.mean()
+               << ", \"histogram\": [";
+            // Skip the empty bins at the end
+            std::size_t n_filled{h.n_bins};
+            while (n_filled > 0u and h.bins[n_filled - 1u] == 0u) {
+                --n_filled;
+            }
+            for (std::size_t b = 0u; b < n_filled; ++b) {
+                os << (b == 0u ? "" : ", ") << h.bins[b];
+            }
+            os << "]}";
+        }
+        os << "\n  }\n}\n";
+    }
+
+    /// @returns the JSON representation of the histograms
+    DETRAY_HOST
+    std::string to_json() const {
+        std::stringstream stream{};
+        write_json(stream);
+        return stream.str();
+    }
+
+    private:
+    std::array<histogram, n_counters> m_histograms{};
+    std::uint64_t m_n_tracks{0u};
+};
+
+/// @brief Navigation inspector that counts the work done per track.
+///
+/// Is called by the navigator and the propagator through the telemetry hooks.
+/// The counters of a track are handed to a @c recorder by the propagator at
+/// the end of the propagation (see @c flush ). The recorder is connected by
+/// the @c collector actor.
+///
+/// @tparam enable_timers measure the time spent in the stepper, navigator
+///                       and actor stages (in time stamp counter ticks)
+template <bool enable_timers = false>
+struct inspector {
+
+    static constexpr bool is_telemetry_inspector{true};
+
+    track_counters counters{};
+
+    /// Inspector interface (nothing to be done on the debug messages)
+    template <typename state_t>
+    DETRAY_HOST void operator()(const state_t & /*navigation*/,
+                                const char * /*message*/) {}
+
+    /// Count the candidates that were tested (@param n_tested ), that are
+    /// reachable (@param n_accepted ) and that were sorted (@param n_sorted )
+    /// during a navigation update. A volume initialization is flagged by
+    /// @param is_init .
+    template <typename state_t, typename tested_t, typename accepted_t,
+              typename sorted_t>
+    DETRAY_HOST void count_intersections(const state_t &navigation,
+                                         const tested_t n_tested,
+                                         const accepted_t n_accepted,
+                                         const sorted_t n_sorted,
+                                         const bool is_init) {
+        add(counter::e_intersections_tested, n_tested);
+        add(counter::e_intersections_accepted, n_accepted);
+        add(counter::e_candidates_sorted, n_sorted);
+
+        if (is_init) {
+            add(counter::e_inits, 1u);
+            const auto volume{static_cast<dindex>(navigation.volume())};
+            if (m_volume != dindex_invalid and volume != m_volume) {
+                add(counter::e_volume_switches, 1u);
+            }
+            m_volume = volume;
+        }
+    }
+
+    /// The propagation enters the stage @param s
+    template <typename state_t>
+    DETRAY_HOST void begin_stage(const stage s, const state_t &navigation) {
+        if (s == stage::e_stepper) {
+            add(counter::e_steps, 1u);
+        } else if (s == stage::e_navigator and
+                   navigation.trust_level() != m_trust_level) {
+            // Only count the changes of the trust level, not every update
+            m_trust_level = navigation.trust_level();
+            switch (m_trust_level) {
+                case navigation::trust_level::e_no_trust:
+                    add(counter::e_no_trust_transitions, 1u);
+                    break;
+                case navigation::trust_level::e_fair:
+                    add(counter::e_fair_trust_transitions, 1u);
+                    break;
+                case navigation::trust_level::e_high:
+                    add(counter::e_high_trust_transitions, 1u);
+                    break;
+                case navigation::trust_level::e_full:
+                    add(counter::e_full_trust_transitions, 1u);
+                    break;
+            };
+        }
+
+        if constexpr (enable_timers) {
+            const std::uint64_t now{ticks()};
+            if (m_stage != stage::e_none) {
+                add(static_cast<counter>(
+                        static_cast<unsigned int>(counter::e_stepper_ticks) +
+                        static_cast<unsigned int>(m_stage)),
+                    now - m_start);
+            }
+            m_start = now;
+        }
+        m_stage = s;
+    }
+
+    /// Hand the counters to the recorder @param rec at the end of the
+    /// propagation
+    DETRAY_HOST
+    void set_recorder(recorder *rec) { m_recorder = rec; }
+
+    /// The propagation has finished: Add the work done by the stepper in the
+    /// state @param stepping and hand the counters to the recorder. If no
+    /// recorder is connected, the counters are kept for inspection.
+    template <typename stepping_t>
+    DETRAY_HOST void flush(const stepping_t &stepping) {
+        if constexpr (stepping_t::id == detray::stepping::id::e_rk) {
+            // Only if the stepper counts its work
+            if constexpr (stepping_t::has_telemetry) {
+                add(counter::e_rk_trials, stepping._n_rk_trials);
+                add(counter::e_field_lookups, stepping._n_field_lookups);
+            }
+        }
+
+        if (m_recorder != nullptr) {
+            m_recorder->add(counters);
+            reset();
+        }
+    }
+
+    /// @returns the value of the counter @param c
+    DETRAY_HOST
+    std::uint64_t get(const counter c) const {
+        return counters[static_cast<std::size_t>(c)];
+    }
+
+    /// Add @param n to the counter @param c
+    template <typename value_t>
+    DETRAY_HOST void add(const counter c, const value_t n) {
+        counters[static_cast<std::size_t>(c)] += static_cast<std::uint64_t>(n);
+    }
+
+    /// Reset all counters for the next track
+    DETRAY_HOST
+    void reset() {
+        counters = {};
+        m_volume = dindex_invalid;
+        m_trust_level = navigation::trust_level::e_no_trust;
+        m_stage = stage::e_none;
+    }
+
+    private:
+    /// Recorder that receives the counters of the finished track
+    recorder *m_recorder{nullptr};
+    /// Volume of the last initialization
+    dindex m_volume{dindex_invalid};
+    /// Trust level at the last navigation update (a new track starts
+    /// without trust)
+    navigation::trust_level m_trust_level{navigation::trust_level::e_no_trust};
+    /// Current stage of the propagation loop
+    stage m_stage{stage::e_none};
+    /// Time stamp of the stage begin
+    std::uint64_t m_start{0u};
+};
+
+/// @brief Actor that connects the telemetry inspector of the navigator to a
+/// (per thread) recorder.
+///
+/// The propagator hands the counters of a track to the recorder once the
+/// propagation has finished, so that the last navigation update and the
+/// tracks that leave the detector in it are recorded as well.
+struct collector : detray::actor {
+
+    struct state {
+        /// Per thread recorder
+        recorder *m_recorder{nullptr};
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST void operator()(state &collector_state,
+                                propagator_state_t &prop_state) const {
+
+        auto &tel = prop_state._navigation.inspector();
+
+        static_assert(is_enabled_v<detail::remove_cvref_t<decltype(tel)>>,
+                      "The navigator needs a telemetry inspector");
+
+        tel.set_recorder(collector_state.m_recorder);
+    }
+};
+
+}  // namespace detray::telemetry
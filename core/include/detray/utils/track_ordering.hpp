@@ -0,0 +1,200 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Number of bits per dimension in the 3D Morton code
+inline constexpr unsigned int n_morton_bits{10u};
+
+/// Spread the lower 10 bits of @param x so that there are two zero bits
+/// between every bit of the input
+DETRAY_HOST_DEVICE constexpr std::uint32_t spread_bits_3d(std::uint32_t x) {
+    x &= 0x000003ffu;
+    x = (x | (x << 16u)) & 0x030000ffu;
+    x = (x | (x << 8u)) & 0x0300f00fu;
+    x = (x | (x << 4u)) & 0x030c30c3u;
+    x = (x | (x << 2u)) & 0x09249249u;
+    return x;
+}
+
+/// @returns the 30 bit Morton code (Z-order) of the 10 bit integer
+/// coordinates @param x , @param y and @param z
+DETRAY_HOST_DEVICE constexpr std::uint32_t morton_key_3d(
+    const std::uint32_t x, const std::uint32_t y, const std::uint32_t z) {
+    return (spread_bits_3d(x) << 2u) | (spread_bits_3d(y) << 1u) |
+           spread_bits_3d(z);
+}
+
+/// @returns the value @param v in the range [ @param min, @param max ]
+/// quantized to a 10 bit integer (values outside the range are clamped)
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline std::uint32_t quantize(const scalar_t v,
+                                                 const scalar_t min,
+                                                 const scalar_t max) {
+    constexpr scalar_t n_bins{static_cast<scalar_t>((1u << n_morton_bits) -
+                                                    1u)};
+    // Also catches NaN
+    const scalar_t u{(v - min) / (max - min)};
+    if (not(u > 0.f)) {
+        return 0u;
+    }
+    return static_cast<std::uint32_t>(u < 1.f ? u * n_bins : n_bins);
+}
+
+}  // namespace detail
+
+/// @brief Orders a batch of tracks by the region of the detector they start
+/// out in.
+///
+/// The tracks are binned by their starting volume first and then by eta, phi
+/// and momentum, which are combined into a Morton key. Neighbouring tracks
+/// in the sorted batch therefore visit similar surfaces and field regions,
+/// which improves the cache reuse between the threads of a CPU run and
+/// reduces the divergence within a warp on the device.
+///
+/// The sorting is a pre-pass over the batch: @c order returns the
+/// permutation, with which the tracks are reordered by @c apply . The
+/// results of the propagation can be put back into the original order of
+/// the batch with @c restore .
+///
+/// @note the track positions have to be contained in the detector world
+///
+/// @tparam detector_t the detector type (needs to provide @c volume_by_pos )
+template <typename detector_t>
+class track_sorter {
+
+    using scalar_type = typename detector_t::scalar_type;
+
+    public:
+    /// The sort key of a track
+    using key_type = std::uint64_t;
+    /// Maps the position in the sorted batch to the original position
+    using permutation_type = std::vector<dindex>;
+
+    /// Ranges of the track parameters that are used for the Morton key
+    struct config {
+        scalar_type eta_min{-4.f};
+        scalar_type eta_max{4.f};
+        scalar_type p_min{0.1f * unit<scalar_type>::GeV};
+        scalar_type p_max{1.f * unit<scalar_type>::TeV};
+    };
+
+    /// Construct from the detector @param det and the key config @param cfg
+    DETRAY_HOST
+    explicit track_sorter(const detector_t &det, const config &cfg = {})
+        : m_detector{det}, m_cfg{cfg} {}
+
+    /// @returns the configuration
+    DETRAY_HOST
+    const config &get_config() const { return m_cfg; }
+
+    /// @returns the sort key of @param track : The index of the starting
+    /// volume in the upper 32 bits, followed by the Morton key of the
+    /// quantized eta, phi and log(p)
+    template <typename track_t>
+    DETRAY_HOST key_type key(const track_t &track) const {
+        const auto pos = track.pos();
+        const auto dir = track.dir();
+
+        const dindex vol_idx{
+            m_detector.volume_by_pos({pos[0], pos[1], pos[2]}).index()};
+
+        const auto theta{static_cast<scalar_type>(getter::theta(dir))};
+        const auto phi{static_cast<scalar_type>(getter::phi(dir))};
+        const auto p{static_cast<scalar_type>(track.p())};
+
+        const scalar_type eta{-math_ns::log(math_ns::tan(0.5f * theta))};
+
+        const std::uint32_t morton{detail::morton_key_3d(
+            detail::quantize(eta, m_cfg.eta_min, m_cfg.eta_max),
+            detail::quantize(phi, -constant<scalar_type>::pi,
+                             constant<scalar_type>::pi),
+            detail::quantize(math_ns::log(p), math_ns::log(m_cfg.p_min),
+                             math_ns::log(m_cfg.p_max)))};
+
+        return (static_cast<key_type>(vol_idx) << 32u) | morton;
+    }
+
+    /// @returns the permutation that sorts the tracks in @param tracks by
+    /// their keys. Tracks with the same key keep their relative order.
+    template <typename track_container_t>
+    DETRAY_HOST permutation_type order(const track_container_t &tracks) const {
+
+        std::vector<std::pair<key_type, dindex>> keys;
+        keys.reserve(tracks.size());
+        for (std::size_t i = 0u; i < tracks.size(); ++i) {
+            keys.emplace_back(key(tracks[i]), static_cast<dindex>(i));
+        }
+        // The index breaks ties, the sort is therefore stable
+        std::sort(keys.begin(), keys.end());
+
+        permutation_type perm;
+        perm.reserve(keys.size());
+        for (const auto &entry : keys) {
+            perm.push_back(entry.second);
+        }
+        return perm;
+    }
+
+    /// Sort the tracks in @param tracks in place
+    ///
+    /// @returns the permutation that is needed to restore the original order
+    template <typename track_container_t>
+    DETRAY_HOST permutation_type operator()(track_container_t &tracks) const {
+        permutation_type perm{order(tracks)};
+        apply(tracks, perm);
+        return perm;
+    }
+
+    /// Reorder the elements of @param coll according to @param perm
+    template <typename container_t>
+    DETRAY_HOST static void apply(container_t &coll,
+                                  const permutation_type &perm) {
+        // Copy the container to keep its allocator
+        const container_t unsorted{coll};
+        for (std::size_t i = 0u; i < perm.size(); ++i) {
+            coll[i] = unsorted[perm[i]];
+        }
+    }
+
+    /// Put the elements of @param coll , which were reordered according to
+    /// @param perm , back into their original order (e.g. the results of
+    /// the propagation)
+    template <typename container_t>
+    DETRAY_HOST static void restore(container_t &coll,
+                                    const permutation_type &perm) {
+        const container_t sorted{coll};
+        for (std::size_t i = 0u; i < perm.size(); ++i) {
+            coll[perm[i]] = sorted[i];
+        }
+    }
+
+    private:
+    /// Detector in which the tracks start
+    const detector_t &m_detector;
+    /// Ranges of the track parameters
+    config m_cfg;
+};
+
+}  // namespace detray
@@ -0,0 +1,96 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace detray::detail {
+
+/// Call @param fn for every index in [0, @param n) on @param n_threads host
+/// threads.
+///
+/// The indices are handed out one at a time, so that the work items can
+/// differ in size. The first exception that is thrown by a worker is
+/// rethrown on the calling thread.
+template <typename fn_t>
+DETRAY_HOST inline void parallel_for(const std::size_t n,
+                                     const std::size_t n_threads, fn_t &&fn) {
+
+    const std::size_t n_workers{std::min(n_threads, n)};
+
+    if (n_workers <= 1u) {
+        for (std::size_t i = 0u; i < n; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next{0u};
+    std::vector<std::exception_ptr> errors(n_workers);
+
+    auto worker = [&next, &fn, n](std::exception_ptr &error) {
+        try {
+            for (std::size_t i = next++; i < n; i = next++) {
+                fn(i);
+            }
+        } catch (...) {
+            error = std::current_exception();
+            // Let the other workers run out
+            next = n;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(n_workers - 1u);
+    for (std::size_t t = 1u; t < n_workers; ++t) {
+        workers.emplace_back(worker, std::ref(errors[t]));
+    }
+    worker(errors[0]);
+
+    for (auto &w : workers) {
+        w.join();
+    }
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/// @returns the default number of host threads
+DETRAY_HOST inline std::size_t default_n_threads() {
+    return std::max(std::size_t{std::thread::hardware_concurrency()},
+                    std::size_t{1u});
+}
+
+/// Calls a functor for every index in [0, n) on a number of host threads.
+///
+/// Can be injected into the host tools in detray::core that take a
+/// @c serial_for_each loop by default.
+struct threaded_for_each {
+    template <typename fn_t>
+    DETRAY_HOST void operator()(const std::size_t n, fn_t &&fn) const {
+        parallel_for(n, n_threads, std::forward<fn_t>(fn));
+    }
+
+    /// Number of worker threads
+    std::size_t n_threads{default_n_threads()};
+};
+
+}  // namespace detray::detail
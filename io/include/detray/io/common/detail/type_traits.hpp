@@ -12,6 +12,7 @@
 #include "detray/io/common/detail/definitions.hpp"
 #include "detray/io/common/payloads.hpp"
 #include "detray/masks/masks.hpp"
+#include "detray/materials/material_map.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/utils/tuple_helpers.hpp"
@@ -19,6 +20,7 @@
 
 // System include(s)
 #include <type_traits>
+#include <utility>
 
 namespace detray::detail {
 
@@ -175,4 +177,58 @@ template <typename T>
 inline constexpr bool is_homogeneous_material_v =
     is_homogeneous_material<T>::value;
 
+/// Does the detector material store contain material maps
+/// @{
+template <class detector_t, std::size_t... I>
+constexpr bool has_material_maps(std::index_sequence<I...>) {
+    using mat_tuple_t = typename detector_t::material_container::tuple_type;
+
+    return (is_material_map_v<
+                typename detail::tuple_element_t<I, mat_tuple_t>::value_type> ||
+            ...);
+}
+
+template <class detector_t>
+inline constexpr bool has_material_maps_v = has_material_maps<detector_t>(
+    std::make_index_sequence<
+        detector_t::material_container::n_collections()>{});
+/// @}
+
+/// Check whether the material map @tparam map_t is binned in the local
+/// coordinates of the shape @tparam shape_t
+template <typename shape_t, typename map_t>
+inline constexpr bool is_material_map_of_v = std::is_same_v<
+    map_t, material_map<typename shape_t::template axes<>,
+                        typename map_t::value_type::scalar_type,
+                        typename map_t::container_types, map_t::is_owning>>;
+
+/// @returns the io material type id of the material type @tparam material_t
+///
+/// @note annulus and trapezoid maps have the same type as ring and rectangle
+/// maps, respectively, since they share the local coordinate axes.
+template <typename material_t>
+constexpr io::detail::material_type get_material_type() {
+    using type_id = io::detail::material_type;
+    using scalar_t = typename material_t::scalar_type;
+
+    if constexpr (std::is_same_v<material_t, material_slab<scalar_t>>) {
+        return type_id::slab;
+    } else if constexpr (std::is_same_v<material_t, material_rod<scalar_t>>) {
+        return type_id::rod;
+    } else if constexpr (is_material_map_v<material_t>) {
+        if constexpr (is_material_map_of_v<cylinder2D<>, material_t>) {
+            return type_id::cylinder2;
+        } else if constexpr (is_material_map_of_v<rectangle2D<>, material_t>) {
+            return type_id::rectangle2;
+        } else if constexpr (is_material_map_of_v<ring2D<>, material_t>) {
+            return type_id::ring2;
+        } else {
+            return type_id::unknown;
+        }
+    } else {
+        // E.g. volume material
+        return type_id::unknown;
+    }
+}
+
 }  // namespace detray::detail
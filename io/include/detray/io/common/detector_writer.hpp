@@ -88,7 +88,9 @@ detail::detector_component_writers<detector_t> assemble_writer(
                 writers.template add<json_homogeneous_material_writer>();
             }
             // Material maps
-            // ...
+            if constexpr (detail::has_material_maps_v<detector_t>) {
+                writers.template add<json_material_map_writer>();
+            }
         }
 
         // Grids
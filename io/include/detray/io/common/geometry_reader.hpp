@@ -9,16 +9,21 @@
 
 // Project include(s)
 #include "detray/definitions/indexing.hpp"
+#include "detray/io/common/detail/parallel_for.hpp"
 #include "detray/io/common/detail/type_traits.hpp"
 #include "detray/io/common/io_interface.hpp"
 #include "detray/io/common/payloads.hpp"
+#include "detray/tools/detector_assembler.hpp"
 #include "detray/tools/surface_factory.hpp"
-#include "detray/tools/volume_builder.hpp"
+#include "detray/utils/ranges.hpp"
 
 // System include(s)
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <map>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -56,76 +61,158 @@ class geometry_reader : public reader_interface<detector_t> {
     /// Gets compile-time mask information
     template <mask_shape shape>
     using mask_info = detail::mask_info<shape, detector_t>;
+    /// Material link of the surfaces
+    using material_link_t = typename detector_t::surface_type::material_link;
+    using mat_types = typename detector_t::material_container::value_types;
+    /// Volume-local data that is merged into the detector
+    using fragment_t = volume_fragment<detector_t>;
 
     protected:
     /// Tag the reader as "geometry"
     inline static const std::string tag = "geometry";
+    /// Payload type of the file header
+    using header_type = geo_header_payload;
 
     public:
     /// Same constructors for this class as for base_type
     using base_type::base_type;
 
+    /// Let the surfaces of a volume with identical masks share a single mask
+    /// (@param do_dedup ). This restores the sharing of a detector that was
+    /// deduplicated when it was built, since the masks are written per surface
+    void set_deduplication(const bool do_dedup = true) {
+        m_deduplicate = do_dedup;
+    }
+
+    /// Fail on surface material links that cannot be resolved in the material
+    /// store of the detector (@param strict ). By default, these surfaces are
+    /// read without material, e.g. if only the geometry of a file is needed
+    void set_strict_material_links(const bool strict = true) {
+        m_strict_material = strict;
+    }
+
     protected:
     /// Deserialize a detector @param det from its io payload @param det_data
     /// and add the volume names to @param name_map
-    static void deserialize(detector_t& det,
-                            typename detector_t::name_map& /*name_map*/,
-                            const detector_payload& det_data) {
+    void deserialize(detector_t& det,
+                     typename detector_t::name_map& /*name_map*/,
+                     const detector_payload& det_data) const {
 
         // @todo Add volume grid
 
-        // Deserialize the volumes one-by-one
+        std::vector<volume_id> vol_ids;
+        vol_ids.reserve(det_data.volumes.size());
         for (const auto& vol_data : det_data.volumes) {
-            // Get a generic volume builder first and decorate it later
-            volume_builder<detector_t> vbuilder{};
-
-            vbuilder.init_vol(det, static_cast<volume_id>(vol_data.type));
+            vol_ids.push_back(static_cast<volume_id>(vol_data.type));
+        }
 
-            // @todo add the volume placement, once it can be checked for the
-            // test detectors
+        // Build the volumes concurrently and merge them into the detector
+        detector_assembler<detector_t, detail::threaded_for_each> assembler{};
+        assembler(det, vol_ids,
+                  [this, &det, &det_data](fragment_t& frag,
+                                          const std::size_t i) {
+                      deserialize(det, frag, det_data.volumes[i],
+                                  m_strict_material);
+                      if (m_deduplicate) {
+                          frag.deduplicate();
+                      }
+                  });
+    }
 
-            // Prepare the surface factories (one per shape and surface type)
-            std::map<std::pair<surface_id, mask_shape>, sf_factory_ptr_t>
-                sf_factories;
+    /// Register the incremental deserialization of the volumes of a detector
+    /// @param det with the payload @param stream : Every volume is built as
+    /// soon as its payload is complete
+    template <typename stream_t>
+    void deserialize_streamed(detector_t& det,
+                              typename detector_t::name_map& /*name_map*/,
+                              stream_t& stream) const {
+
+        stream.template for_each<volume_payload>(
+            "volumes", [this, &det](const volume_payload& vol_data) {
+                // Only a single volume is available at a time
+                detector_assembler<detector_t> assembler{};
+                assembler(det, {static_cast<volume_id>(vol_data.type)},
+                          [this, &det, &vol_data](fragment_t& frag,
+                                                  const std::size_t /*i*/) {
+                              deserialize(det, frag, vol_data,
+                                          m_strict_material);
+                              if (m_deduplicate) {
+                                  frag.deduplicate();
+                              }
+                          });
+            });
+    }
 
-            // Add the surfaces to the factories
-            for (const auto& sf_data : vol_data.surfaces) {
+    /// Check the header @param header_data of a streamed file against the
+    /// number of volumes that were read from @param stream
+    template <typename stream_t>
+    static void check_header(const header_type& header_data,
+                             const stream_t& stream) {
+        const std::size_t n_volumes{stream.n_elements("volumes")};
+        if (header_data.n_volumes != n_volumes) {
+            throw std::runtime_error(
+                "Geometry file: Header lists " +
+                std::to_string(header_data.n_volumes) + " volumes, but " +
+                std::to_string(n_volumes) + " were read");
+        }
+    }
 
-                const mask_payload& mask_data = sf_data.mask;
+    /// Deserialize a single volume from its io payload @param vol_data into
+    /// the volume fragment @param frag . Unresolved material links throw,
+    /// if @param strict_material is set
+    ///
+    /// @note Only reads from the detector @param det , so that the volumes
+    /// can be deserialized concurrently
+    static void deserialize(const detector_t& det, fragment_t& frag,
+                            const volume_payload& vol_data,
+                            const bool strict_material = false) {
+
+        // @todo add the volume placement, once it can be checked for the
+        // test detectors
+
+        // Prepare the surface factories (one per shape and surface type)
+        std::map<std::pair<surface_id, mask_shape>, sf_factory_ptr_t>
+            sf_factories;
+        // Material links of the surfaces, in the same order as the factories
+        std::map<std::pair<surface_id, mask_shape>,
+                 std::vector<material_link_t>>
+            sf_materials;
+
+        // Add the surfaces to the factories
+        for (const auto& sf_data : vol_data.surfaces) {
+
+            const mask_payload& mask_data = sf_data.mask;
+
+            // Check if a fitting factory already exists. If not, add it
+            // dynamically
+            const auto key = std::make_pair(sf_data.type, mask_data.shape);
+            if (auto search = sf_factories.find(key);
+                search == sf_factories.end()) {
+                sf_factories[key] =
+                    std::move(init_factory<mask_shape::n_shapes>(
+                        mask_data.shape, sf_data.type));
+            }
 
-                // Check if a fitting factory already exists. If not, add it
-                // dynamically
-                const auto key = std::make_pair(sf_data.type, mask_data.shape);
-                if (auto search = sf_factories.find(key);
-                    search == sf_factories.end()) {
-                    sf_factories[key] =
-                        std::move(init_factory<mask_shape::n_shapes>(
-                            mask_data.shape, sf_data.type));
-                }
+            // Add the data to the factory
+            sf_factories.at(key)->push_back(deserialize(sf_data));
 
-                // Add the data to the factory
-                sf_factories.at(key)->push_back(deserialize(sf_data));
-            }
+            // Get the material link of the surface
+            sf_materials[key].push_back(
+                deserialize(det, sf_data.material, strict_material));
+        }
 
-            // Add the surfaces to the volume
-            typename detector_t::geometry_context geo_ctx{};
-            for (auto [key, sf_factory_ptr] : sf_factories) {
-                // Sort the surfaces into the volume builder by type
-                switch (sf_factory_ptr->surface_type()) {
-                    case surface_id::e_portal:
-                        vbuilder.add_portals(sf_factory_ptr, geo_ctx);
-                        break;
-                    case surface_id::e_sensitive:
-                        vbuilder.add_sensitives(sf_factory_ptr, geo_ctx);
-                        break;
-                    case surface_id::e_passive:
-                        vbuilder.add_passives(sf_factory_ptr, geo_ctx);
-                        break;
-                };
+        // Add the surfaces to the volume
+        typename detector_t::geometry_context geo_ctx{};
+        for (auto [key, sf_factory_ptr] : sf_factories) {
+            const std::size_t sf_offset{frag.surfaces.size()};
+            frag.add_surfaces(sf_factory_ptr, geo_ctx);
+
+            // Link the new surfaces to their material: The fragment holds no
+            // material, so the links refer to the detector material store
+            for (const auto [i, mat_link] :
+                 detray::views::enumerate(sf_materials.at(key))) {
+                frag.surfaces[sf_offset + i].material() = mat_link;
             }
-
-            // Add the volume to the detector
-            vbuilder.build(det);
         }
     }
 
@@ -175,7 +262,67 @@ class geometry_reader : public reader_interface<detector_t> {
                 std::move(mask_boundaries)};
     }
 
+    /// @returns the material link of a surface from its io payload
+    /// @param mat_data . The link is only set if the material (slabs, rods or
+    /// material maps) was already added to the detector @param det
+    ///
+    /// @throws std::runtime_error if the detector does not hold the material
+    /// and @param strict is set
+    static material_link_t deserialize(
+        const detector_t& det,
+        const std::optional<material_link_payload>& mat_data,
+        const bool strict = false) {
+
+        // Surfaces without material
+        if (not mat_data.has_value() or
+            mat_data->type == io::detail::material_type::unknown) {
+            return {material_link_t::id_type::e_none, dindex_invalid};
+        }
+
+        return find_material(det.material_store(), mat_data->type,
+                             static_cast<dindex>(mat_data->index), strict);
+    }
+
     private:
+    /// @returns the link to the material of io type @param type at position
+    /// @param mat_idx in the collection @tparam I of the material store
+    /// @param materials or in one of the following collections. No material
+    /// is linked if none of the collections holds it.
+    ///
+    /// @throws std::runtime_error if none of the collections holds it and
+    /// @param strict is set
+    template <std::size_t I = 0u>
+    static material_link_t find_material(
+        const typename detector_t::material_container& materials,
+        const io::detail::material_type type, const dindex mat_idx,
+        const bool strict) {
+
+        constexpr auto mat_id{mat_types::to_id(I)};
+        using mat_t =
+            typename detector_t::material_container::template get_type<mat_id>;
+
+        if constexpr (detail::get_material_type<mat_t>() !=
+                      io::detail::material_type::unknown) {
+            if (type == detail::get_material_type<mat_t>() and
+                mat_idx < materials.template size<mat_id>()) {
+                return {mat_id, mat_idx};
+            }
+        }
+
+        if constexpr (I < detector_t::material_container::n_collections() -
+                              1u) {
+            return find_material<I + 1u>(materials, type, mat_idx, strict);
+        } else {
+            if (not strict) {
+                return {material_link_t::id_type::e_none, dindex_invalid};
+            }
+            throw std::runtime_error(
+                "Surface material " + std::to_string(mat_idx) + " of type " +
+                std::to_string(static_cast<unsigned int>(type)) +
+                " not found: Read the material before the geometry");
+        }
+    }
+
     /// Determines the surface shape from the id @param shape_id in the payload
     /// and its type @param sf_type.
     ///
@@ -231,6 +378,11 @@ class geometry_reader : public reader_interface<detector_t> {
             return {nullptr};
         }
     }
+
+    /// Share identical masks between the surfaces of a volume
+    bool m_deduplicate{false};
+    /// Fail on unresolved surface material links
+    bool m_strict_material{false};
 };
 
 }  // namespace detray
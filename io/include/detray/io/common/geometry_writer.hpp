@@ -10,12 +10,11 @@
 // Project include(s)
 #include "detray/definitions/indexing.hpp"
 #include "detray/intersection/cylinder_portal_intersector.hpp"
+#include "detray/io/common/detail/type_traits.hpp"
 #include "detray/io/common/detail/utils.hpp"
 #include "detray/io/common/io_interface.hpp"
 #include "detray/io/common/payloads.hpp"
 #include "detray/masks/masks.hpp"
-#include "detray/materials/material_rod.hpp"
-#include "detray/materials/material_slab.hpp"
 
 // System include(s)
 #include <string>
@@ -146,21 +145,10 @@ class geometry_writer : public writer_interface<detector_t> {
     /// Serialize a surface material link @param m into its io payload
     template <class material_t>
     static material_link_payload serialize(const std::size_t idx) {
-        using scalar_t = typename material_t::scalar_type;
-        using type_id = material_link_payload::material_type;
-
         material_link_payload mat_data;
 
-        // Find the correct material type index (use name for simplicity)
-        if constexpr (std::is_same_v<material_t, material_slab<scalar_t>>) {
-            mat_data.type = type_id::slab;
-        } else if constexpr (std::is_same_v<material_t,
-                                            material_rod<scalar_t>>) {
-            mat_data.type = type_id::rod;
-        } else {
-            mat_data.type = type_id::unknown;
-        }
-
+        // Find the correct material type index
+        mat_data.type = detail::get_material_type<material_t>();
         mat_data.index = idx;
 
         return mat_data;
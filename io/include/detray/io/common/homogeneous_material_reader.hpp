@@ -0,0 +1,170 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/common/detail/type_traits.hpp"
+#include "detray/io/common/io_interface.hpp"
+#include "detray/io/common/payloads.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_rod.hpp"
+#include "detray/materials/material_slab.hpp"
+
+// System include(s)
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace detray {
+
+/// @brief Abstract base class for simple material description readers
+///
+/// Fills the material slabs and rods into the detector material store at the
+/// index they were written with. The surfaces are linked to their material
+/// by the geometry reader, so the material has to be read before the
+/// geometry.
+template <class detector_t>
+class homogeneous_material_reader : public reader_interface<detector_t> {
+
+    using base_type = reader_interface<detector_t>;
+    using scalar_type = typename detector_t::scalar_type;
+    using mat_types = typename detector_t::material_container::value_types;
+
+    /// Material rods can be present in addition to the slabs
+    static constexpr bool has_rods{
+        mat_types::template is_defined<material_rod<scalar_type>>()};
+
+    protected:
+    /// Tag the reader as "homogeneous_material"
+    inline static const std::string tag = "homogeneous_material";
+    /// Payload type of the file header
+    using header_type = homogeneous_material_header_payload;
+
+    public:
+    /// Same constructors for this class as for base_type
+    using base_type::base_type;
+
+    protected:
+    /// Deserialize the material description of a detector @param det from its
+    /// io payload @param mat_data
+    static void deserialize(detector_t& det,
+                            typename detector_t::name_map& /*name_map*/,
+                            const detector_homogeneous_material_payload&
+                                mat_data) {
+
+        for (const auto& slab_data : mat_data.mat_slabs) {
+            deserialize(det, slab_data);
+        }
+        if (mat_data.mat_rods.has_value()) {
+            for (const auto& rod_data : mat_data.mat_rods.value()) {
+                deserialize_rod(det, rod_data);
+            }
+        }
+    }
+
+    /// Register the incremental deserialization of the material slabs and
+    /// rods of a detector @param det with the payload @param stream
+    template <typename stream_t>
+    static void deserialize_streamed(
+        detector_t& det, typename detector_t::name_map& /*name_map*/,
+        stream_t& stream) {
+
+        stream.template for_each<material_slab_payload>(
+            "material_slabs",
+            [&det](const material_slab_payload& slab_data) {
+                deserialize(det, slab_data);
+            });
+        stream.template for_each<material_slab_payload>(
+            "material_rods", [&det](const material_slab_payload& rod_data) {
+                deserialize_rod(det, rod_data);
+            });
+    }
+
+    /// Check the header @param header_data of a streamed file against the
+    /// number of slabs and rods that were read from @param stream
+    template <typename stream_t>
+    static void check_header(const header_type& header_data,
+                             const stream_t& stream) {
+        const std::size_t n_slabs{stream.n_elements("material_slabs")};
+        const std::size_t n_rods{stream.n_elements("material_rods")};
+        if (header_data.n_slabs != n_slabs or header_data.n_rods != n_rods) {
+            throw std::runtime_error(
+                "Material file: Header lists " +
+                std::to_string(header_data.n_slabs) + " slabs and " +
+                std::to_string(header_data.n_rods) + " rods, but " +
+                std::to_string(n_slabs) + " and " + std::to_string(n_rods) +
+                " were read");
+        }
+    }
+
+    /// @returns the material from its io payload @param mat_data
+    static material<scalar_type> deserialize(
+        const material_payload& mat_data) {
+
+        const auto& p = mat_data.params;
+
+        return {static_cast<scalar_type>(p[0]), static_cast<scalar_type>(p[1]),
+                static_cast<scalar_type>(p[2]), static_cast<scalar_type>(p[3]),
+                static_cast<scalar_type>(p[4]),
+                static_cast<material_state>(static_cast<int>(p[6]))};
+    }
+
+    /// Add a material slab from its io payload @param slab_data to the
+    /// detector @param det
+    static void deserialize(detector_t& det,
+                            const material_slab_payload& slab_data) {
+
+        if constexpr (detail::is_homogeneous_material_v<detector_t>) {
+            constexpr auto slab_id{mat_types::to_id(0u)};
+
+            add_material<slab_id>(
+                det, slab_data.index,
+                material_slab<scalar_type>{
+                    deserialize(slab_data.mat),
+                    static_cast<scalar_type>(slab_data.thickness)});
+        } else {
+            throw std::runtime_error(
+                "Detector does not hold homogeneous material");
+        }
+    }
+
+    /// Add a material rod from its io payload @param rod_data to the
+    /// detector @param det
+    static void deserialize_rod(detector_t& det,
+                                const material_slab_payload& rod_data) {
+
+        if constexpr (has_rods) {
+            constexpr auto rod_id{
+                mat_types::template get_id<material_rod<scalar_type>>()};
+
+            add_material<rod_id>(
+                det, rod_data.index,
+                material_rod<scalar_type>{
+                    deserialize(rod_data.mat),
+                    static_cast<scalar_type>(rod_data.thickness)});
+        } else {
+            throw std::runtime_error("Detector does not hold material rods");
+        }
+    }
+
+    private:
+    /// Place the material @param mat at position @param idx in the material
+    /// collection with the id @tparam mat_id
+    template <typename mat_types::id mat_id, typename material_t>
+    static void add_material(detector_t& det, const std::size_t idx,
+                             material_t&& mat) {
+        auto& coll = det.material_store().template get<mat_id>();
+
+        if (coll.size() <= idx) {
+            coll.resize(idx + 1u);
+        }
+        coll[idx] = std::forward<material_t>(mat);
+    }
+};
+
+}  // namespace detray
@@ -26,6 +26,13 @@ template <class detector_t>
 class homogeneous_material_writer : public writer_interface<detector_t> {
 
     using base_type = writer_interface<detector_t>;
+    using scalar_type = typename detector_t::scalar_type;
+    using mat_types = typename detector_t::material_container::value_types;
+
+    /// Material rods can be present in addition to the slabs (other types,
+    /// like material maps, are written by a separate writer)
+    static constexpr bool has_rods{
+        mat_types::template is_defined<material_rod<scalar_type>>()};
 
     protected:
     /// Tag the writer as "homogeneous_material"
@@ -39,7 +46,6 @@ class homogeneous_material_writer : public writer_interface<detector_t> {
     /// Serialize the header information into its payload
     static homogeneous_material_header_payload write_header(
         const detector_t& det, const std::string_view det_name) {
-        using mat_types = typename detector_t::material_container::value_types;
 
         homogeneous_material_header_payload header_data;
 
@@ -51,12 +57,10 @@ class homogeneous_material_writer : public writer_interface<detector_t> {
         const auto& materials = det.material_store();
         header_data.n_slabs = materials.template size<mat_types::to_id(0u)>();
         header_data.n_rods = 0u;
-        if constexpr (mat_types::n_types == 2u) {
-            // The compiler looks at this code, even if the number of material
-            // types is one. Therefore, "mat_types::n_types - 1" is safer to use
-            header_data.n_rods =
-                materials
-                    .template size<mat_types::to_id(mat_types::n_types - 1)>();
+        if constexpr (has_rods) {
+            constexpr auto rod_id{
+                mat_types::template get_id<material_rod<scalar_type>>()};
+            header_data.n_rods = materials.template size<rod_id>();
         }
 
         return header_data;
@@ -66,7 +70,6 @@ class homogeneous_material_writer : public writer_interface<detector_t> {
     /// payload
     static detector_homogeneous_material_payload serialize(
         const detector_t& det) {
-        using mat_types = typename detector_t::material_container::value_types;
 
         detector_homogeneous_material_payload dm_data;
 
@@ -77,11 +80,12 @@ class homogeneous_material_writer : public writer_interface<detector_t> {
                  materials.template get<mat_types::to_id(0u)>())) {
             dm_data.mat_slabs.push_back(serialize(mat, idx));
         }
-        if constexpr (mat_types::n_types == 2u) {
+        if constexpr (has_rods) {
+            constexpr auto rod_id{
+                mat_types::template get_id<material_rod<scalar_type>>()};
             dm_data.mat_rods = {};
             for (const auto [idx, mat] : detray::views::enumerate(
-                     materials.template get<mat_types::to_id(
-                         mat_types::n_types - 1)>())) {
+                     materials.template get<rod_id>())) {
                 dm_data.mat_rods->push_back(serialize(mat, idx));
             }
         }
@@ -91,7 +95,7 @@ class homogeneous_material_writer : public writer_interface<detector_t> {
 
     /// Serialize surface material @param mat into its io payload
     static material_payload serialize(
-        const material<typename detector_t::scalar_type>& mat) {
+        const material<scalar_type>& mat) {
         material_payload mat_data;
 
         mat_data.params = {mat.X0(),
@@ -106,7 +110,7 @@ class homogeneous_material_writer : public writer_interface<detector_t> {
 
     /// Serialize a surface material slab @param mat_slab into its io payload
     static material_slab_payload serialize(
-        const material_slab<typename detector_t::scalar_type>& mat_slab,
+        const material_slab<scalar_type>& mat_slab,
         std::size_t idx) {
         material_slab_payload mat_data;
 
@@ -119,7 +123,7 @@ class homogeneous_material_writer : public writer_interface<detector_t> {
 
     /// Serialize a line material rod @param mat_rod into its io payload
     static material_slab_payload serialize(
-        const material_rod<typename detector_t::scalar_type>& mat_rod,
+        const material_rod<scalar_type>& mat_rod,
         std::size_t idx) {
         material_slab_payload mat_data;
 
@@ -0,0 +1,284 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/io/common/detail/type_traits.hpp"
+#include "detray/io/common/io_interface.hpp"
+#include "detray/io/common/payloads.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_map.hpp"
+#include "detray/materials/material_slab.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Abstract base class for surface material map readers
+///
+/// Rebuilds the material maps from their axes and bin content and appends
+/// them to the material collection of the respective grid shape. The maps
+/// have to be added in the order of their index in the collection, which is
+/// the order in which they are written. As for the homogeneous material, the
+/// surfaces are linked to their material by the geometry reader, so the maps
+/// have to be read before the geometry.
+template <class detector_t>
+class material_map_reader : public reader_interface<detector_t> {
+
+    using base_type = reader_interface<detector_t>;
+    using scalar_type = typename detector_t::scalar_type;
+    using material_container_t = typename detector_t::material_container;
+
+    protected:
+    /// Tag the reader as "material_maps"
+    inline static const std::string tag = "material_maps";
+    /// Payload type of the file header
+    using header_type = material_maps_header_payload;
+
+    public:
+    /// Same constructors for this class as for base_type
+    using base_type::base_type;
+
+    protected:
+    /// Deserialize the material maps of a detector @param det from their io
+    /// payload @param dm_data
+    static void deserialize(detector_t& det,
+                            typename detector_t::name_map& /*name_map*/,
+                            const detector_material_maps_payload& dm_data) {
+
+        // Add the maps of every collection in the order of their index
+        std::vector<const material_grid_payload*> grids;
+        grids.reserve(dm_data.grids.size());
+        for (const auto& grid_data : dm_data.grids) {
+            grids.push_back(&grid_data);
+        }
+        std::stable_sort(grids.begin(), grids.end(),
+                         [](const material_grid_payload* a,
+                            const material_grid_payload* b) {
+                             return std::make_pair(a->type, a->index) <
+                                    std::make_pair(b->type, b->index);
+                         });
+
+        for (const material_grid_payload* grid_data : grids) {
+            deserialize(det, *grid_data);
+        }
+    }
+
+    /// Register the incremental deserialization of the material maps of a
+    /// detector @param det with the payload @param stream
+    template <typename stream_t>
+    static void deserialize_streamed(
+        detector_t& det, typename detector_t::name_map& /*name_map*/,
+        stream_t& stream) {
+
+        stream.template for_each<material_grid_payload>(
+            "material_grids",
+            [&det](const material_grid_payload& grid_data) {
+                deserialize(det, grid_data);
+            });
+    }
+
+    /// Check the header @param header_data of a streamed file against the
+    /// number of maps that were read from @param stream
+    template <typename stream_t>
+    static void check_header(const header_type& header_data,
+                             const stream_t& stream) {
+        const std::size_t n_maps{stream.n_elements("material_grids")};
+        if (header_data.n_maps != n_maps) {
+            throw std::runtime_error(
+                "Material map file: Header lists " +
+                std::to_string(header_data.n_maps) + " maps, but " +
+                std::to_string(n_maps) + " were read");
+        }
+    }
+
+    /// Add a material map from its io payload @param grid_data to the
+    /// detector @param det
+    static void deserialize(detector_t& det,
+                            const material_grid_payload& grid_data) {
+
+        if constexpr (detail::has_material_maps_v<detector_t>) {
+            add_map(det.material_store(), grid_data);
+        } else {
+            throw std::runtime_error("Detector does not hold material maps");
+        }
+    }
+
+    /// @returns an owning material map of type @tparam map_t from its io
+    /// payload @param grid_data
+    template <typename map_t>
+    static auto deserialize(const material_grid_payload& grid_data) {
+
+        using grid_t = typename map_t::template type<true>;
+        using axes_t = typename grid_t::axes_type;
+
+        if (grid_data.axes.size() != grid_t::Dim) {
+            throw std::runtime_error(
+                "Material map " + std::to_string(grid_data.index) + ": Got " +
+                std::to_string(grid_data.axes.size()) + " axes, expected " +
+                std::to_string(grid_t::Dim));
+        }
+
+        // Axes boundaries and bin edges of all axes
+        typename axes_t::template vector_type<dindex_range> axes_data{};
+        typename axes_t::template vector_type<scalar_type> bin_edges{};
+        deserialize_axes<axes_t>(grid_data, axes_data, bin_edges,
+                                 std::make_index_sequence<grid_t::Dim>{});
+
+        axes_t axes(std::move(axes_data), std::move(bin_edges));
+
+        // Fill the material slabs into the bins by their global bin index
+        const auto n_bins_per_axis = axes.nbins();
+        std::size_t n_global_bins{1u};
+        for (dindex i = 0u; i < grid_t::Dim; ++i) {
+            n_global_bins *= n_bins_per_axis[i];
+        }
+        if (grid_data.bins.size() != n_global_bins) {
+            throw std::runtime_error(
+                "Material map " + std::to_string(grid_data.index) + ": Got " +
+                std::to_string(grid_data.bins.size()) + " bins, expected " +
+                std::to_string(n_global_bins));
+        }
+
+        typename grid_t::bin_storage_type bin_data(
+            n_global_bins, grid_t::populator_impl::template init<
+                               typename grid_t::value_type>());
+        for (const auto& slab_data : grid_data.bins) {
+            if (slab_data.index >= n_global_bins) {
+                throw std::runtime_error(
+                    "Material map " + std::to_string(grid_data.index) +
+                    ": Bin index " + std::to_string(slab_data.index) +
+                    " out of range");
+            }
+            bin_data[slab_data.index] = material_slab<scalar_type>{
+                deserialize(slab_data.mat),
+                static_cast<scalar_type>(slab_data.thickness)};
+        }
+
+        return grid_t(std::move(bin_data), std::move(axes));
+    }
+
+    /// @returns the material from its io payload @param mat_data
+    static material<scalar_type> deserialize(
+        const material_payload& mat_data) {
+
+        const auto& p = mat_data.params;
+
+        return {static_cast<scalar_type>(p[0]), static_cast<scalar_type>(p[1]),
+                static_cast<scalar_type>(p[2]), static_cast<scalar_type>(p[3]),
+                static_cast<scalar_type>(p[4]),
+                static_cast<material_state>(static_cast<int>(p[6]))};
+    }
+
+    private:
+    /// Add the material map @param grid_data to the collection @tparam I of
+    /// the material store @param materials , if it holds maps of the same
+    /// type, otherwise try the next collection
+    template <std::size_t I = 0u>
+    static void add_map(material_container_t& materials,
+                        const material_grid_payload& grid_data) {
+
+        constexpr auto id{material_container_t::value_types::to_id(I)};
+        using mat_t = typename material_container_t::template get_type<id>;
+
+        if constexpr (detail::is_material_map_v<mat_t>) {
+            if (grid_data.type == detail::get_material_type<mat_t>()) {
+                auto& coll = materials.template get<id>();
+
+                if (grid_data.index != coll.size()) {
+                    throw std::runtime_error(
+                        "Material map " + std::to_string(grid_data.index) +
+                        " is out of order: Expected index " +
+                        std::to_string(coll.size()));
+                }
+                coll.push_back(deserialize<mat_t>(grid_data));
+
+                return;
+            }
+        }
+
+        if constexpr (I < material_container_t::n_collections() - 1u) {
+            add_map<I + 1u>(materials, grid_data);
+        } else {
+            throw std::runtime_error(
+                "Detector does not hold material maps of type " +
+                std::to_string(static_cast<unsigned int>(grid_data.type)));
+        }
+    }
+
+    /// Deserialize the axis @tparam I from its io payload in @param grid_data
+    /// and append its boundaries to @param axes_data and its edges to
+    /// @param bin_edges
+    template <typename axes_t, std::size_t I, typename axes_data_t,
+              typename edges_t>
+    static void deserialize_axis(const material_grid_payload& grid_data,
+                                 axes_data_t& axes_data, edges_t& bin_edges) {
+
+        using bounds_t = std::tuple_element_t<I, typename axes_t::bounds>;
+        using binning_t = std::tuple_element_t<I, typename axes_t::binnings>;
+
+        const axis_payload& axis_data = grid_data.axes[I];
+
+        if (axis_data.binning != binning_t::type or
+            axis_data.bounds != bounds_t::type or
+            axis_data.label != bounds_t::label) {
+            throw std::runtime_error(
+                "Material map " + std::to_string(grid_data.index) + ": Axis " +
+                std::to_string(I) + " does not match the map type");
+        }
+
+        const auto offset{static_cast<dindex>(bin_edges.size())};
+        const auto n_bins{static_cast<dindex>(axis_data.bins)};
+
+        if (axis_data.binning == n_axis::binning::e_regular) {
+            if (axis_data.edges.size() != 2u) {
+                throw std::runtime_error(
+                    "Material map " + std::to_string(grid_data.index) +
+                    ": Regular axis " + std::to_string(I) +
+                    " needs exactly two edges");
+            }
+            axes_data.push_back({offset, n_bins});
+        } else {
+            if (axis_data.edges.size() != axis_data.bins + 1u) {
+                throw std::runtime_error(
+                    "Material map " + std::to_string(grid_data.index) +
+                    ": Irregular axis " + std::to_string(I) + " needs " +
+                    std::to_string(axis_data.bins + 1u) + " edges");
+            }
+            axes_data.push_back({offset, offset + n_bins});
+        }
+
+        for (const real_io edge : axis_data.edges) {
+            bin_edges.push_back(static_cast<scalar_type>(edge));
+        }
+
+        if constexpr (binning_t::type == n_axis::binning::e_irregular) {
+            // Speed up the bin search with one lookup cell per bin
+            binning_t::add_lookup_table(bin_edges, axes_data.back(), n_bins);
+        }
+    }
+
+    /// Deserialize all axes of a material map
+    template <typename axes_t, typename axes_data_t, typename edges_t,
+              std::size_t... I>
+    static void deserialize_axes(const material_grid_payload& grid_data,
+                                 axes_data_t& axes_data, edges_t& bin_edges,
+                                 std::index_sequence<I...>) {
+        (deserialize_axis<axes_t, I>(grid_data, axes_data, bin_edges), ...);
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,184 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/io/common/detail/type_traits.hpp"
+#include "detray/io/common/detail/utils.hpp"
+#include "detray/io/common/io_interface.hpp"
+#include "detray/io/common/payloads.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_map.hpp"
+#include "detray/materials/material_slab.hpp"
+
+// System include(s)
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace detray {
+
+/// @brief Abstract base class for surface material map writers
+template <class detector_t>
+class material_map_writer : public writer_interface<detector_t> {
+
+    using base_type = writer_interface<detector_t>;
+    using scalar_type = typename detector_t::scalar_type;
+    using material_container_t = typename detector_t::material_container;
+
+    protected:
+    /// Tag the writer as "material_maps"
+    inline static const std::string tag = "material_maps";
+
+    public:
+    /// Same constructors for this class as for base_type
+    using base_type::base_type;
+
+    protected:
+    /// Serialize the header information into its payload
+    static material_maps_header_payload write_header(
+        const detector_t& det, const std::string_view det_name) {
+
+        material_maps_header_payload header_data;
+
+        header_data.version = detail::get_detray_version();
+        header_data.detector = det_name;
+        header_data.tag = tag;
+        header_data.date = detail::get_current_date();
+        header_data.n_maps = count_maps(det.material_store());
+
+        return header_data;
+    }
+
+    /// Serialize the material maps of a detector @param det into their io
+    /// payload
+    static detector_material_maps_payload serialize(const detector_t& det) {
+
+        detector_material_maps_payload dm_data;
+        serialize_maps(det.material_store(), dm_data);
+
+        return dm_data;
+    }
+
+    /// Serialize a material map @param mat_map with index @param idx in its
+    /// collection into its io payload
+    template <typename map_t>
+    static material_grid_payload serialize(const map_t& mat_map,
+                                           std::size_t idx) {
+        material_grid_payload grid_data;
+
+        grid_data.type = detail::get_material_type<map_t>();
+        grid_data.index = idx;
+
+        serialize_axes(mat_map.axes(), grid_data,
+                       std::make_index_sequence<map_t::Dim>{});
+
+        std::size_t gbin{0u};
+        for (const auto& mat_slab : mat_map.all()) {
+            grid_data.bins.push_back(serialize(mat_slab, gbin++));
+        }
+
+        return grid_data;
+    }
+
+    /// Serialize a single axis @param ax into its io payload
+    template <typename axis_t>
+    static axis_payload serialize(const axis_t& ax) {
+        axis_payload axis_data;
+
+        axis_data.binning = ax.binning();
+        axis_data.bounds = ax.bounds();
+        axis_data.label = ax.label();
+        axis_data.bins = ax.m_binning.nbins();
+
+        // The regular binning is fully defined by the axis span
+        if (ax.binning() == n_axis::binning::e_regular) {
+            axis_data.edges = {ax.min(), ax.max()};
+        } else {
+            for (dindex ibin = 0u; ibin < axis_data.bins; ++ibin) {
+                axis_data.edges.push_back(ax.bin_edges(ibin)[0]);
+            }
+            axis_data.edges.push_back(ax.max());
+        }
+
+        return axis_data;
+    }
+
+    /// Serialize the material slab @param mat_slab in the bin @param gbin
+    static material_slab_payload serialize(
+        const material_slab<scalar_type>& mat_slab, std::size_t gbin) {
+        material_slab_payload mat_data;
+
+        const auto& mat = mat_slab.get_material();
+
+        mat_data.type = io::detail::material_type::slab;
+        mat_data.index = gbin;
+        mat_data.thickness = mat_slab.thickness();
+        mat_data.mat.params = {mat.X0(),
+                               mat.L0(),
+                               mat.Ar(),
+                               mat.Z(),
+                               mat.mass_density(),
+                               mat.molar_density(),
+                               static_cast<real_io>(mat.state())};
+
+        return mat_data;
+    }
+
+    private:
+    /// Serialize all axes of a material map
+    template <typename axes_t, std::size_t... I>
+    static void serialize_axes(const axes_t& axes,
+                               material_grid_payload& grid_data,
+                               std::index_sequence<I...>) {
+        (grid_data.axes.push_back(serialize(axes.template get_axis<I>())),
+         ...);
+    }
+
+    /// Serialize the material maps in the collection at position @tparam I
+    /// of the material store @param materials
+    template <std::size_t I = 0u>
+    static void serialize_maps(const material_container_t& materials,
+                               detector_material_maps_payload& dm_data) {
+
+        constexpr auto id{material_container_t::value_types::to_id(I)};
+        using mat_t = typename material_container_t::template get_type<id>;
+
+        if constexpr (detail::is_material_map_v<mat_t>) {
+            const auto& coll = materials.template get<id>();
+            for (dindex i = 0u; i < coll.size(); ++i) {
+                dm_data.grids.push_back(serialize(coll[i], i));
+            }
+        }
+
+        if constexpr (I < material_container_t::n_collections() - 1u) {
+            serialize_maps<I + 1u>(materials, dm_data);
+        }
+    }
+
+    /// @returns the number of material maps in the material store
+    template <std::size_t I = 0u>
+    static std::size_t count_maps(const material_container_t& materials) {
+
+        constexpr auto id{material_container_t::value_types::to_id(I)};
+        using mat_t = typename material_container_t::template get_type<id>;
+
+        std::size_t n_maps{0u};
+        if constexpr (detail::is_material_map_v<mat_t>) {
+            n_maps += materials.template size<id>();
+        }
+
+        if constexpr (I < material_container_t::n_collections() - 1u) {
+            n_maps += count_maps<I + 1u>(materials);
+        }
+        return n_maps;
+    }
+};
+
+}  // namespace detray
@@ -157,6 +157,35 @@ struct links_payload {
 
 /// @}
 
+/// Material map payloads
+/// @{
+
+/// @brief a payload for the material map file header
+struct material_maps_header_payload {
+    std::string version, detector, tag, date;
+    std::size_t n_maps;
+};
+
+/// @brief A payload for a single material map: a grid of material slabs over
+/// the local coordinates of a surface
+struct material_grid_payload {
+    using material_type = io::detail::material_type;
+    // The grid shape
+    material_type type = material_type::unknown;
+    // Index of the map in its collection in the material store
+    std::size_t index;
+    std::vector<axis_payload> axes = {};
+    // One slab per bin, in the order of the global bin index
+    std::vector<material_slab_payload> bins = {};
+};
+
+/// @brief A payload for the material maps of a detector
+struct detector_material_maps_payload {
+    std::vector<material_grid_payload> grids = {};
+};
+
+/// @}
+
 /// @brief A payload for a detector
 struct detector_payload {
     std::vector<volume_payload> volumes = {};
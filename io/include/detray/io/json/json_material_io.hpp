@@ -10,6 +10,7 @@
 // Project include(s)
 #include "detray/io/common/payloads.hpp"
 #include "detray/io/json/json.hpp"
+#include "detray/io/json/json_grids_io.hpp"
 
 // System include(s)
 #include <array>
@@ -96,4 +97,71 @@ void from_json(const nlohmann::ordered_json& j,
     }
 }
 
+void to_json(nlohmann::ordered_json& j,
+             const material_maps_header_payload& h) {
+    j["version"] = h.version;
+    j["detector"] = h.detector;
+    j["date"] = h.date;
+    j["tag"] = h.tag;
+    j["no. maps"] = h.n_maps;
+}
+
+void from_json(const nlohmann::ordered_json& j,
+               material_maps_header_payload& h) {
+    h.version = j["version"];
+    h.detector = j["detector"];
+    h.date = j["date"];
+    h.tag = j["tag"];
+    h.n_maps = j["no. maps"];
+}
+
+void to_json(nlohmann::ordered_json& j, const material_grid_payload& m) {
+    j["type"] = static_cast<unsigned int>(m.type);
+    j["index"] = m.index;
+    nlohmann::ordered_json jaxes;
+    for (const auto& a : m.axes) {
+        jaxes.push_back(a);
+    }
+    j["axes"] = jaxes;
+    nlohmann::ordered_json jbins;
+    for (const auto& b : m.bins) {
+        jbins.push_back(b);
+    }
+    j["bins"] = jbins;
+}
+
+void from_json(const nlohmann::ordered_json& j, material_grid_payload& m) {
+    m.type = static_cast<material_grid_payload::material_type>(j["type"]);
+    m.index = j["index"];
+    for (auto jax : j["axes"]) {
+        axis_payload a = jax;
+        m.axes.push_back(a);
+    }
+    for (auto jbin : j["bins"]) {
+        material_slab_payload mslp = jbin;
+        m.bins.push_back(mslp);
+    }
+}
+
+void to_json(nlohmann::ordered_json& j,
+             const detector_material_maps_payload& d) {
+    if (not d.grids.empty()) {
+        nlohmann::ordered_json jgrids;
+        for (const auto& g : d.grids) {
+            jgrids.push_back(g);
+        }
+        j["material_grids"] = jgrids;
+    }
+}
+
+void from_json(const nlohmann::ordered_json& j,
+               detector_material_maps_payload& d) {
+    if (j.find("material_grids") != j.end()) {
+        for (auto jgrid : j["material_grids"]) {
+            material_grid_payload mgp = jgrid;
+            d.grids.push_back(mgp);
+        }
+    }
+}
+
 }  // namespace detray
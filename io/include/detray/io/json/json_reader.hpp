@@ -10,6 +10,8 @@
 // Project include(s)
 #include "detray/io/common/detail/file_handle.hpp"
 #include "detray/io/common/geometry_reader.hpp"
+#include "detray/io/common/homogeneous_material_reader.hpp"
+#include "detray/io/common/material_map_reader.hpp"
 #include "detray/io/json/json.hpp"
 #include "detray/io/json/json_serializers.hpp"
 
@@ -49,6 +51,9 @@ class json_reader final : public common_reader_t<detector_t> {
 
         // Reads the data from file and returns the corresponding io payloads
         base_reader::deserialize(det, name_map, in_json["data"]);
+
+        // Tabulate the interactions of the material that was read
+        det.update_interaction_tables();
     }
 };
 
@@ -56,4 +61,13 @@ class json_reader final : public common_reader_t<detector_t> {
 template <typename detector_t>
 using json_geometry_reader = json_reader<detector_t, geometry_reader>;
 
+/// Read a simple material description from file in json format
+template <typename detector_t>
+using json_homogeneous_material_reader =
+    json_reader<detector_t, homogeneous_material_reader>;
+
+/// Read the surface material maps from file in json format
+template <typename detector_t>
+using json_material_map_reader = json_reader<detector_t, material_map_reader>;
+
 }  // namespace detray
@@ -0,0 +1,287 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/json/json.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io::detail {
+
+/// @brief Builds a json value from a sequence of SAX events
+template <typename json_t>
+class json_value_builder {
+
+    public:
+    /// Build the value into @param root
+    explicit json_value_builder(json_t& root) : m_root{&root} {}
+
+    /// @returns the nesting depth of the value that is currently being built
+    std::size_t depth() const { return m_stack.size(); }
+
+    /// Add the value @param v at the current position
+    template <typename value_t>
+    json_t* add(value_t&& v) {
+        if (m_stack.empty()) {
+            *m_root = json_t(std::forward<value_t>(v));
+            return m_root;
+        }
+        if (m_stack.back()->is_array()) {
+            m_stack.back()->emplace_back(std::forward<value_t>(v));
+            return &(m_stack.back()->back());
+        }
+        *m_object_element = json_t(std::forward<value_t>(v));
+        return m_object_element;
+    }
+
+    /// Open a new object or array of type @param t at the current position
+    void open(const typename json_t::value_t t) { m_stack.push_back(add(t)); }
+
+    /// The next value will be added to the current object under @param key
+    void key(const typename json_t::string_t& key) {
+        m_object_element = &((*m_stack.back())[key]);
+    }
+
+    /// Close the current object or array
+    void close() { m_stack.pop_back(); }
+
+    private:
+    /// The value that is being built
+    json_t* m_root;
+    /// The open objects and arrays
+    std::vector<json_t*> m_stack{};
+    /// Position of the next value in the current object
+    json_t* m_object_element{nullptr};
+};
+
+/// @brief SAX handler that streams the elements of the data arrays in a json
+/// file.
+///
+/// Every element of a registered array in the "data" section of the file
+/// (e.g. "volumes") is handed to a callback as soon as it has been parsed
+/// and is discarded afterwards. Only a single element is kept in memory at a
+/// time. The remainder of the file (e.g. the header) is collected in a
+/// regular json document.
+template <typename json_t = nlohmann::ordered_json>
+class json_stream final : public nlohmann::json_sax<json_t> {
+
+    using string_t = typename json_t::string_t;
+    using number_integer_t = typename json_t::number_integer_t;
+    using number_unsigned_t = typename json_t::number_unsigned_t;
+    using number_float_t = typename json_t::number_float_t;
+    using binary_t = typename json_t::binary_t;
+
+    public:
+    /// Callback that consumes an element of a streamed array
+    using callback_t = std::function<void(const json_t&)>;
+
+    /// Default constructor
+    json_stream() = default;
+
+    /// No copies (the builders point to the member values)
+    json_stream(const json_stream&) = delete;
+    json_stream& operator=(const json_stream&) = delete;
+
+    /// Hand every element of the array "data"/ @param key to @param callback
+    void add(const std::string& key, callback_t callback) {
+        m_callbacks[key] = std::move(callback);
+    }
+
+    /// Convert every element of the array "data"/ @param key into the io
+    /// payload @tparam payload_t and hand it to @param callback
+    template <typename payload_t, typename callback_fn_t>
+    void for_each(const std::string& key, callback_fn_t&& callback) {
+        add(key,
+            [cb = std::forward<callback_fn_t>(callback)](const json_t& j) {
+                cb(j.template get<payload_t>());
+            });
+    }
+
+    /// Hand the "header" section of the file to @param callback as soon as it
+    /// has been parsed. The header then has to precede the streamed arrays,
+    /// so that it can be checked before any element is deserialized
+    void set_header(callback_t callback) {
+        m_header_callback = std::move(callback);
+    }
+
+    /// Parse the json input @param in
+    void parse(std::istream& in) { json_t::sax_parse(in, this); }
+
+    /// @returns the part of the document that was not streamed
+    const json_t& document() const { return m_document; }
+
+    /// @returns the number of elements of the array "data"/ @param key that
+    /// were handed to its callback
+    std::size_t n_elements(const std::string& key) const {
+        const auto search = m_n_elements.find(key);
+        return search != m_n_elements.end() ? search->second : 0u;
+    }
+
+    /// @name SAX interface
+    /// @{
+    bool null() override { return value(nullptr); }
+
+    bool boolean(bool val) override { return value(val); }
+
+    bool number_integer(number_integer_t val) override { return value(val); }
+
+    bool number_unsigned(number_unsigned_t val) override {
+        return value(val);
+    }
+
+    bool number_float(number_float_t val, const string_t& /*s*/) override {
+        return value(val);
+    }
+
+    bool string(string_t& val) override { return value(std::move(val)); }
+
+    /// Binary values cannot occur in json text
+    bool binary(binary_t& /*val*/) override { return value(nullptr); }
+
+    bool start_object(std::size_t /*n_elements*/) override {
+        return open(json_t::value_t::object);
+    }
+
+    bool key(string_t& val) override {
+        m_key = val;
+        if (m_callback != nullptr) {
+            m_element_builder.key(val);
+        } else {
+            m_document_builder.key(val);
+        }
+        return true;
+    }
+
+    bool end_object() override { return close(); }
+
+    bool start_array(std::size_t /*n_elements*/) override {
+        return open(json_t::value_t::array);
+    }
+
+    bool end_array() override { return close(); }
+
+    bool parse_error(std::size_t position, const std::string& last_token,
+                     const nlohmann::detail::exception& ex) override {
+        throw std::runtime_error("Json parse error at byte " +
+                                 std::to_string(position) + " ('" +
+                                 last_token + "'): " + ex.what());
+    }
+    /// @}
+
+    private:
+    /// Add a value @param v to the element or the document
+    template <typename value_t>
+    bool value(value_t&& v) {
+        if (m_callback != nullptr) {
+            m_element_builder.add(std::forward<value_t>(v));
+            // Element was a single value
+            if (m_element_builder.depth() == 0u) {
+                deliver();
+            }
+        } else {
+            m_document_builder.add(std::forward<value_t>(v));
+        }
+        return true;
+    }
+
+    /// Open a new object or array of type @param t
+    bool open(const typename json_t::value_t t) {
+        if (m_callback != nullptr) {
+            m_element_builder.open(t);
+            return true;
+        }
+        // Start of a streamed array in the data section
+        if (t == json_t::value_t::array and m_path.size() == 2u and
+            m_path[1] == "data") {
+            if (auto search = m_callbacks.find(m_key);
+                search != m_callbacks.end()) {
+                if (m_header_callback and not m_has_header) {
+                    throw std::runtime_error(
+                        "Json stream: \"data\"/\"" + m_key +
+                        "\" is not preceded by the header");
+                }
+                m_callback = &(search->second);
+                m_stream_key = m_key;
+                return true;
+            }
+        }
+        m_document_builder.open(t);
+        m_path.push_back(m_key);
+
+        return true;
+    }
+
+    /// Close the current object or array
+    bool close() {
+        if (m_callback != nullptr) {
+            // End of the streamed array
+            if (m_element_builder.depth() == 0u) {
+                m_callback = nullptr;
+                return true;
+            }
+            m_element_builder.close();
+            if (m_element_builder.depth() == 0u) {
+                deliver();
+            }
+            return true;
+        }
+        m_document_builder.close();
+        // End of the file header
+        if (m_path.size() == 2u and m_path[1] == "header") {
+            m_has_header = true;
+            if (m_header_callback) {
+                m_header_callback(m_document["header"]);
+            }
+        }
+        m_path.pop_back();
+
+        return true;
+    }
+
+    /// Hand a complete element to the callback and free its memory
+    void deliver() {
+        (*m_callback)(m_element);
+        m_element = json_t{};
+        ++m_n_elements[m_stream_key];
+    }
+
+    /// Registered callbacks per array name
+    std::map<std::string, callback_t> m_callbacks{};
+    /// Callback of the array that is currently streamed
+    callback_t* m_callback{nullptr};
+    /// Name of the array that is currently streamed
+    std::string m_stream_key{};
+    /// Callback that checks the file header
+    callback_t m_header_callback{};
+    /// Whether the header has been parsed
+    bool m_has_header{false};
+    /// Number of streamed elements per array name
+    std::map<std::string, std::size_t> m_n_elements{};
+    /// Keys of the open objects and arrays of the document
+    std::vector<std::string> m_path{};
+    /// Last key that was read
+    std::string m_key{};
+
+    /// The part of the document that is not streamed
+    json_t m_document{};
+    json_value_builder<json_t> m_document_builder{m_document};
+    /// The current element of a streamed array
+    json_t m_element{};
+    json_value_builder<json_t> m_element_builder{m_element};
+};
+
+}  // namespace detray::io::detail
@@ -0,0 +1,100 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/common/detail/file_handle.hpp"
+#include "detray/io/common/geometry_reader.hpp"
+#include "detray/io/common/homogeneous_material_reader.hpp"
+#include "detray/io/common/material_map_reader.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_serializers.hpp"
+#include "detray/io/json/json_stream.hpp"
+
+// System include(s)
+#include <stdexcept>
+#include <string>
+
+namespace detray {
+
+/// @brief Class that adds streaming json functionality to common reader types.
+///
+/// In contrast to the @c json_reader , the file is not loaded into a json
+/// document first: The common reader registers the data collections it
+/// needs (e.g. the volumes) and every element of a collection is
+/// deserialized as soon as it has been parsed. Only a single element is held
+/// in memory at a time, so that the peak memory stays close to the size of
+/// the detector that is being built.
+///
+/// @note The resulting reader types will fulfill @c reader_interface through
+/// the common readers they are being extended with
+template <class detector_t, template <class> class common_reader_t>
+class json_stream_reader final : public common_reader_t<detector_t> {
+
+    using base_reader = common_reader_t<detector_t>;
+
+    public:
+    /// Set json file extension
+    json_stream_reader() : base_reader(".json") {}
+
+    /// Reads the detector component from file with the given name
+    virtual void read(detector_t& det, typename detector_t::name_map& name_map,
+                      const std::string& file_name) override {
+
+        io::detail::file_handle file{file_name, std::ios_base::in};
+        io::detail::json_stream<nlohmann::ordered_json> stream{};
+
+        // Check the header before any data is added to the detector
+        typename base_reader::header_type header_data{};
+        stream.set_header([&header_data, &file_name](
+                              const nlohmann::ordered_json& header) {
+            if (header.find("tag") == header.end() or
+                header["tag"] != base_reader::tag) {
+                throw std::runtime_error("File " + file_name +
+                                         ": Header tag does not match \"" +
+                                         base_reader::tag + "\"");
+            }
+            header_data =
+                header.template get<typename base_reader::header_type>();
+        });
+
+        // Register the data collections that the reader deserializes
+        base_reader::deserialize_streamed(det, name_map, stream);
+
+        stream.parse(*file);
+
+        // The number of elements is only known once they have been streamed
+        const auto& document = stream.document();
+        if (document.find("header") == document.end()) {
+            throw std::runtime_error("File " + file_name + ": No header found");
+        }
+        base_reader::check_header(header_data, stream);
+
+        // Tabulate the interactions of the material that was read
+        det.update_interaction_tables();
+    }
+};
+
+/// Read the tracking geometry from file in json format, one volume at a time
+template <typename detector_t>
+using json_geometry_stream_reader =
+    json_stream_reader<detector_t, geometry_reader>;
+
+/// Read a simple material description from file in json format, one material
+/// slab or rod at a time
+template <typename detector_t>
+using json_homogeneous_material_stream_reader =
+    json_stream_reader<detector_t, homogeneous_material_reader>;
+
+/// Read the surface material maps from file in json format, one map at a
+/// time
+template <typename detector_t>
+using json_material_map_stream_reader =
+    json_stream_reader<detector_t, material_map_reader>;
+
+}  // namespace detray
@@ -11,6 +11,7 @@
 #include "detray/io/common/detail/file_handle.hpp"
 #include "detray/io/common/geometry_writer.hpp"
 #include "detray/io/common/homogeneous_material_writer.hpp"
+#include "detray/io/common/material_map_writer.hpp"
 #include "detray/io/json/json.hpp"
 #include "detray/io/json/json_serializers.hpp"
 
@@ -76,4 +77,8 @@ template <typename detector_t>
 using json_homogeneous_material_writer =
     json_writer<detector_t, homogeneous_material_writer>;
 
+/// Write the surface material maps to file in json format
+template <typename detector_t>
+using json_material_map_writer = json_writer<detector_t, material_map_writer>;
+
 }  // namespace detray
@@ -0,0 +1,158 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/definitions/units.hpp"
+#include "detray/intersection/detail/trajectories.hpp"
+#include "detray/masks/masks.hpp"
+#include "detray/propagator/detail/covariance_engine.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/types.hpp"
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using transform3 = test::transform3;
+using vector3 = typename transform3::vector3;
+using matrix_operator = typename transform3::matrix_actor;
+using mask_type = mask<rectangle2D<>>;
+using local_frame_type = typename mask_type::local_frame_type;
+using covariance_engine = detail::covariance_engine<matrix_operator>;
+
+using bound_vector = typename local_frame_type::bound_vector;
+using bound_matrix = typename local_frame_type::bound_matrix;
+using free_matrix = typename local_frame_type::free_matrix;
+using free_to_bound_matrix = typename local_frame_type::free_to_bound_matrix;
+using bound_to_free_matrix = typename local_frame_type::bound_to_free_matrix;
+
+/// Inputs of the covariance transport between two surfaces
+struct transport_inputs {
+    bound_to_free_matrix bound_to_free_jacobian;
+    free_matrix transport_jacobian;
+    free_to_bound_matrix free_to_bound_jacobian;
+    vector3 dir;
+    vector3 dtds;
+    bound_matrix bound_cov;
+};
+
+/// Transport a track along a helix between two planes
+transport_inputs make_inputs() {
+
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    const mask_type rect{0u, 50.f * unit<scalar>::mm,
+                         50.f * unit<scalar>::mm};
+    const local_frame_type frame{};
+
+    const transform3 trf_0{vector3{0.f, 0.f, 0.f}, vector3{1.f, 0.f, 0.f},
+                           vector3{0.f, 1.f, 0.f}};
+    const transform3 trf_1{vector3{10.f * unit<scalar>::mm, 0.f, 0.f},
+                           vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f}};
+
+    free_track_parameters<transform3> free_trk(
+        {0.f, 0.f, 0.f}, 0.f, {1.f * unit<scalar>::GeV, 0.1f, 0.2f}, -1.f);
+    const bound_vector bound_vec =
+        frame.free_to_bound_vector(trf_0, free_trk.vector());
+
+    detail::helix<transform3> hlx(free_trk, &B);
+    const scalar s{10.f * unit<scalar>::mm};
+
+    transport_inputs in{};
+    in.bound_to_free_jacobian =
+        frame.bound_to_free_jacobian(trf_0, rect, bound_vec);
+    in.transport_jacobian = hlx.jacobian(s);
+    in.dir = hlx.dir(s);
+    in.dtds = hlx.qop() * vector::cross(in.dir, B);
+
+    free_track_parameters<transform3> free_trk_1;
+    free_trk_1.set_pos(hlx.pos(s));
+    free_trk_1.set_dir(in.dir);
+    free_trk_1.set_qop(free_trk.qop());
+
+    in.free_to_bound_jacobian =
+        frame.free_to_bound_jacobian(trf_1, free_trk_1.vector());
+
+    in.bound_cov =
+        matrix_operator().template identity<e_bound_size, e_bound_size>();
+
+    return in;
+}
+
+}  // anonymous namespace
+
+// This runs a benchmark on the covariance transport with dense products
+void BM_COVARIANCE_TRANSPORT_DENSE(benchmark::State &state) {
+
+    const transport_inputs in = make_inputs();
+    const local_frame_type frame{};
+
+    const transform3 trf_1{vector3{10.f * unit<scalar>::mm, 0.f, 0.f},
+                           vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f}};
+    const vector3 pos{10.f * unit<scalar>::mm, 0.f, 0.f};
+
+    for (auto _ : state) {
+        const free_matrix correction_term =
+            matrix_operator().template identity<e_free_size, e_free_size>() +
+            frame.path_correction(pos, in.dir, in.dtds, trf_1);
+
+        const bound_matrix full_jacobian =
+            in.free_to_bound_jacobian * correction_term *
+            in.transport_jacobian * in.bound_to_free_jacobian;
+
+        bound_matrix cov = full_jacobian * in.bound_cov *
+                           matrix_operator().transpose(full_jacobian);
+
+        benchmark::DoNotOptimize(cov);
+    }
+}
+
+// This runs a benchmark on the structure aware covariance transport
+void BM_COVARIANCE_TRANSPORT_SPARSE(benchmark::State &state) {
+
+    const transport_inputs in = make_inputs();
+    const local_frame_type frame{};
+
+    const transform3 trf_1{vector3{10.f * unit<scalar>::mm, 0.f, 0.f},
+                           vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f}};
+    const vector3 pos{10.f * unit<scalar>::mm, 0.f, 0.f};
+
+    for (auto _ : state) {
+        const free_to_bound_matrix corrected_free_to_bound =
+            covariance_engine().correct_free_to_bound(
+                in.free_to_bound_jacobian,
+                frame.path_derivative(trf_1, pos, in.dir), in.dir, in.dtds);
+
+        const bound_matrix full_jacobian = covariance_engine().to_bound(
+            covariance_engine().transport(corrected_free_to_bound,
+                                          in.transport_jacobian),
+            in.bound_to_free_jacobian);
+
+        bound_matrix cov = covariance_engine().unpack(
+            covariance_engine().similarity<e_bound_size>(full_jacobian,
+                                                         in.bound_cov));
+
+        benchmark::DoNotOptimize(cov);
+    }
+}
+
+BENCHMARK(BM_COVARIANCE_TRANSPORT_DENSE)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_COVARIANCE_TRANSPORT_SPARSE)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kNanosecond);
@@ -0,0 +1,492 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/core/detector_metadata.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/masks/cuboid3D.hpp"
+#include "detray/masks/cylinder2D.hpp"
+#include "detray/masks/cylinder3D.hpp"
+#include "detray/masks/single3D.hpp"
+#include "detray/surface_finders/grid/grid.hpp"
+#include "detray/surface_finders/grid/grid_collection.hpp"
+#include "detray/surface_finders/grid/populator.hpp"
+#include "detray/surface_finders/grid/serializer.hpp"
+#include "detray/tools/grid_factory.hpp"
+
+// Detray test include(s).
+#include "detray/test/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <array>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using point3 = test::point3;
+using transform3 = test::transform3;
+
+using regular_t = n_axis::regular<host_container_types, scalar>;
+using irregular_t = n_axis::irregular<host_container_types, scalar>;
+
+/// Number of lookups per benchmark iteration
+constexpr std::size_t n_points{10000u};
+/// Capacity of the bins that are filled by the attaching populator
+constexpr std::size_t bin_capacity{4u};
+
+using replace_factory_t = grid_factory<dindex, simple_serializer, replacer>;
+using attach_factory_t =
+    grid_factory<dindex, simple_serializer, regular_attacher<bin_capacity>>;
+
+/// The volume search grid of the detector (@c detector::volume_by_pos )
+using volume_finder_t = default_metadata::volume_finder<>;
+
+/// Span of the test grids in every dimension
+constexpr scalar half_span{1000.f * unit<scalar>::mm};
+/// Radius of the cylindrical test grids
+constexpr scalar cyl_radius{100.f * unit<scalar>::mm};
+
+/// @returns @param n uniformly distributed points in the box that is given by
+/// @param lower and @param upper (same seed for every benchmark)
+std::vector<point3> make_points(const point3 &lower, const point3 &upper,
+                                const std::size_t n = n_points) {
+    std::mt19937_64 gen(42u);
+    std::uniform_real_distribution<scalar> x(lower[0], upper[0]);
+    std::uniform_real_distribution<scalar> y(lower[1], upper[1]);
+    std::uniform_real_distribution<scalar> z(lower[2], upper[2]);
+
+    std::vector<point3> points;
+    points.reserve(n);
+    for (std::size_t i = 0u; i < n; ++i) {
+        points.push_back({x(gen), y(gen), z(gen)});
+    }
+    return points;
+}
+
+/// @returns irregular bin edges in [@param min, @param max] that become
+/// finer towards @param min (e.g. radial layers)
+std::vector<scalar> make_irregular_edges(const scalar min, const scalar max,
+                                         const std::size_t n_bins) {
+    std::vector<scalar> edges;
+    edges.reserve(n_bins + 1u);
+    for (std::size_t i = 0u; i <= n_bins; ++i) {
+        const scalar t{static_cast<scalar>(i) / static_cast<scalar>(n_bins)};
+        edges.push_back(min + (max - min) * t * t);
+    }
+    return edges;
+}
+
+/// 1D grid: regular, closed x-axis
+template <typename factory_t>
+auto make_grid_1D(const std::size_t n_bins) {
+    return factory_t{}.template new_grid<single3D<>>(
+        {-half_span, half_span}, {n_bins}, {},
+        std::tuple<n_axis::closed<n_axis::label::e_x>>{},
+        std::tuple<regular_t>{});
+}
+
+/// 2D grid: barrel layer with circular r*phi- and closed z-axis
+template <typename factory_t>
+auto make_grid_2D(const std::size_t n_bins) {
+    return factory_t{}.template new_grid<cylinder2D<>>(
+        {-constant<scalar>::pi * cyl_radius, constant<scalar>::pi * cyl_radius,
+         -half_span, half_span},
+        {n_bins, n_bins}, {},
+        std::tuple<n_axis::circular<n_axis::label::e_rphi>,
+                   n_axis::closed<n_axis::label::e_cyl_z>>{},
+        std::tuple<regular_t, regular_t>{});
+}
+
+/// 2D grid: same as above, but with an irregular z-axis
+template <typename factory_t>
+auto make_irr_grid_2D(const std::size_t n_bins) {
+    return factory_t{}.template new_grid<cylinder2D<>>(
+        {-constant<scalar>::pi * cyl_radius, constant<scalar>::pi * cyl_radius,
+         -half_span, half_span},
+        {n_bins, n_bins},
+        {{}, make_irregular_edges(-half_span, half_span, n_bins)},
+        std::tuple<n_axis::circular<n_axis::label::e_rphi>,
+                   n_axis::closed<n_axis::label::e_cyl_z>>{},
+        std::tuple<regular_t, irregular_t>{});
+}
+
+/// 3D grid: regular cartesian grid with open bounds
+template <typename factory_t>
+auto make_grid_3D(const std::size_t n_bins) {
+    return factory_t{}.template new_grid<cuboid3D<>>(
+        {-half_span, half_span, -half_span, half_span, -half_span, half_span},
+        {n_bins, n_bins, n_bins}, {},
+        std::tuple<n_axis::open<n_axis::label::e_x>,
+                   n_axis::open<n_axis::label::e_y>,
+                   n_axis::open<n_axis::label::e_z>>{},
+        std::tuple<regular_t, regular_t, regular_t>{});
+}
+
+/// Volume search grid: irregular r- and z-axes, single phi bin
+volume_finder_t make_volume_finder(const std::size_t n_bins) {
+    return replace_factory_t{}.template new_grid<cylinder3D>(
+        {0.f, half_span, -constant<scalar>::pi, constant<scalar>::pi,
+         -half_span, half_span},
+        {n_bins, 1u, 2u * n_bins},
+        {make_irregular_edges(0.f, half_span, n_bins),
+         {},
+         make_irregular_edges(-half_span, half_span, 2u * n_bins)},
+        std::tuple<n_axis::open<n_axis::label::e_r>,
+                   n_axis::circular<n_axis::label::e_phi>,
+                   n_axis::open<n_axis::label::e_z>>{},
+        std::tuple<irregular_t, regular_t, irregular_t>{});
+}
+
+/// @returns the lower corner of the local test point box for a grid
+template <unsigned int Dim>
+point3 lower_corner() {
+    if constexpr (Dim == 2u) {
+        return {-constant<scalar>::pi * cyl_radius, -half_span, 0.f};
+    }
+    return {-half_span, -half_span, -half_span};
+}
+
+/// @returns the upper corner of the local test point box for a grid
+template <unsigned int Dim>
+point3 upper_corner() {
+    if constexpr (Dim == 2u) {
+        return {constant<scalar>::pi * cyl_radius, half_span, 0.f};
+    }
+    return {half_span, half_span, half_span};
+}
+
+/// Fill every bin of an attaching grid to its capacity
+template <typename grid_t>
+void fill_bins(grid_t &g) {
+    for (dindex gbin = 0u; gbin < g.nbins(); ++gbin) {
+        for (dindex i = 0u; i < bin_capacity; ++i) {
+            g.populate(gbin, gbin + i);
+        }
+    }
+}
+
+/// Report the grid size in the benchmark output
+void set_grid_counters(benchmark::State &state, const unsigned int dim,
+                       const dindex n_bins) {
+    state.counters["Dim"] = static_cast<double>(dim);
+    state.counters["Bins"] = static_cast<double>(n_bins);
+}
+
+}  // anonymous namespace
+
+/// Single bin lookup at random local positions
+template <auto make_grid>
+void BM_GRID_LOOKUP(benchmark::State &state) {
+
+    const auto g = make_grid(static_cast<std::size_t>(state.range(0)));
+    constexpr auto Dim{std::decay_t<decltype(g)>::Dim};
+    const auto points = make_points(lower_corner<Dim>(), upper_corner<Dim>());
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const auto &entry : g.search(p)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+
+    set_grid_counters(state, Dim, g.nbins());
+    state.counters["Lookups"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * static_cast<double>(n_points),
+        benchmark::Counter::kIsRate);
+}
+
+/// Bin range computation for a neighborhood of one bin around random local
+/// positions (index neighborhood)
+template <auto make_grid>
+void BM_GRID_NEIGHBORHOOD(benchmark::State &state) {
+
+    const auto g = make_grid(static_cast<std::size_t>(state.range(0)));
+    constexpr auto Dim{std::decay_t<decltype(g)>::Dim};
+    const auto points = make_points(lower_corner<Dim>(), upper_corner<Dim>());
+
+    const std::array<dindex, 2> nhood{1u, 1u};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            benchmark::DoNotOptimize(g.axes().bin_ranges(p, nhood));
+        }
+    }
+
+    set_grid_counters(state, Dim, g.nbins());
+}
+
+/// Bin range computation for a neighborhood around random local positions that
+/// is given as an interval on the axes (scalar neighborhood)
+template <auto make_grid>
+void BM_GRID_NEIGHBORHOOD_SCALAR(benchmark::State &state) {
+
+    const auto g = make_grid(static_cast<std::size_t>(state.range(0)));
+    constexpr auto Dim{std::decay_t<decltype(g)>::Dim};
+    const auto points = make_points(lower_corner<Dim>(), upper_corner<Dim>());
+
+    const std::array<scalar, 2> nhood{10.f * unit<scalar>::mm,
+                                      10.f * unit<scalar>::mm};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            benchmark::DoNotOptimize(g.axes().bin_ranges(p, nhood));
+        }
+    }
+
+    set_grid_counters(state, Dim, g.nbins());
+}
+
+/// Population of a replacing grid at random local positions
+template <auto make_grid>
+void BM_GRID_POPULATE_REPLACE(benchmark::State &state) {
+
+    auto g = make_grid(static_cast<std::size_t>(state.range(0)));
+    constexpr auto Dim{std::decay_t<decltype(g)>::Dim};
+    const auto points = make_points(lower_corner<Dim>(), upper_corner<Dim>());
+
+    for (auto _ : state) {
+        dindex entry{0u};
+        for (const auto &p : points) {
+            g.populate(p, entry++);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    set_grid_counters(state, Dim, g.nbins());
+}
+
+/// Fill every bin of an attaching grid to capacity
+template <auto make_grid>
+void BM_GRID_POPULATE_ATTACH(benchmark::State &state) {
+
+    const auto empty_grid = make_grid(static_cast<std::size_t>(state.range(0)));
+    constexpr auto Dim{std::decay_t<decltype(empty_grid)>::Dim};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto g = empty_grid;
+        state.ResumeTiming();
+
+        fill_bins(g);
+        benchmark::ClobberMemory();
+    }
+
+    set_grid_counters(state, Dim, empty_grid.nbins());
+}
+
+/// Iterate through all entries of a filled attaching grid
+template <auto make_grid>
+void BM_GRID_ALL(benchmark::State &state) {
+
+    auto g = make_grid(static_cast<std::size_t>(state.range(0)));
+    constexpr auto Dim{std::decay_t<decltype(g)>::Dim};
+    fill_bins(g);
+
+    for (auto _ : state) {
+        dindex sum{0u};
+        for (const auto entry : std::as_const(g).all()) {
+            sum += entry;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    set_grid_counters(state, Dim, g.nbins());
+    state.counters["Entries"] =
+        benchmark::Counter(static_cast<double>(state.iterations()) *
+                               static_cast<double>(g.nbins() * bin_capacity),
+                           benchmark::Counter::kIsRate);
+}
+
+/// Lookups in a collection of 2D grids (one grid per surface finder) that is
+/// accessed in random order
+void BM_GRID_COLLECTION_LOOKUP(benchmark::State &state) {
+
+    using grid_t = decltype(make_grid_2D<attach_factory_t>(1u));
+
+    vecmem::host_memory_resource host_mr;
+    attach_factory_t factory(host_mr);
+    auto grid_coll = factory.template new_collection<grid_t>();
+
+    const auto n_grids{static_cast<dindex>(state.range(0))};
+    const auto n_bins{static_cast<std::size_t>(state.range(1))};
+    for (dindex i = 0u; i < n_grids; ++i) {
+        auto g = make_grid_2D<attach_factory_t>(n_bins);
+        fill_bins(g);
+        grid_coll.push_back(g);
+    }
+
+    const auto points = make_points(lower_corner<2u>(), upper_corner<2u>());
+    std::mt19937_64 gen(42u);
+    std::uniform_int_distribution<dindex> grid_idx(0u, n_grids - 1u);
+    std::vector<dindex> grid_indices(n_points);
+    for (auto &idx : grid_indices) {
+        idx = grid_idx(gen);
+    }
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < n_points; ++i) {
+            const auto g = grid_coll[grid_indices[i]];
+            for (const auto entry : g.search(points[i])) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+
+    state.counters["Grids"] = static_cast<double>(n_grids);
+    state.counters["Lookups"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * static_cast<double>(n_points),
+        benchmark::Counter::kIsRate);
+}
+
+/// Volume lookup by global position, as done by @c detector::volume_by_pos
+void BM_VOLUME_FINDER_LOOKUP(benchmark::State &state) {
+
+    const auto vgrid =
+        make_volume_finder(static_cast<std::size_t>(state.range(0)));
+    const auto points = make_points({-half_span, -half_span, -half_span},
+                                    {half_span, half_span, half_span});
+
+    // The volume search grid is concentric
+    const transform3 identity{};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            const auto loc_pos =
+                vgrid.global_to_local(identity, p, identity.translation());
+            benchmark::DoNotOptimize(*vgrid.search(loc_pos));
+        }
+    }
+
+    state.counters["Bins"] = static_cast<double>(vgrid.nbins());
+    state.counters["Lookups"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * static_cast<double>(n_points),
+        benchmark::Counter::kIsRate);
+}
+
+// Realistic and extreme grid sizes: number of bins per axis
+BENCHMARK_TEMPLATE(BM_GRID_LOOKUP, make_grid_1D<replace_factory_t>)
+    ->Name("GRID_LOOKUP_1D")
+    ->RangeMultiplier(100)
+    ->Range(10, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_LOOKUP, make_grid_2D<replace_factory_t>)
+    ->Name("GRID_LOOKUP_2D")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_LOOKUP, make_irr_grid_2D<replace_factory_t>)
+    ->Name("GRID_LOOKUP_2D_IRREGULAR")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_LOOKUP, make_grid_2D<attach_factory_t>)
+    ->Name("GRID_LOOKUP_2D_ATTACHER")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_LOOKUP, make_grid_3D<replace_factory_t>)
+    ->Name("GRID_LOOKUP_3D")
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(200)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_GRID_NEIGHBORHOOD, make_grid_1D<replace_factory_t>)
+    ->Name("GRID_NEIGHBORHOOD_1D")
+    ->RangeMultiplier(100)
+    ->Range(10, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_NEIGHBORHOOD, make_grid_2D<replace_factory_t>)
+    ->Name("GRID_NEIGHBORHOOD_2D")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_NEIGHBORHOOD, make_irr_grid_2D<replace_factory_t>)
+    ->Name("GRID_NEIGHBORHOOD_2D_IRREGULAR")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_NEIGHBORHOOD_SCALAR,
+                   make_irr_grid_2D<replace_factory_t>)
+    ->Name("GRID_NEIGHBORHOOD_SCALAR_2D_IRREGULAR")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_NEIGHBORHOOD, make_grid_3D<replace_factory_t>)
+    ->Name("GRID_NEIGHBORHOOD_3D")
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(200)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_GRID_POPULATE_REPLACE, make_grid_2D<replace_factory_t>)
+    ->Name("GRID_POPULATE_REPLACE_2D")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_POPULATE_REPLACE, make_grid_3D<replace_factory_t>)
+    ->Name("GRID_POPULATE_REPLACE_3D")
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(200)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_POPULATE_ATTACH, make_grid_1D<attach_factory_t>)
+    ->Name("GRID_POPULATE_ATTACH_1D")
+    ->RangeMultiplier(100)
+    ->Range(10, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_POPULATE_ATTACH, make_grid_2D<attach_factory_t>)
+    ->Name("GRID_POPULATE_ATTACH_2D")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_GRID_ALL, make_grid_1D<attach_factory_t>)
+    ->Name("GRID_ALL_1D")
+    ->RangeMultiplier(100)
+    ->Range(10, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_ALL, make_grid_2D<attach_factory_t>)
+    ->Name("GRID_ALL_2D")
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GRID_ALL, make_grid_3D<attach_factory_t>)
+    ->Name("GRID_ALL_3D")
+    ->Arg(10)
+    ->Arg(50)
+    ->Unit(benchmark::kMicrosecond);
+
+// Number of grids in the collection and number of bins per axis
+BENCHMARK(BM_GRID_COLLECTION_LOOKUP)
+    ->Name("GRID_COLLECTION_LOOKUP_2D")
+    ->ArgsProduct({{10, 1000}, {10, 100}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Number of bins on the r-axis (twice as many on the z-axis)
+BENCHMARK(BM_VOLUME_FINDER_LOOKUP)
+    ->Name("VOLUME_FINDER_LOOKUP")
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
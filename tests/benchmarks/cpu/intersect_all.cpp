@@ -6,6 +6,7 @@
  */
 
 // Project include(s)
+#include "detray/core/detail/compact_transform_store.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
@@ -28,23 +29,18 @@
 // Use the detray:: namespace implicitly.
 using namespace detray;
 
-// This test runs intersection with all surfaces of the TrackML detector
-void BM_INTERSECT_ALL(benchmark::State &state) {
+namespace {
+
+/// Intersect all surfaces of the detector @param d , using the placements in
+/// the transform store @param transforms
+template <typename detector_t, typename transform_container_t>
+void intersect_all(benchmark::State &state, const detector_t &d,
+                   const transform_container_t &transforms) {
 
     static const unsigned int theta_steps{100u};
     static const unsigned int phi_steps{100u};
 
-    // Detector configuration
-    static constexpr std::size_t n_brl_layers{4u};
-    static constexpr std::size_t n_edc_layers{7u};
-    vecmem::host_memory_resource host_mr;
-    auto d = create_toy_geometry(host_mr, n_brl_layers, n_edc_layers);
-
-    using detector_t = decltype(d);
-    detector_t::geometry_context geo_context;
-
     const auto &masks = d.mask_store();
-    const auto &transforms = d.transform_store(geo_context);
 
     std::size_t hits{0u};
     std::size_t missed{0u};
@@ -87,8 +83,50 @@ void BM_INTERSECT_ALL(benchmark::State &state) {
 #endif  // DETRAY_BENCHMARK_PRINTOUTS
 }
 
+// Detector configuration
+constexpr std::size_t n_brl_layers{4u};
+constexpr std::size_t n_edc_layers{7u};
+
+}  // namespace
+
+// This test runs intersection with all surfaces of the TrackML detector
+void BM_INTERSECT_ALL(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    auto d = create_toy_geometry(host_mr, n_brl_layers, n_edc_layers);
+
+    using detector_t = decltype(d);
+    detector_t::geometry_context geo_context;
+
+    intersect_all(state, d, d.transform_store(geo_context));
+}
+
+// Same as above, but with the placements kept in a compact transform store
+void BM_INTERSECT_ALL_COMPACT(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    auto d = create_toy_geometry(host_mr, n_brl_layers, n_edc_layers);
+
+    using detector_t = decltype(d);
+    detector_t::geometry_context geo_context;
+
+    compact_transform_store<typename detector_t::transform3> transforms{};
+    transforms.reserve(d.transform_store().size(geo_context), {});
+    for (const auto &trf : d.transform_store().get(geo_context)) {
+        transforms.push_back(trf);
+    }
+
+    intersect_all(state, d, transforms);
+}
+
 BENCHMARK(BM_INTERSECT_ALL)
 #ifdef DETRAY_BENCHMARK_MULTITHREAD
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_INTERSECT_ALL_COMPACT)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
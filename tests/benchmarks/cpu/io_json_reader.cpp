@@ -0,0 +1,93 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/io/json/json_reader.hpp"
+#include "detray/io/json/json_stream_reader.hpp"
+#include "detray/io/json/json_writer.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <ios>
+#include <string>
+#include <utility>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata<>>;
+
+vecmem::host_memory_resource host_mr;
+
+/// Write the toy detector geometry and material files once
+///
+/// @returns the file names of the geometry and the material file
+const std::pair<std::string, std::string>& toy_detector_files() {
+
+    static const std::pair<std::string, std::string> files = []() {
+        typename detector_t::name_map names{{0u, "toy_detector_benchmark"}};
+        const detector_t toy_det = create_toy_geometry(host_mr);
+
+        json_geometry_writer<detector_t> geo_writer;
+        json_homogeneous_material_writer<detector_t> mat_writer;
+
+        const auto mode = std::ios_base::out | std::ios_base::trunc;
+        return std::make_pair(geo_writer.write(toy_det, names, mode),
+                              mat_writer.write(toy_det, names, mode));
+    }();
+
+    return files;
+}
+
+}  // anonymous namespace
+
+// This runs a benchmark on reading the toy detector into a json document
+void BM_JSON_READER_DOCUMENT(benchmark::State& state) {
+
+    const auto& [geo_file, mat_file] = toy_detector_files();
+    typename detector_t::name_map names{{0u, "toy_detector_benchmark"}};
+
+    for (auto _ : state) {
+        detector_t det{host_mr};
+
+        json_homogeneous_material_reader<detector_t> mat_reader;
+        mat_reader.read(det, names, mat_file);
+        json_geometry_reader<detector_t> geo_reader;
+        geo_reader.read(det, names, geo_file);
+
+        benchmark::DoNotOptimize(det);
+    }
+}
+
+// This runs a benchmark on streaming the toy detector from file
+void BM_JSON_READER_STREAM(benchmark::State& state) {
+
+    const auto& [geo_file, mat_file] = toy_detector_files();
+    typename detector_t::name_map names{{0u, "toy_detector_benchmark"}};
+
+    for (auto _ : state) {
+        detector_t det{host_mr};
+
+        json_homogeneous_material_stream_reader<detector_t> mat_reader;
+        mat_reader.read(det, names, mat_file);
+        json_geometry_stream_reader<detector_t> geo_reader;
+        geo_reader.read(det, names, geo_file);
+
+        benchmark::DoNotOptimize(det);
+    }
+}
+
+BENCHMARK(BM_JSON_READER_DOCUMENT)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_JSON_READER_STREAM)->Unit(benchmark::kMillisecond);
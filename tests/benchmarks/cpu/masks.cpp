@@ -293,7 +293,7 @@ BENCHMARK(BM_CYLINDER_2D_MASK)
 void BM_ANNULUS_2D_MASK(benchmark::State &state) {
 
     using mask_type = mask<annulus2D<>>;
-    constexpr mask_type ann{0u, 2.5f, 5.f, -0.64299f, 4.13173f, 1.f, 0.5f, 0.f};
+    const mask_type ann{0u, 2.5f, 5.f, -0.64299f, 4.13173f, 1.f, 0.5f, 0.f};
 
     constexpr scalar world{10.f};
 
@@ -339,3 +339,90 @@ BENCHMARK(BM_ANNULUS_2D_MASK)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+// This runs the trapezoid2D benchmark without the precomputed mask values
+void BM_TRAPEZOID_2D_MASK_UNBAKED(benchmark::State &state) {
+
+    using mask_type = mask<trapezoid2D<>>;
+    constexpr mask_type t{0u, 2.f, 3.f, 4.f};
+
+    constexpr scalar world{10.f};
+
+    constexpr scalar sx{world / steps_x3};
+    constexpr scalar sy{world / steps_y3};
+    constexpr scalar sz{world / steps_z3};
+
+    unsigned long inside = 0u;
+    unsigned long outside = 0u;
+
+    for (auto _ : state) {
+        for (unsigned int ix = 0u; ix < steps_x3; ++ix) {
+            scalar x{-0.5f * world + static_cast<scalar>(ix) * sx};
+            for (unsigned int iy = 0u; iy < steps_y3; ++iy) {
+                scalar y{-0.5f * world + static_cast<scalar>(iy) * sy};
+                for (unsigned int iz = 0u; iz < steps_z3; ++iz) {
+                    scalar z{-0.5f * world + static_cast<scalar>(iz) * sz};
+
+                    benchmark::DoNotOptimize(inside);
+                    benchmark::DoNotOptimize(outside);
+                    const point3 loc_p{t.to_local_frame(trf, {x, y, z})};
+                    if (t.get_shape().check_boundaries(t.values(), loc_p)) {
+                        ++inside;
+                    } else {
+                        ++outside;
+                    }
+                }
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_TRAPEZOID_2D_MASK_UNBAKED)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+// This runs the annulus2D benchmark without the precomputed mask values
+void BM_ANNULUS_2D_MASK_UNBAKED(benchmark::State &state) {
+
+    using mask_type = mask<annulus2D<>>;
+    const mask_type ann{0u, 2.5f, 5.f, -0.64299f, 4.13173f, 1.f, 0.5f, 0.f};
+
+    constexpr scalar world{10.f};
+
+    constexpr scalar sx{world / steps_x3};
+    constexpr scalar sy{world / steps_y3};
+    constexpr scalar sz{world / steps_z3};
+
+    unsigned long inside = 0u;
+    unsigned long outside = 0u;
+
+    for (auto _ : state) {
+        for (unsigned int ix = 0u; ix < steps_x3; ++ix) {
+            scalar x{-0.5f * world + static_cast<scalar>(ix) * sx};
+            for (unsigned int iy = 0u; iy < steps_y3; ++iy) {
+                scalar y{-0.5f * world + static_cast<scalar>(iy) * sy};
+                for (unsigned int iz = 0u; iz < steps_z3; ++iz) {
+                    scalar z{-0.5f * world + static_cast<scalar>(iz) * sz};
+
+                    benchmark::DoNotOptimize(inside);
+                    benchmark::DoNotOptimize(outside);
+                    const point3 loc_p{ann.to_local_frame(trf, {x, y, z})};
+                    if (ann.get_shape().check_boundaries(ann.values(),
+                                                         loc_p)) {
+                        ++inside;
+                    } else {
+                        ++outside;
+                    }
+                }
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_ANNULUS_2D_MASK_UNBAKED)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
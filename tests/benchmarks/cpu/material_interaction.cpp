@@ -0,0 +1,159 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/intersection/intersection.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/materials/predefined_materials.hpp"
+
+// Detray test include(s).
+#include "detray/test/types.hpp"
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using sf_handle_t = surface<>;
+using table_t = interaction_table<scalar>;
+
+constexpr std::size_t n_tracks{10000u};
+
+// muon
+constexpr int pdg{pdg_particle::eMuon};
+constexpr scalar mass{105.7f * unit<scalar>::MeV};
+constexpr scalar q{-1.f};
+
+/// Silicon slab, hit under an angle
+const material_slab<scalar> slab(silicon<scalar>(), 0.15f * unit<scalar>::mm);
+
+intersection2D<sf_handle_t> make_intersection() {
+    intersection2D<sf_handle_t> is;
+    is.cos_incidence_angle = 0.7f;
+    return is;
+}
+
+const intersection2D<sf_handle_t> is{make_intersection()};
+
+/// Log-uniformly distributed q/p values between 100 MeV and 100 GeV
+std::vector<scalar> make_qops() {
+    std::vector<scalar> qops;
+    qops.reserve(n_tracks);
+
+    const scalar log_p_min{std::log(100.f * unit<scalar>::MeV)};
+    const scalar log_p_max{std::log(100.f * unit<scalar>::GeV)};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar frac{static_cast<scalar>(i) /
+                          static_cast<scalar>(n_tracks)};
+        const scalar p{std::exp(log_p_min + (log_p_max - log_p_min) * frac)};
+        qops.push_back(q / p);
+    }
+    return qops;
+}
+
+const std::vector<scalar> qops{make_qops()};
+
+}  // anonymous namespace
+
+// Energy loss and scattering, computed analytically
+void BM_INTERACTION_ANALYTIC(benchmark::State &state) {
+
+    const interaction<scalar> I{};
+
+    for (auto _ : state) {
+        for (const scalar qop : qops) {
+            scalar e_loss{I.compute_energy_loss_bethe(is, slab, pdg, mass, qop,
+                                                      q)};
+            scalar sigma_qop{I.compute_energy_loss_landau_sigma_QOverP(
+                is, slab, pdg, mass, qop, q)};
+            scalar theta0{I.compute_multiple_scattering_theta0(is, slab, pdg,
+                                                               mass, qop, q)};
+            benchmark::DoNotOptimize(e_loss);
+            benchmark::DoNotOptimize(sigma_qop);
+            benchmark::DoNotOptimize(theta0);
+        }
+    }
+
+    state.counters["Interactions"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * n_tracks),
+        benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_INTERACTION_ANALYTIC)->Unit(benchmark::kMicrosecond);
+
+// Energy loss and scattering, interpolated from the material table. The
+// maximal relative deviation from the analytic values is reported.
+void BM_INTERACTION_TABULATED(benchmark::State &state) {
+
+    const table_t table(slab.get_material(), pdg, mass, q);
+
+    for (auto _ : state) {
+        for (const scalar qop : qops) {
+            // Locate the momentum once for all quantities
+            const auto node = table.locate(qop);
+            scalar e_loss{table.compute_energy_loss_bethe(is, slab, node)};
+            scalar sigma_qop{
+                table.compute_energy_loss_landau_sigma_QOverP(is, slab, node)};
+            scalar theta0{
+                table.compute_multiple_scattering_theta0(is, slab, node)};
+            benchmark::DoNotOptimize(e_loss);
+            benchmark::DoNotOptimize(sigma_qop);
+            benchmark::DoNotOptimize(theta0);
+        }
+    }
+
+    state.counters["Interactions"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * n_tracks),
+        benchmark::Counter::kIsRate);
+
+    // Accuracy report
+    const interaction<scalar> I{};
+    double max_dev_e_loss{0.};
+    double max_dev_sigma_qop{0.};
+    double max_dev_theta0{0.};
+
+    const auto rel_dev = [](const scalar tab, const scalar ana) {
+        return static_cast<double>(std::abs(tab / ana - 1.f));
+    };
+
+    for (const scalar qop : qops) {
+        max_dev_e_loss = std::max(
+            max_dev_e_loss,
+            rel_dev(table.compute_energy_loss_bethe(is, slab, qop),
+                    I.compute_energy_loss_bethe(is, slab, pdg, mass, qop, q)));
+        max_dev_sigma_qop = std::max(
+            max_dev_sigma_qop,
+            rel_dev(
+                table.compute_energy_loss_landau_sigma_QOverP(is, slab, qop),
+                I.compute_energy_loss_landau_sigma_QOverP(is, slab, pdg, mass,
+                                                          qop, q)));
+        max_dev_theta0 = std::max(
+            max_dev_theta0,
+            rel_dev(table.compute_multiple_scattering_theta0(is, slab, qop),
+                    I.compute_multiple_scattering_theta0(is, slab, pdg, mass,
+                                                         qop, q)));
+    }
+
+    state.counters["MaxRelDevEloss"] = max_dev_e_loss;
+    state.counters["MaxRelDevSigmaQop"] = max_dev_sigma_qop;
+    state.counters["MaxRelDevTheta0"] = max_dev_theta0;
+}
+
+BENCHMARK(BM_INTERACTION_TABULATED)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,624 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/compact_transform_store.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/create_telescope_detector.hpp"
+#include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/masks/masks.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/helix_stepper.hpp"
+#include "detray/propagator/navigator.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/rk_stepper_pack.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using transform3 = test::transform3;
+// Double precision track state, also in case of a single precision detector
+using track_transform3 = __plugin::transform3<double>;
+
+// Detector configuration
+constexpr std::size_t n_brl_layers{4u};
+constexpr std::size_t n_edc_layers{7u};
+
+vecmem::host_memory_resource host_mr;
+
+using detector_t = decltype(create_toy_geometry(host_mr));
+using bfield_t = detector_t::bfield_type;
+using navigator_t = navigator<detector_t>;
+
+using rk_stepper_t =
+    rk_stepper<bfield_t::view_t, transform3, constrained_step<>>;
+using helix_stepper_t =
+    helix_stepper<bfield_t::view_t, transform3, constrained_step<>>;
+using mixed_rk_stepper_t =
+    rk_stepper<bfield_t::view_t, track_transform3, constrained_step<>>;
+
+/// Toy detector that keeps the surface placements in compact form
+struct compact_toy_metadata : public toy_metadata<> {
+    template <template <typename...> class vector_t = dvector>
+    using transform_store =
+        compact_transform_store<__plugin::transform3<detray::scalar>,
+                                vector_t, geometry_context>;
+};
+
+/// @returns the memory that is taken up by the geometry description in bytes
+template <typename det_t>
+std::size_t geometry_memory(const det_t &det) {
+    using transform_store_t = typename det_t::transform_container;
+
+    std::size_t trf_size{sizeof(typename det_t::transform3)};
+    if constexpr (detail::has_compact_placements_v<transform_store_t>) {
+        trf_size = sizeof(typename transform_store_t::compact_type);
+    }
+    return det.transform_store().size() * trf_size +
+           det.surface_lookup().size() * sizeof(typename det_t::surface_type) +
+           det.volumes().size() * sizeof(typename det_t::volume_type);
+}
+
+/// Propagate tracks through the toy detector in a homogeneous solenoid field
+template <typename stepper_t, typename metadata_t = toy_metadata<>>
+void BM_PROPAGATION(benchmark::State &state) {
+
+    using track_transform3_t = typename stepper_t::transform3_type;
+    using track_t = free_track_parameters<track_transform3_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, parameter_transporter<track_transform3_t>,
+                    parameter_resetter<track_transform3_t>>;
+
+    const auto det = create_toy_geometry<host_container_types, metadata_t>(
+        host_mr,
+        bfield_t(bfield_t::backend_t::configuration_t{
+            0.f, 0.f, 2.f * unit<scalar>::T}),
+        n_brl_layers, n_edc_layers);
+
+    using det_t = std::remove_cv_t<decltype(det)>;
+    using propagator_t = propagator<stepper_t, navigator<det_t>, actor_chain_t>;
+
+    const auto n_steps{static_cast<std::size_t>(state.range(0))};
+    const point3 ori{0.f, 0.f, 0.f};
+    const scalar p_mag{static_cast<scalar>(state.range(1)) *
+                       unit<scalar>::GeV};
+
+    propagator_t p(stepper_t{}, navigator<det_t>{});
+
+    std::size_t n_tracks{0u};
+    std::size_t n_success{0u};
+
+    for (auto _ : state) {
+        for (const auto track : uniform_track_generator<track_t>(
+                 n_steps, n_steps, {ori[0], ori[1], ori[2]}, p_mag)) {
+
+            typename parameter_transporter<track_transform3_t>::state
+                transporter_state{};
+            typename parameter_resetter<track_transform3_t>::state
+                resetter_state{};
+            auto actor_states = std::tie(transporter_state, resetter_state);
+
+            typename propagator_t::state p_state(track, det.get_bfield(), det);
+
+            benchmark::DoNotOptimize(n_success);
+            n_success += p.propagate(p_state, actor_states);
+            ++n_tracks;
+        }
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+    state.counters["SuccessRate"] =
+        static_cast<double>(n_success) / static_cast<double>(n_tracks);
+    state.counters["GeometryBytes"] =
+        static_cast<double>(geometry_memory(det));
+}
+
+/// Propagate tracks through a telescope detector in a homogeneous field,
+/// with the geometry in the precision @tparam det_scalar_t and the track
+/// state in the precision @tparam track_scalar_t
+template <typename det_scalar_t, typename track_scalar_t>
+void BM_TELESCOPE_PROPAGATION(benchmark::State &state) {
+
+    using det_transform3_t = __plugin::transform3<det_scalar_t>;
+    using track_transform3_t = __plugin::transform3<track_scalar_t>;
+    using mask_t = mask<rectangle2D<>, std::uint_least16_t, det_transform3_t>;
+    using tel_bfield_t = covfie::field<typename telescope_metadata<
+        rectangle2D<>, det_transform3_t>::bfield_backend_t>;
+
+    using track_t = free_track_parameters<track_transform3_t>;
+    using stepper_t = rk_stepper<typename tel_bfield_t::view_t,
+                                 track_transform3_t, constrained_step<>>;
+    using actor_chain_t =
+        actor_chain<dtuple, parameter_transporter<track_transform3_t>,
+                    parameter_resetter<track_transform3_t>>;
+
+    // Ten 1m x 1m modules along the z-axis
+    const mask_t rectangle{0u, 0.5f * unit<det_scalar_t>::m,
+                           0.5f * unit<det_scalar_t>::m};
+    const auto det = create_telescope_detector(
+        host_mr,
+        tel_bfield_t(typename tel_bfield_t::backend_t::configuration_t{
+            0.f, 0.f, 2.f * unit<det_scalar_t>::T}),
+        rectangle, 10u, 1.f * unit<det_scalar_t>::m);
+
+    using det_t = std::remove_cv_t<decltype(det)>;
+    using propagator_t = propagator<stepper_t, navigator<det_t>, actor_chain_t>;
+
+    const auto n_steps{static_cast<std::size_t>(state.range(0))};
+    const point3 ori{0.f, 0.f, 0.f};
+    const scalar p_mag{static_cast<scalar>(state.range(1)) *
+                       unit<scalar>::GeV};
+
+    propagator_t p(stepper_t{}, navigator<det_t>{});
+
+    std::size_t n_tracks{0u};
+    std::size_t n_success{0u};
+
+    for (auto _ : state) {
+        // Tracks in the forward direction, which cross the telescope
+        for (const auto track : uniform_track_generator<track_t>(
+                 n_steps, n_steps, {ori[0], ori[1], ori[2]}, p_mag,
+                 {0.01f, 0.2f})) {
+
+            typename parameter_transporter<track_transform3_t>::state
+                transporter_state{};
+            typename parameter_resetter<track_transform3_t>::state
+                resetter_state{};
+            auto actor_states = std::tie(transporter_state, resetter_state);
+
+            typename propagator_t::state p_state(track, det.get_bfield(), det);
+
+            benchmark::DoNotOptimize(n_success);
+            n_success += p.propagate(p_state, actor_states);
+            ++n_tracks;
+        }
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+    state.counters["SuccessRate"] =
+        static_cast<double>(n_success) / static_cast<double>(n_tracks);
+    state.counters["GeometryBytes"] =
+        static_cast<double>(geometry_memory(det));
+}
+
+/// Mock Kalman fitter loop over the toy detector: Propagate from sensitive
+/// surface to sensitive surface and hand back the parameters after every
+/// leg, either by resuming the propagation or by restarting it per leg
+template <bool resumable>
+void BM_KALMAN_LOOP(benchmark::State &state) {
+
+    using track_t = free_track_parameters<transform3>;
+    using bound_track_t = bound_track_parameters<transform3>;
+    using transporter_t = parameter_transporter<transform3>;
+    using resetter_t = parameter_resetter<transform3>;
+    using actor_chain_t = actor_chain<dtuple, transporter_t, resetter_t>;
+    using leg_actor_chain_t =
+        actor_chain<dtuple, transporter_t, next_surface_aborter, resetter_t>;
+    using propagator_t = propagator<rk_stepper_t, navigator_t, actor_chain_t>;
+    using leg_propagator_t =
+        propagator<rk_stepper_t, navigator_t, leg_actor_chain_t>;
+
+    const auto det = create_toy_geometry(
+        host_mr,
+        bfield_t(bfield_t::backend_t::configuration_t{
+            0.f, 0.f, 2.f * unit<scalar>::T}),
+        n_brl_layers, n_edc_layers);
+
+    const auto n_steps{static_cast<std::size_t>(state.range(0))};
+    const point3 ori{0.f, 0.f, 0.f};
+    const scalar p_mag{static_cast<scalar>(state.range(1)) *
+                       unit<scalar>::GeV};
+    const scalar min_step_length{0.1f * unit<scalar>::mm};
+
+    propagator_t p(rk_stepper_t{}, navigator_t{});
+    leg_propagator_t leg_p(rk_stepper_t{}, navigator_t{});
+
+    std::size_t n_tracks{0u};
+    std::size_t n_legs{0u};
+
+    for (auto _ : state) {
+        for (const auto track : uniform_track_generator<track_t>(
+                 n_steps, n_steps, {ori[0], ori[1], ori[2]}, p_mag)) {
+
+            typename transporter_t::state transporter_state{};
+            typename resetter_t::state resetter_state{};
+
+            if constexpr (resumable) {
+                auto actor_states = std::tie(transporter_state, resetter_state);
+                typename propagator_t::state p_state(track, det.get_bfield(),
+                                                     det);
+
+                while (p.propagate_to_next_sensitive(p_state, actor_states)) {
+                    // Mock measurement update
+                    p_state.set_bound_params(p_state._stepping._bound_params);
+                    ++n_legs;
+                }
+            } else {
+                next_surface_aborter::state aborter_state{min_step_length};
+                typename leg_propagator_t::state p_state(
+                    track, det.get_bfield(), det);
+
+                leg_p.propagate(p_state, std::tie(transporter_state,
+                                                  aborter_state,
+                                                  resetter_state));
+
+                // Mock measurement update, then restart from the surface
+                bound_track_t bound_params{p_state._stepping._bound_params};
+                bool on_surface{aborter_state.success};
+                while (on_surface) {
+                    ++n_legs;
+
+                    next_surface_aborter::state leg_aborter_state{
+                        min_step_length};
+                    typename leg_propagator_t::state leg_state(
+                        bound_params, det.get_bfield(), det);
+                    leg_state._navigation.set_volume(
+                        bound_params.surface_link().volume());
+
+                    leg_p.propagate(leg_state, std::tie(transporter_state,
+                                                        leg_aborter_state,
+                                                        resetter_state));
+
+                    on_surface = leg_aborter_state.success;
+                    bound_params = leg_state._stepping._bound_params;
+                }
+            }
+            benchmark::DoNotOptimize(n_legs);
+            ++n_tracks;
+        }
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+    state.counters["LegsPerTrack"] =
+        static_cast<double>(n_legs) / static_cast<double>(n_tracks);
+}
+
+/// Propagate low momentum tracks that loop in the toy detector, either
+/// bounded by a path limit only or stopped early by the looper aborters
+template <bool with_aborters>
+void BM_LOW_PT_PROPAGATION(benchmark::State &state) {
+
+    using track_t = free_track_parameters<transform3>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, min_pT_aborter,
+                    step_limit_aborter, volume_switch_aborter,
+                    stuck_track_aborter, looper_aborter>;
+    using propagator_t = propagator<rk_stepper_t, navigator_t, actor_chain_t>;
+
+    const auto det = create_toy_geometry(
+        host_mr,
+        bfield_t(bfield_t::backend_t::configuration_t{
+            0.f, 0.f, 2.f * unit<scalar>::T}),
+        n_brl_layers, n_edc_layers);
+
+    const auto n_steps{static_cast<std::size_t>(state.range(0))};
+    const point3 ori{0.f, 0.f, 0.f};
+    const scalar p_mag{static_cast<scalar>(state.range(1)) *
+                       unit<scalar>::MeV};
+
+    propagator_t p(rk_stepper_t{}, navigator_t{});
+
+    aborter_statistics stats{};
+    std::size_t n_steps_total{0u};
+
+    for (auto _ : state) {
+        for (const auto track : uniform_track_generator<track_t>(
+                 n_steps, n_steps, {ori[0], ori[1], ori[2]}, p_mag)) {
+
+            pathlimit_aborter::state pathlimit_state{10.f * unit<scalar>::m};
+            min_pT_aborter::state min_pT_state{};
+            step_limit_aborter::state step_limit_state{};
+            volume_switch_aborter::state volume_switch_state{};
+            stuck_track_aborter::state stuck_state{};
+            looper_aborter::state looper_state{};
+
+            // Without the cuts, the aborters only collect statistics
+            if constexpr (with_aborters) {
+                min_pT_state._min_pT = 50.f * unit<scalar>::MeV;
+                step_limit_state._max_steps = 10000u;
+                volume_switch_state._max_switches = 20u;
+            } else {
+                stuck_state._max_zero_progress =
+                    std::numeric_limits<std::size_t>::max();
+                looper_state._max_visits =
+                    std::numeric_limits<std::size_t>::max();
+            }
+
+            auto actor_states =
+                std::tie(pathlimit_state, min_pT_state, step_limit_state,
+                         volume_switch_state, stuck_state, looper_state);
+
+            typename propagator_t::state p_state(track, det.get_bfield(),
+                                                 det);
+
+            p.propagate(p_state, actor_states);
+
+            stats.add(pathlimit_state, min_pT_state, step_limit_state,
+                      volume_switch_state, stuck_state, looper_state);
+            n_steps_total += step_limit_state._n_steps;
+        }
+    }
+
+    const auto n_tracks{static_cast<double>(stats.n_tracks)};
+    state.counters["TracksPropagated"] =
+        benchmark::Counter(n_tracks, benchmark::Counter::kIsRate);
+    state.counters["StepsPerTrack"] =
+        static_cast<double>(n_steps_total) / n_tracks;
+    state.counters["MinPTRate"] =
+        static_cast<double>(stats.n_min_pT) / n_tracks;
+    state.counters["StepLimitRate"] =
+        static_cast<double>(stats.n_step_limit) / n_tracks;
+    state.counters["VolumeSwitchRate"] =
+        static_cast<double>(stats.n_volume_switches) / n_tracks;
+    state.counters["StuckRate"] = static_cast<double>(stats.n_stuck) / n_tracks;
+    state.counters["LooperRate"] =
+        static_cast<double>(stats.n_loopers) / n_tracks;
+}
+
+/// @returns the homogeneous 2T field of the toy detector in the stepper
+/// benchmarks
+bfield_t solenoid_field() {
+    return bfield_t(bfield_t::backend_t::configuration_t{
+        0.f, 0.f, 2.f * unit<scalar>::T});
+}
+
+/// Track sample of the stepper benchmarks: The tracks that cross the toy
+/// detector and the path length that each of them travels through it
+struct stepper_track_sample {
+    std::vector<free_track_parameters<transform3>> tracks{};
+    std::vector<scalar> path_lengths{};
+};
+
+/// @returns the track sample for the stepper benchmarks in the detector
+/// @param det with @param n_steps in theta and phi and the momentum
+/// @param p_mag . The path lengths are found by the full propagation.
+template <typename det_t>
+stepper_track_sample toy_track_sample(const det_t &det,
+                                      const std::size_t n_steps,
+                                      const scalar p_mag) {
+
+    using track_t = free_track_parameters<transform3>;
+    using propagator_t =
+        propagator<rk_stepper_t, navigator<det_t>, actor_chain<>>;
+
+    const point3 ori{0.f, 0.f, 0.f};
+
+    propagator_t p(rk_stepper_t{}, navigator<det_t>{});
+
+    stepper_track_sample sample{};
+    for (const auto track : uniform_track_generator<track_t>(
+             n_steps, n_steps, {ori[0], ori[1], ori[2]}, p_mag)) {
+
+        typename propagator_t::state p_state(track, det.get_bfield(), det);
+        if (p.propagate(p_state)) {
+            sample.tracks.push_back(track);
+            sample.path_lengths.push_back(
+                static_cast<scalar>(p_state._stepping.path_length()));
+        }
+    }
+    return sample;
+}
+
+/// Navigation stub for the scalar stepper: The next "surface" is always at
+/// the remaining path length
+struct field_only_navigation {
+    scalar operator()() const { return _distance; }
+
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() {
+        _aborted = true;
+        return false;
+    }
+
+    scalar _distance{0.f};
+    bool _aborted{false};
+};
+
+/// Propagation state of the scalar stepper without navigation
+template <typename stepping_t>
+struct field_only_propagation {
+    stepping_t _stepping;
+    field_only_navigation _navigation;
+};
+
+/// Transport tracks one at a time with the scalar @c rk_stepper through the
+/// field of the toy detector, every track over the path length that it
+/// travels in the detector. This is the reference for the stepper packs,
+/// which neither navigate nor transport the covariance: The navigation is
+/// replaced by the known path length and only the track parameters are
+/// transported.
+void BM_RK_STEPPER_SCALAR(benchmark::State &state) {
+
+    using stepper_t = rk_stepper<bfield_t::view_t, transform3>;
+
+    const auto det = create_toy_geometry(host_mr, solenoid_field(),
+                                         n_brl_layers, n_edc_layers);
+    const auto sample = toy_track_sample(
+        det, static_cast<std::size_t>(state.range(0)),
+        static_cast<scalar>(state.range(1)) * unit<scalar>::GeV);
+
+    stepper_t stepper{};
+
+    std::size_t n_tracks{0u};
+    std::size_t n_success{0u};
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < sample.tracks.size(); ++i) {
+            const scalar path_limit{sample.path_lengths[i]};
+
+            field_only_propagation<typename stepper_t::state> propagation{
+                typename stepper_t::state{sample.tracks[i], det.get_bfield()},
+                {}};
+            auto &stepping = propagation._stepping;
+            auto &navigation = propagation._navigation;
+            stepping._transport_covariance = false;
+
+            // Same termination criterion as the lanes of the packs
+            while (not navigation._aborted and
+                   path_limit - stepping.path_length() >=
+                       stepping._step_size_cutoff) {
+                navigation._distance = path_limit - stepping.path_length();
+                stepper.step(propagation);
+            }
+
+            benchmark::DoNotOptimize(stepping());
+            n_success += navigation._aborted ? 0u : 1u;
+            ++n_tracks;
+        }
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+    state.counters["SuccessRate"] =
+        static_cast<double>(n_success) / static_cast<double>(n_tracks);
+}
+
+/// Transport tracks in packs of @tparam N lanes through the field of the toy
+/// detector, with the same track sample and path lengths as the scalar
+/// reference. The lanes diverge, since every track stops at its own path
+/// length.
+template <std::size_t N>
+void BM_RK_STEPPER_PACK(benchmark::State &state) {
+
+    using track_t = free_track_parameters<transform3>;
+    using stepper_t = rk_stepper_pack<bfield_t::view_t, transform3, N>;
+
+    const auto det = create_toy_geometry(host_mr, solenoid_field(),
+                                         n_brl_layers, n_edc_layers);
+    const auto sample = toy_track_sample(
+        det, static_cast<std::size_t>(state.range(0)),
+        static_cast<scalar>(state.range(1)) * unit<scalar>::GeV);
+
+    stepper_t stepper{};
+
+    std::size_t n_tracks{0u};
+    std::size_t n_success{0u};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<track_t> pack_tracks{sample.tracks};
+        typename stepper_t::state stepping(det.get_bfield());
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(n_success);
+        n_success +=
+            stepper.propagate(stepping, pack_tracks, sample.path_lengths);
+        n_tracks += pack_tracks.size();
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+    state.counters["SuccessRate"] =
+        static_cast<double>(n_success) / static_cast<double>(n_tracks);
+}
+
+}  // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_PROPAGATION, rk_stepper_t)
+    ->Name("RK_STEPPER_PROPAGATION")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+// Double precision track state in the detector of precision detray::scalar
+BENCHMARK_TEMPLATE(BM_PROPAGATION, mixed_rk_stepper_t)
+    ->Name("MIXED_PRECISION_RK_STEPPER_PROPAGATION")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+// Double precision track state in a double and in a single precision
+// geometry
+BENCHMARK_TEMPLATE(BM_TELESCOPE_PROPAGATION, double, double)
+    ->Name("TELESCOPE_PROPAGATION_DOUBLE")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_TELESCOPE_PROPAGATION, float, double)
+    ->Name("TELESCOPE_PROPAGATION_FLOAT_GEOMETRY")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_PROPAGATION, helix_stepper_t)
+    ->Name("HELIX_STEPPER_PROPAGATION")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+// Surface placements in compact form (rotation and translation only)
+BENCHMARK_TEMPLATE(BM_PROPAGATION, rk_stepper_t, compact_toy_metadata)
+    ->Name("RK_STEPPER_PROPAGATION_COMPACT_TRANSFORMS")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+// Mock Kalman fitter loop: resumable propagation vs. restart per leg
+BENCHMARK_TEMPLATE(BM_KALMAN_LOOP, true)
+    ->Name("KALMAN_LOOP_RESUMABLE")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_KALMAN_LOOP, false)
+    ->Name("KALMAN_LOOP_RESTART_PER_LEG")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+// Low-pT track sample with and without the looper aborters
+BENCHMARK_TEMPLATE(BM_LOW_PT_PROPAGATION, false)
+    ->Name("LOW_PT_PROPAGATION")
+    ->ArgsProduct({{10}, {50, 100, 200}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_LOW_PT_PROPAGATION, true)
+    ->Name("LOW_PT_PROPAGATION_ABORTERS")
+    ->ArgsProduct({{10}, {50, 100, 200}})
+    ->Unit(benchmark::kMillisecond);
+
+// Tracks of the toy detector advanced one at a time by the scalar stepper
+// and in lockstep, one lane per track (parameters only, no navigation)
+BENCHMARK(BM_RK_STEPPER_SCALAR)
+    ->Name("RK_STEPPER_SCALAR")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_RK_STEPPER_PACK, 4)
+    ->Name("RK_STEPPER_PACK_4")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_RK_STEPPER_PACK, 8)
+    ->Name("RK_STEPPER_PACK_8")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_RK_STEPPER_PACK, 16)
+    ->Name("RK_STEPPER_PACK_16")
+    ->ArgsProduct({{10, 50}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
@@ -14,8 +14,13 @@
 
 #include "benchmark_propagator_cuda_kernel.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/utils/track_ordering.hpp"
 #include "vecmem/utils/cuda/copy.hpp"
 
+// System include(s)
+#include <algorithm>
+#include <random>
+
 using namespace detray;
 
 // VecMem memory resource(s)
@@ -41,7 +46,7 @@ void fill_tracks(vecmem::vector<free_track_parameters<transform3>> &tracks,
     }
 }
 
-template <propagate_option opt>
+template <propagate_option opt, bool shuffled = false, bool sorted = false>
 static void BM_PROPAGATOR_CPU(benchmark::State &state) {
 
     // Create the toy geometry
@@ -60,6 +65,12 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
     // Create propagator
     propagator_host_type p(std::move(s), std::move(n));
 
+    // Orders the tracks by starting volume, eta, phi and momentum
+    const track_sorter<detector_host_type> sorter{det};
+    std::mt19937_64 shuffle_engine{42u};
+
+    using track_t = free_track_parameters<transform3>;
+
     std::size_t total_tracks = 0;
 
     for (auto _ : state) {
@@ -68,16 +79,30 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
         state.PauseTiming();
 
         // Get tracks
-        vecmem::vector<free_track_parameters<transform3>> tracks(&host_mr);
+        vecmem::vector<track_t> tracks(&host_mr);
         fill_tracks(tracks, static_cast<std::size_t>(state.range(0)),
                     static_cast<std::size_t>(state.range(0)));
+        // The generator orders the tracks in theta and phi: Shuffle them
+        // to mimic an incoherent batch
+        if constexpr (shuffled) {
+            std::shuffle(tracks.begin(), tracks.end(), shuffle_engine);
+        }
+
+        // Final track parameters, in the order of the (sorted) batch
+        vecmem::vector<track_t> results(tracks.size(), &host_mr);
 
         total_tracks += tracks.size();
 
         state.ResumeTiming();
 
+        // Pre-pass: Group similar tracks (part of the measured time)
+        track_sorter<detector_host_type>::permutation_type perm{};
+        if constexpr (sorted) {
+            perm = sorter(tracks);
+        }
+
 #pragma omp parallel for
-        for (auto &track : tracks) {
+        for (std::size_t i = 0u; i < tracks.size(); ++i) {
 
             parameter_transporter<transform3>::state transporter_state{};
             pointwise_material_interactor<transform3>::state interactor_state{};
@@ -87,7 +112,8 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
                 tie(transporter_state, interactor_state, resetter_state);
 
             // Create the propagator state
-            propagator_host_type::state p_state(track, det.get_bfield(), det);
+            propagator_host_type::state p_state(tracks[i], det.get_bfield(),
+                                                det);
 
             // Run propagation
             if constexpr (opt == propagate_option::e_unsync) {
@@ -95,7 +121,15 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
             } else if constexpr (opt == propagate_option::e_sync) {
                 p.propagate_sync(p_state, actor_states);
             }
+
+            results[i] = p_state._stepping();
         }
+
+        // Post-pass: Put the results back into the order of the batch
+        if constexpr (sorted) {
+            sorter.restore(results, perm);
+        }
+        benchmark::DoNotOptimize(results.data());
     }
 
     state.counters["TracksPropagated"] = benchmark::Counter(
@@ -154,6 +188,22 @@ BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_sync)
     ->Name("CPU sync propagation")
     ->RangeMultiplier(2)
     ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_unsync, true)
+    ->Name("CPU unsync propagation, shuffled tracks")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_unsync, true, true)
+    ->Name("CPU unsync propagation, sorted tracks")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_sync, true)
+    ->Name("CPU sync propagation, shuffled tracks")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_sync, true, true)
+    ->Name("CPU sync propagation, sorted tracks")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
 BENCHMARK_TEMPLATE(BM_PROPAGATOR_CUDA, propagate_option::e_unsync)
     ->Name("CUDA unsync propagation")
     ->RangeMultiplier(2)
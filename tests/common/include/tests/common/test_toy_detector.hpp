@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/core/detector_handle.hpp"
 #include "detray/test/types.hpp"
 
 // GTest include(s)
@@ -970,4 +971,10 @@ inline bool test_toy_detector(const detector<toy_metadata<>>& toy_det) {
     return true;
 }
 
+/// Check the toy detector that is shared through the handle @param toy_det
+inline bool test_toy_detector(
+    const detector_handle<detector<toy_metadata<>>>& toy_det) {
+    return test_toy_detector(*toy_det);
+}
+
 }  // namespace detray
@@ -9,10 +9,10 @@
 
 // Project include(s)
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersection_kernel.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
 #include "detray/utils/ranges.hpp"
-#include "tests/common/tools/intersectors/helix_intersection_kernel.hpp"
 
 // System include(s)
 #include <cmath>
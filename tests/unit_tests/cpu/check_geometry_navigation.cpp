@@ -7,6 +7,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <iostream>
 #include <sstream>
 #include <vecmem/memory/host_memory_resource.hpp>
 
@@ -14,14 +16,18 @@
 #include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
 #include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/constrained_step.hpp"
 #include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/navigation_policies.hpp"
 #include "detray/propagator/navigator.hpp"
 #include "detray/propagator/propagator.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/tools/portal_entry_cache_builder.hpp"
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/inspectors.hpp"
+#include "detray/utils/telemetry.hpp"
 #include "tests/common/tools/particle_gun.hpp"
 
 using namespace detray;
@@ -118,6 +124,204 @@ GTEST_TEST(detray_propagator, straight_line_navigation) {
     }
 }
 
+/// This test compares the straight line navigation with and without the
+/// precomputed candidates of the portal entry cache.
+GTEST_TEST(detray_propagator, portal_entry_cache_navigation) {
+
+    // Detector configuration
+    constexpr std::size_t n_brl_layers{4u};
+    constexpr std::size_t n_edc_layers{7u};
+    vecmem::host_memory_resource host_mr;
+    auto det = create_toy_geometry(host_mr, n_brl_layers, n_edc_layers);
+
+    using detector_t = decltype(det);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, transform3_t>;
+    using object_tracer_t =
+        object_tracer<intersection_t, dvector, status::e_on_module,
+                      status::e_on_portal>;
+    using inspector_t = aggregate_inspector<object_tracer_t, print_inspector>;
+    using navigator_t = navigator<detector_t, inspector_t, intersection_t>;
+    using stepper_t =
+        line_stepper<transform3_t, unconstrained_step, always_init>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    // Build the cache
+    const auto cache =
+        portal_entry_cache_builder<detector_t>{}.build(det, host_mr);
+
+    ASSERT_GT(cache.n_portals(), 0u);
+    ASSERT_GT(cache.n_entries(), 0u);
+
+    propagator_t prop(stepper_t{}, navigator_t{});
+
+    constexpr std::size_t theta_steps{50u};
+    constexpr std::size_t phi_steps{50u};
+    const point3 ori{0.f, 0.f, 0.f};
+
+    for (const auto ray :
+         uniform_track_generator<ray_type>(theta_steps, phi_steps, ori)) {
+
+        free_track_parameters_type track(ray.pos(), 0.f, ray.dir(), -1.f);
+
+        propagator_t::state propagation(track, det);
+        propagator_t::state cached_propagation(track, det);
+        cached_propagation._navigation.set_portal_cache(&cache);
+
+        ASSERT_TRUE(prop.propagate(propagation));
+        ASSERT_TRUE(prop.propagate(cached_propagation))
+            << cached_propagation._navigation.inspector()
+                   .template get<print_inspector>()
+                   .to_string();
+
+        // Both navigation flows have to find the same surfaces
+        const auto &obj_tracer = propagation._navigation.inspector()
+                                     .template get<object_tracer_t>();
+        const auto &cached_obj_tracer =
+            cached_propagation._navigation.inspector()
+                .template get<object_tracer_t>();
+
+        ASSERT_EQ(obj_tracer.object_trace.size(),
+                  cached_obj_tracer.object_trace.size());
+        for (std::size_t i = 0u; i < obj_tracer.object_trace.size(); ++i) {
+            EXPECT_EQ(obj_tracer.object_trace[i].surface.barcode(),
+                      cached_obj_tracer.object_trace[i].surface.barcode());
+        }
+    }
+}
+
+/// This test compares the navigation of bending tracks, which do not start at
+/// the origin, with and without the portal entry cache. The cache is built
+/// for the field strength and the lowest momentum of the tracks.
+GTEST_TEST(detray_propagator, portal_entry_cache_helix_navigation) {
+
+    // Detector configuration
+    constexpr std::size_t n_brl_layers{4u};
+    constexpr std::size_t n_edc_layers{7u};
+    vecmem::host_memory_resource host_mr;
+
+    using b_field_t = detector<toy_metadata<>>::bfield_type;
+
+    const scalar bz{2.f * unit<scalar>::T};
+    auto det = create_toy_geometry(
+        host_mr, b_field_t(b_field_t::backend_t::configuration_t{0.f, 0.f, bz}),
+        n_brl_layers, n_edc_layers);
+
+    using detector_t = decltype(det);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, transform3_t>;
+    using object_tracer_t =
+        object_tracer<intersection_t, dvector, status::e_on_module,
+                      status::e_on_portal>;
+    using inspector_t = aggregate_inspector<object_tracer_t, print_inspector>;
+    using navigator_t = navigator<detector_t, inspector_t, intersection_t>;
+    using tel_navigator_t =
+        navigator<detector_t, telemetry::inspector<>, intersection_t>;
+    using stepper_t =
+        rk_stepper<b_field_t::view_t, transform3_t, unconstrained_step>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+    using tel_propagator_t =
+        propagator<stepper_t, tel_navigator_t, actor_chain<>>;
+
+    // Build the cache for tracks down to the lowest momentum of the sample
+    const scalar p_min{1.f * unit<scalar>::GeV};
+
+    portal_entry_cache_builder<detector_t>::config cfg{};
+    cfg.bfield = bz;
+    cfg.min_p = p_min;
+    const auto cache =
+        portal_entry_cache_builder<detector_t>{cfg}.build(det, host_mr);
+
+    // The straight line cache does not cover charged tracks in the field
+    const auto sl_cache =
+        portal_entry_cache_builder<detector_t>{}.build(det, host_mr);
+    ASSERT_GT(cache.n_entries(), sl_cache.n_entries());
+    for (const auto &sf : det.surface_lookup()) {
+        if (sl_cache.contains(sf.index())) {
+            EXPECT_TRUE(sl_cache.covers(sf.index(), 0.f));
+            EXPECT_FALSE(sl_cache.covers(sf.index(), 1.f / (10.f * p_min)));
+            EXPECT_TRUE(cache.covers(sf.index(), -1.f / p_min));
+        }
+    }
+
+    propagator_t prop(stepper_t{}, navigator_t{});
+    tel_propagator_t tel_prop(stepper_t{}, tel_navigator_t{});
+
+    constexpr std::size_t theta_steps{20u};
+    constexpr std::size_t phi_steps{20u};
+    const point3 ori{2.f * unit<scalar>::mm, -3.f * unit<scalar>::mm,
+                     15.f * unit<scalar>::mm};
+    constexpr scalar overstep_tol{-100.f * unit<scalar>::um};
+
+    std::uint64_t n_tested{0u};
+    std::uint64_t n_tested_cached{0u};
+
+    for (const scalar p_mag : {p_min, 10.f * unit<scalar>::GeV}) {
+        for (const scalar q : {-1.f, 1.f}) {
+            auto trk_gen = uniform_track_generator<free_track_parameters_type>(
+                theta_steps, phi_steps, ori, p_mag,
+                {0.01f, constant<scalar>::pi},
+                {-constant<scalar>::pi, constant<scalar>::pi}, 0.f, q);
+
+            for (auto track : trk_gen) {
+
+                track.set_overstep_tolerance(overstep_tol);
+
+                propagator_t::state propagation(track, det.get_bfield(), det);
+                propagator_t::state cached_propagation(track, det.get_bfield(),
+                                                       det);
+                cached_propagation._navigation.set_portal_cache(&cache);
+
+                ASSERT_TRUE(prop.propagate(propagation));
+                ASSERT_TRUE(prop.propagate(cached_propagation))
+                    << cached_propagation._navigation.inspector()
+                           .template get<print_inspector>()
+                           .to_string();
+
+                // Both navigation flows have to find the same surfaces
+                const auto &obj_tracer = propagation._navigation.inspector()
+                                             .template get<object_tracer_t>();
+                const auto &cached_obj_tracer =
+                    cached_propagation._navigation.inspector()
+                        .template get<object_tracer_t>();
+
+                ASSERT_EQ(obj_tracer.object_trace.size(),
+                          cached_obj_tracer.object_trace.size());
+                for (std::size_t i = 0u; i < obj_tracer.object_trace.size();
+                     ++i) {
+                    EXPECT_EQ(
+                        obj_tracer.object_trace[i].surface.barcode(),
+                        cached_obj_tracer.object_trace[i].surface.barcode());
+                }
+
+                // Count the intersections that were tested
+                tel_propagator_t::state tel_propagation(
+                    track, det.get_bfield(), det);
+                tel_propagator_t::state cached_tel_propagation(
+                    track, det.get_bfield(), det);
+                cached_tel_propagation._navigation.set_portal_cache(&cache);
+
+                ASSERT_TRUE(tel_prop.propagate(tel_propagation));
+                ASSERT_TRUE(tel_prop.propagate(cached_tel_propagation));
+
+                n_tested += tel_propagation._navigation.inspector().get(
+                    telemetry::counter::e_intersections_tested);
+                n_tested_cached +=
+                    cached_tel_propagation._navigation.inspector().get(
+                        telemetry::counter::e_intersections_tested);
+            }
+        }
+    }
+
+    // Report the reduction of the tested intersections
+    std::cout << "Portal entry cache: " << n_tested_cached << " instead of "
+              << n_tested << " tested intersections ("
+              << 100.f * (1.f - static_cast<float>(n_tested_cached) /
+                                    static_cast<float>(n_tested))
+              << "% fewer)" << std::endl;
+    EXPECT_LT(n_tested_cached, n_tested);
+}
+
 /// Check the Runge-Kutta based navigation against a helix trajectory as ground
 /// truth
 GTEST_TEST(detray_propagator, helix_navigation) {
@@ -232,3 +436,77 @@ GTEST_TEST(detray_propagator, helix_navigation) {
         ++n_tracks;
     }
 }
+
+/// Compare the Runge-Kutta based navigation with short, constrained steps
+/// with and without the safety distance
+GTEST_TEST(detray_propagator, safety_navigation) {
+    using namespace navigation;
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+
+    using b_field_t = detector<toy_metadata<>>::bfield_type;
+
+    const vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+
+    auto det = create_toy_geometry(
+        host_mr,
+        b_field_t(b_field_t::backend_t::configuration_t{B[0], B[1], B[2]}));
+
+    using detector_t = decltype(det);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, transform3_t>;
+    using object_tracer_t =
+        object_tracer<intersection_t, dvector, status::e_on_module,
+                      status::e_on_portal>;
+    using navigator_t = navigator<detector_t, object_tracer_t, intersection_t>;
+    using constraints_t = constrained_step<>;
+    using stepper_t = rk_stepper<b_field_t::view_t, transform3_t,
+                                 constraints_t, stepper_default_policy>;
+    using safety_stepper_t =
+        rk_stepper<b_field_t::view_t, transform3_t, constraints_t,
+                   safety_policy>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+    using safety_propagator_t =
+        propagator<safety_stepper_t, navigator_t, actor_chain<>>;
+
+    propagator_t prop(stepper_t{}, navigator_t{});
+    safety_propagator_t safety_prop(safety_stepper_t{}, navigator_t{});
+
+    constexpr std::size_t theta_steps{5u};
+    constexpr std::size_t phi_steps{5u};
+    const point3 ori{0.f, 0.f, 0.f};
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr scalar step_constr{5.f * unit<scalar>::mm};
+
+    for (auto track : uniform_track_generator<free_track_parameters_type>(
+             theta_steps, phi_steps, ori, p_mag)) {
+        track.set_overstep_tolerance(-100.f * unit<scalar>::um);
+
+        propagator_t::state propagation(track, det.get_bfield(), det);
+        safety_propagator_t::state safety_propagation(track, det.get_bfield(),
+                                                      det);
+        propagation._stepping
+            .template set_constraint<step::constraint::e_accuracy>(
+                step_constr);
+        safety_propagation._stepping
+            .template set_constraint<step::constraint::e_accuracy>(
+                step_constr);
+
+        ASSERT_TRUE(prop.propagate(propagation));
+        ASSERT_TRUE(safety_prop.propagate(safety_propagation));
+
+        // Both navigation flows have to find the same surfaces
+        const auto &obj_tracer = propagation._navigation.inspector();
+        const auto &safety_obj_tracer =
+            safety_propagation._navigation.inspector();
+
+        ASSERT_EQ(obj_tracer.object_trace.size(),
+                  safety_obj_tracer.object_trace.size());
+        for (std::size_t i = 0u; i < obj_tracer.object_trace.size(); ++i) {
+            EXPECT_EQ(obj_tracer.object_trace[i].surface.barcode(),
+                      safety_obj_tracer.object_trace[i].surface.barcode());
+        }
+    }
+}
@@ -16,6 +16,7 @@
 #include "detray/test/types.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/statistics.hpp"
+#include "tests/common/test_toy_detector.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -201,6 +202,59 @@ GTEST_TEST(detray_simulation, toy_geometry_simulation) {
     }
 }
 
+// Test that simulators share one detector instead of copying it
+GTEST_TEST(detray_simulation, shared_detector_handle) {
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto det_handle = make_detector_handle(create_toy_geometry(host_mr));
+    ASSERT_EQ(det_handle.use_count(), 1);
+
+    const vector3 ori{0.f, 0.f, 0.f};
+    const scalar mom{1.f * unit<scalar>::GeV};
+    measurement_smearer<transform3> smearer(50.f * unit<scalar>::um,
+                                            50.f * unit<scalar>::um);
+
+    auto sim_1 = simulator(
+        1u, det_handle,
+        uniform_track_generator<free_track_parameters<transform3>>(1u, 1u, ori,
+                                                                   mom),
+        smearer);
+    auto sim_2 = simulator(
+        1u, det_handle,
+        uniform_track_generator<free_track_parameters<transform3>>(1u, 1u, ori,
+                                                                   mom),
+        smearer);
+
+    // Both simulators refer to the same geometry
+    EXPECT_EQ(det_handle.use_count(), 3);
+    EXPECT_EQ(&sim_1.get_detector(), det_handle.get());
+    EXPECT_EQ(&sim_2.get_detector(), det_handle.get());
+
+    // A detector that is passed by reference is copied
+    const auto& det = *det_handle;
+    auto sim_3 = simulator(
+        1u, det,
+        uniform_track_generator<free_track_parameters<transform3>>(1u, 1u, ori,
+                                                                   mom),
+        smearer);
+    EXPECT_NE(&sim_3.get_detector(), &det);
+    EXPECT_EQ(sim_3.get_detector_handle().use_count(), 1);
+    EXPECT_EQ(det_handle.use_count(), 3);
+
+    // ... unless a non-owning handle is requested explicitly
+    auto sim_4 = simulator(
+        1u, make_non_owning_detector_handle(det),
+        uniform_track_generator<free_track_parameters<transform3>>(1u, 1u, ori,
+                                                                   mom),
+        smearer);
+    EXPECT_EQ(&sim_4.get_detector(), &det);
+    EXPECT_EQ(det_handle.use_count(), 3);
+
+    // The test utilities accept the handle
+    EXPECT_TRUE(test_toy_detector(det_handle));
+}
+
 // Test parameters: <initial momentum, theta direction>
 class TelescopeDetectorSimulation
     : public ::testing::TestWithParam<std::tuple<scalar, scalar>> {};
@@ -8,19 +8,26 @@
 // Project include(s)
 #include "detray/core/detector.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/materials/predefined_materials.hpp"
 #include "detray/test/types.hpp"
+#include "detray/tools/detector_assembler.hpp"
 #include "detray/tools/surface_factory.hpp"
 #include "detray/tools/volume_builder.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
 
 // GTest include(s)
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace {
 
@@ -196,6 +203,137 @@ GTEST_TEST(detray_core, detector) {
     EXPECT_EQ(d.surface_store().template size<finder_id::e_default>(), 1u);
 }
 
+/// This tests the flat single-block snapshot of the detector data
+GTEST_TEST(detray_core, detector_snapshot) {
+
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy cpy;
+
+    auto toy_det = create_toy_geometry(host_mr);
+
+    using host_detector_t = decltype(toy_det);
+    using device_detector_t =
+        detector<toy_metadata<>, covfie::field_view, device_container_types>;
+    using mask_id = typename host_detector_t::masks::id;
+
+    auto snapshot = get_snapshot(toy_det, host_mr, cpy);
+
+    ASSERT_GT(snapshot.size(), 0u);
+    EXPECT_EQ(snapshot.size(),
+              get_snapshot_size(detray::get_data(toy_det)._detector_data));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(snapshot.data()) %
+                  detail::snapshot_alignment,
+              0u);
+
+    // The views point into the snapshot block
+    const auto &vol_view = detail::get<0>(snapshot._detector_data.m_view);
+    const auto &sf_view = detail::get<5>(snapshot._detector_data.m_view);
+    EXPECT_EQ(reinterpret_cast<const std::byte *>(vol_view.ptr()),
+              snapshot.data());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(sf_view.ptr()) %
+                  detail::snapshot_alignment,
+              0u);
+    EXPECT_LT(reinterpret_cast<const std::byte *>(sf_view.ptr()),
+              snapshot.data() + snapshot.size());
+
+    // Reconstruct a detector from the snapshot and compare
+    device_detector_t snap_det(snapshot);
+    auto geo_ctx = typename host_detector_t::geometry_context{};
+
+    ASSERT_EQ(snap_det.volumes().size(), toy_det.volumes().size());
+    for (std::size_t i = 0u; i < toy_det.volumes().size(); ++i) {
+        EXPECT_TRUE(snap_det.volumes()[i] == toy_det.volumes()[i]);
+    }
+
+    ASSERT_EQ(snap_det.surface_lookup().size(),
+              toy_det.surface_lookup().size());
+    for (std::size_t i = 0u; i < toy_det.surface_lookup().size(); ++i) {
+        EXPECT_TRUE(snap_det.surface_lookup()[i] ==
+                    toy_det.surface_lookup()[i]);
+    }
+
+    ASSERT_EQ(snap_det.transform_store().size(),
+              toy_det.transform_store().size());
+    for (dindex i = 0u; i < toy_det.transform_store().size(); ++i) {
+        EXPECT_TRUE(snap_det.transform_store().at(i, geo_ctx) ==
+                    toy_det.transform_store().at(i, geo_ctx));
+    }
+
+    const auto &rectangles =
+        toy_det.mask_store().template get<mask_id::e_rectangle2>();
+    const auto &snap_rectangles =
+        snap_det.mask_store().template get<mask_id::e_rectangle2>();
+    ASSERT_EQ(snap_rectangles.size(), rectangles.size());
+    for (std::size_t i = 0u; i < rectangles.size(); ++i) {
+        EXPECT_TRUE(snap_rectangles[i] == rectangles[i]);
+    }
+
+    const auto &cylinders =
+        toy_det.mask_store().template get<mask_id::e_portal_cylinder2>();
+    const auto &snap_cylinders =
+        snap_det.mask_store().template get<mask_id::e_portal_cylinder2>();
+    ASSERT_EQ(snap_cylinders.size(), cylinders.size());
+    for (std::size_t i = 0u; i < cylinders.size(); ++i) {
+        EXPECT_TRUE(snap_cylinders[i] == cylinders[i]);
+    }
+
+    // The volume finder works on the snapshot
+    for (const point3 p : {point3{0.f, 0.f, 0.f}, point3{40.f, 0.f, 0.f},
+                           point3{0.f, 100.f, 300.f},
+                           point3{0.f, 50.f, -700.f}}) {
+        EXPECT_EQ(snap_det.volume_by_pos(p).index(),
+                  toy_det.volume_by_pos(p).index());
+    }
+
+    // Only the offsets are kept: Copy the block to a second buffer and
+    // rebuild the views from its address
+    for (const auto &entry : snapshot._layout) {
+        EXPECT_EQ(entry.offset % detail::snapshot_alignment, 0u);
+        EXPECT_LE(entry.offset, snapshot.size());
+    }
+
+    detail::snapshot_block block_copy{snapshot.size(), host_mr};
+    std::memcpy(block_copy.data(), snapshot.data(), snapshot.size());
+    // Invalidate the original block
+    std::memset(snapshot._block.data(), 0, snapshot.size());
+
+    auto copy_data = detray::get_data(snapshot, block_copy.data());
+    EXPECT_EQ(reinterpret_cast<const std::byte *>(
+                  detail::get<0>(copy_data._detector_data.m_view).ptr()),
+              block_copy.data());
+
+    device_detector_t copy_det(copy_data);
+
+    ASSERT_EQ(copy_det.volumes().size(), toy_det.volumes().size());
+    for (std::size_t i = 0u; i < toy_det.volumes().size(); ++i) {
+        EXPECT_TRUE(copy_det.volumes()[i] == toy_det.volumes()[i]);
+    }
+    ASSERT_EQ(copy_det.surface_lookup().size(),
+              toy_det.surface_lookup().size());
+    for (std::size_t i = 0u; i < toy_det.surface_lookup().size(); ++i) {
+        EXPECT_TRUE(copy_det.surface_lookup()[i] ==
+                    toy_det.surface_lookup()[i]);
+    }
+    for (dindex i = 0u; i < toy_det.transform_store().size(); ++i) {
+        EXPECT_TRUE(copy_det.transform_store().at(i, geo_ctx) ==
+                    toy_det.transform_store().at(i, geo_ctx));
+    }
+    const auto &copy_cylinders =
+        copy_det.mask_store().template get<mask_id::e_portal_cylinder2>();
+    ASSERT_EQ(copy_cylinders.size(), cylinders.size());
+    for (std::size_t i = 0u; i < cylinders.size(); ++i) {
+        EXPECT_TRUE(copy_cylinders[i] == cylinders[i]);
+    }
+    for (const point3 p : {point3{0.f, 0.f, 0.f}, point3{40.f, 0.f, 0.f},
+                           point3{0.f, 100.f, 300.f},
+                           point3{0.f, 50.f, -700.f}}) {
+        EXPECT_EQ(copy_det.volume_by_pos(p).index(),
+                  toy_det.volume_by_pos(p).index());
+    }
+}
+
 /// This tests the functionality of a surface factory
 GTEST_TEST(detray_tools, surface_factory) {
 
@@ -682,3 +820,311 @@ GTEST_TEST(detray_tools, detector_volume_construction) {
     volume_links = {0u, 1u};
     check_mask<detector_t, mask_id::e_trapezoid2>(d, volume_links);
 }
+
+/// Compare the two-phase detector construction with the volume builder
+GTEST_TEST(detray_tools, detector_assembler) {
+
+    using namespace detray;
+
+    using detector_t = detector<>;
+    using transform3 = typename detector_t::transform3;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using material_link_t = typename detector_t::surface_type::material_link;
+    using sf_data_t = surface_data<detector_t>;
+
+    using portal_cylinder_factory =
+        surface_factory<detector_t, typename default_metadata::cylinder_portal,
+                        mask_id::e_portal_cylinder2, surface_id::e_portal>;
+    using rectangle_factory =
+        surface_factory<detector_t, rectangle2D<>, mask_id::e_rectangle2,
+                        surface_id::e_sensitive>;
+
+    constexpr std::size_t n_volumes{5u};
+
+    // Surface factories for the i-th volume
+    auto make_factories = [](const dindex vol_idx) {
+        auto pt_cyl_factory = std::make_shared<portal_cylinder_factory>();
+        pt_cyl_factory->push_back(
+            sf_data_t{transform3(point3{0.f, 0.f, 0.f}), vol_idx - 1u,
+                      std::vector<scalar>{10.f, -50.f, 50.f}});
+        pt_cyl_factory->push_back(
+            sf_data_t{transform3(point3{0.f, 0.f, 0.f}), vol_idx + 1u,
+                      std::vector<scalar>{20.f, -50.f, 50.f}});
+
+        // A different number of sensitive surfaces per volume
+        auto rect_factory = std::make_shared<rectangle_factory>();
+        for (dindex i = 0u; i <= vol_idx; ++i) {
+            rect_factory->push_back(sf_data_t{
+                transform3(point3{0.f, 0.f, static_cast<scalar>(i)}), vol_idx,
+                std::vector<scalar>{10.f, 8.f}});
+        }
+
+        return std::make_pair(pt_cyl_factory, rect_factory);
+    };
+
+    vecmem::host_memory_resource host_mr;
+    auto geo_ctx = typename detector_t::geometry_context{};
+
+    // Build the reference detector volume by volume
+    detector_t ref_det(host_mr);
+    prefill_detector(ref_det, geo_ctx);
+
+    for (std::size_t i = 0u; i < n_volumes; ++i) {
+        volume_builder<detector_t> vbuilder{};
+        vbuilder.init_vol(ref_det, volume_id::e_cylinder);
+        vbuilder.add_volume_placement(
+            point3{0.f, 0.f, 100.f * static_cast<scalar>(i)});
+
+        auto [pt_factory, sf_factory] =
+            make_factories(vbuilder.get_vol_index());
+        vbuilder.add_portals(pt_factory, geo_ctx);
+        vbuilder.add_sensitives(sf_factory, geo_ctx);
+
+        vbuilder.build(ref_det);
+    }
+
+    // Build the same volumes out of order, as a threaded loop would
+    detector_t d(host_mr);
+    prefill_detector(d, geo_ctx);
+
+    auto reverse_for_each = [](const std::size_t n, auto&& fn) {
+        for (std::size_t i = n; i > 0u; --i) {
+            fn(i - 1u);
+        }
+    };
+    detector_assembler<detector_t, decltype(reverse_for_each)> assembler{
+        reverse_for_each};
+    auto fragments = assembler.build_local(
+        d, std::vector<volume_id>(n_volumes, volume_id::e_cylinder),
+        [&make_factories, &geo_ctx](volume_fragment<detector_t>& frag,
+                                    const std::size_t i) {
+            frag.placement =
+                transform3{point3{0.f, 0.f, 100.f * static_cast<scalar>(i)}};
+
+            auto [pt_factory, sf_factory] =
+                make_factories(frag.volume.index());
+            frag.add_surfaces(pt_factory, geo_ctx);
+            frag.add_surfaces(sf_factory, geo_ctx);
+        });
+
+    // Nothing was added to the detector, yet
+    ASSERT_EQ(fragments.size(), n_volumes);
+    EXPECT_EQ(d.volumes().size(), 1u);
+    EXPECT_EQ(fragments[2].volume.index(), 3u);
+    EXPECT_EQ(fragments[2].surfaces.size(), 6u);
+
+    assembler.merge(d, std::move(fragments), geo_ctx);
+
+    // Compare the detectors
+    ASSERT_EQ(d.volumes().size(), ref_det.volumes().size());
+    for (std::size_t i = 0u; i < d.volumes().size(); ++i) {
+        EXPECT_TRUE(d.volumes()[i] == ref_det.volumes()[i])
+            << "error at volume: " << i;
+    }
+
+    ASSERT_EQ(d.n_surfaces(), ref_det.n_surfaces());
+    ASSERT_EQ(d.portals().size(), ref_det.portals().size());
+    for (dindex i = 0u; i < d.n_surfaces(); ++i) {
+        EXPECT_TRUE(d.surface_lookup()[i] == ref_det.surface_lookup()[i])
+            << "error at surface: " << i;
+        EXPECT_TRUE(d.portals()[i] == ref_det.portals()[i])
+            << "error at surface: " << i;
+    }
+
+    ASSERT_EQ(d.transform_store().size(), ref_det.transform_store().size());
+    for (dindex i = 0u; i < d.transform_store().size(); ++i) {
+        EXPECT_TRUE(d.transform_store()[i] == ref_det.transform_store()[i])
+            << "error at transform: " << i;
+    }
+
+    EXPECT_EQ(d.mask_store().template size<mask_id::e_portal_cylinder2>(),
+              2u * n_volumes);
+    EXPECT_EQ(d.mask_store().template size<mask_id::e_rectangle2>(),
+              ref_det.mask_store().template size<mask_id::e_rectangle2>());
+    check_mask<detector_t, mask_id::e_portal_cylinder2>(
+        d, {0u, 2u, 1u, 3u, 2u, 4u, 3u, 5u, 4u, 6u});
+
+    // Add a volume that brings its own material
+    std::vector<volume_fragment<detector_t>> mat_fragments;
+    mat_fragments.emplace_back(volume_id::e_cylinder,
+                               static_cast<dindex>(d.volumes().size()));
+
+    auto& frag = mat_fragments.back();
+    auto [pt_factory, sf_factory] = make_factories(frag.volume.index());
+    frag.add_surfaces(sf_factory, geo_ctx);
+    frag.materials.template emplace_back<material_id::e_slab>(
+        empty_context{}, silicon<scalar>(), 1.f);
+    frag.surfaces.back().material() =
+        material_link_t{material_id::e_slab, 0u};
+
+    assembler.merge(d, std::move(mat_fragments), geo_ctx);
+
+    // The prefilled detector holds two material slabs
+    EXPECT_EQ(d.material_store().template size<material_id::e_slab>(), 3u);
+    EXPECT_EQ(d.surface_lookup().back().material(),
+              material_link_t(material_id::e_slab, 2u));
+}
+
+/// Unittest: Let surfaces share identical masks and material
+GTEST_TEST(detray_tools, store_deduplication) {
+
+    using namespace detray;
+
+    using detector_t = detector<>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using mask_link_t = typename detector_t::surface_type::mask_link;
+    using material_link_t = typename detector_t::surface_type::material_link;
+
+    vecmem::host_memory_resource host_mr;
+    auto geo_ctx = typename detector_t::geometry_context{};
+    empty_context empty_ctx{};
+
+    detector_t d(host_mr);
+    prefill_detector(d, geo_ctx);
+
+    typename detector_t::transform_container trfs(host_mr);
+    typename detector_t::surface_container_t surfaces{};
+    typename detector_t::mask_container masks(host_mr);
+    typename detector_t::material_container materials(host_mr);
+
+    // Every surface brings its own mask and material slab, but there are only
+    // two different module shapes and slab thicknesses
+    constexpr dindex n_surfaces{6u};
+    for (dindex i = 0u; i < n_surfaces; ++i) {
+        trfs.emplace_back(geo_ctx, point3{0.f, 0.f, static_cast<scalar>(i)});
+
+        const scalar half_l{(i % 2u == 0u) ? 3.f : 4.f};
+        masks.template emplace_back<mask_id::e_rectangle2>(empty_ctx, 1u,
+                                                           half_l, half_l);
+        mask_link_t mask_link{mask_id::e_rectangle2, i};
+
+        material_link_t material_link{material_id::e_slab,
+                                      materials.template size<
+                                          material_id::e_slab>()};
+        // The last surface has no material
+        if (i == n_surfaces - 1u) {
+            material_link = {material_id::e_none, dindex_invalid};
+        } else {
+            materials.template emplace_back<material_id::e_slab>(
+                empty_ctx, silicon<scalar>(), (i < 3u) ? 1.f : 2.f);
+        }
+
+        surfaces.emplace_back(i, mask_link, material_link, 1u,
+                              dindex_invalid, surface_id::e_sensitive);
+    }
+
+    // Same shape, but different volume link
+    trfs.emplace_back(geo_ctx, point3{0.f, 0.f, 10.f});
+    masks.template emplace_back<mask_id::e_rectangle2>(empty_ctx, 2u, 3.f,
+                                                       3.f);
+    surfaces.emplace_back(
+        n_surfaces, mask_link_t{mask_id::e_rectangle2, n_surfaces},
+        material_link_t{material_id::e_none, dindex_invalid}, 1u,
+        dindex_invalid, surface_id::e_portal);
+
+    auto& vol = d.new_volume(volume_id::e_cylinder);
+    d.add_objects_per_volume(geo_ctx, vol, surfaces, masks, trfs, materials,
+                             true);
+
+    // The prefilled detector holds one rectangle and two slabs
+    const auto& rectangles =
+        d.mask_store().template get<mask_id::e_rectangle2>();
+    const auto& slabs =
+        d.material_store().template get<material_id::e_slab>();
+    EXPECT_EQ(rectangles.size(), 1u + 3u);
+    EXPECT_EQ(slabs.size(), 2u + 2u);
+    EXPECT_EQ(d.transform_store().size(), 3u + n_surfaces + 1u);
+
+    // Check the new surfaces
+    ASSERT_EQ(d.n_surfaces(), 3u + n_surfaces + 1u);
+    for (dindex i = 0u; i < n_surfaces; ++i) {
+        const auto& sf = d.surface_lookup()[3u + i];
+
+        const scalar half_l{(i % 2u == 0u) ? 3.f : 4.f};
+        EXPECT_EQ(sf.mask(), mask_link_t(mask_id::e_rectangle2, 1u + i % 2u));
+        EXPECT_NEAR(rectangles[sf.mask().index()][0], half_l, tol);
+
+        if (i == n_surfaces - 1u) {
+            EXPECT_EQ(sf.material().id(), material_id::e_none);
+        } else {
+            const dindex slab_idx{(i < 3u) ? 2u : 3u};
+            EXPECT_EQ(sf.material(),
+                      material_link_t(material_id::e_slab, slab_idx));
+            EXPECT_NEAR(slabs[slab_idx].thickness(), (i < 3u) ? 1.f : 2.f,
+                        tol);
+        }
+    }
+    EXPECT_EQ(d.surface_lookup().back().mask(),
+              mask_link_t(mask_id::e_rectangle2, 3u));
+    EXPECT_EQ(rectangles.back().volume_link(), 2u);
+}
+
+/// Unittest: Let the surfaces of a volume builder share identical masks and
+/// material
+GTEST_TEST(detray_tools, volume_builder_deduplication) {
+
+    using namespace detray;
+
+    using detector_t = detector<>;
+    using transform3 = typename detector_t::transform3;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using material_link_t = typename detector_t::surface_type::material_link;
+    using rectangle_factory =
+        surface_factory<detector_t, rectangle2D<>, mask_id::e_rectangle2,
+                        surface_id::e_sensitive>;
+
+    vecmem::host_memory_resource host_mr;
+    auto geo_ctx = typename detector_t::geometry_context{};
+
+    detector_t d(host_mr);
+    prefill_detector(d, geo_ctx);
+
+    volume_builder<detector_t> vbuilder{};
+    vbuilder.init_vol(d, volume_id::e_cuboid);
+    vbuilder.set_deduplication();
+
+    // Four modules of the same shape
+    auto rect_factory = std::make_shared<rectangle_factory>();
+    typename rectangle_factory::sf_data_collection rect_sf_data;
+    for (dindex i = 0u; i < 4u; ++i) {
+        rect_sf_data.emplace_back(
+            transform3(point3{0.f, 0.f, 10.f * static_cast<scalar>(i)}), 1u,
+            std::vector<scalar>{10.f, 8.f});
+    }
+    rect_factory->push_back(std::move(rect_sf_data));
+    vbuilder.add_sensitives(rect_factory, geo_ctx);
+
+    // Two slab thicknesses, the last module has no material
+    for (std::size_t i = 0u; i < 3u; ++i) {
+        vbuilder.add_surface_material<material_id::e_slab>(
+            i, silicon<scalar>(), (i < 2u) ? 1.f : 2.f);
+    }
+
+    vbuilder.build(d);
+
+    // The prefilled detector holds one rectangle and two slabs
+    EXPECT_EQ(d.mask_store().template size<mask_id::e_rectangle2>(), 1u + 1u);
+    EXPECT_EQ(d.material_store().template size<material_id::e_slab>(),
+              2u + 2u);
+
+    ASSERT_EQ(d.n_surfaces(), 3u + 4u);
+    const auto& slabs =
+        d.material_store().template get<material_id::e_slab>();
+    for (dindex i = 0u; i < 4u; ++i) {
+        const auto& sf = d.surface_lookup()[3u + i];
+
+        EXPECT_EQ(sf.mask().index(), 1u);
+        if (i == 3u) {
+            EXPECT_EQ(sf.material().id(), material_id::e_none);
+        } else {
+            const dindex slab_idx{(i < 2u) ? 2u : 3u};
+            EXPECT_EQ(sf.material(),
+                      material_link_t(material_id::e_slab, slab_idx));
+            EXPECT_NEAR(slabs[slab_idx].thickness(), (i < 2u) ? 1.f : 2.f,
+                        tol);
+        }
+    }
+}
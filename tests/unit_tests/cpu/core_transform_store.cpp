@@ -7,9 +7,16 @@
 
 #include <gtest/gtest.h>
 
+#include "detray/core/detail/compact_transform_store.hpp"
 #include "detray/core/detail/single_store.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/masks/masks.hpp"
+#include "detray/propagator/navigator.hpp"
 #include "detray/test/types.hpp"
 
+// System include(s)
+#include <cmath>
+
 // This tests the construction of a static transform store
 GTEST_TEST(detray_core, static_transform_store) {
     using namespace detray;
@@ -47,3 +54,90 @@ GTEST_TEST(detray_core, static_transform_store) {
     static_store.emplace_back(ctx0);
     ASSERT_EQ(static_store.size(ctx0), 5u);
 }
+
+// This tests the compact storage of the surface placements
+GTEST_TEST(detray_core, compact_transform_store) {
+    using namespace detray;
+    using transform3 = test::transform3;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    constexpr scalar tol{1e-5f};
+
+    static_assert(sizeof(compact_transform3<transform3>) < sizeof(transform3));
+
+    using transform_store_t = compact_transform_store<transform3>;
+    transform_store_t compact_store;
+    typename transform_store_t::context_type ctx{};
+
+    ASSERT_TRUE(compact_store.empty(ctx));
+
+    // Rotation around the z-axis by 30 degrees
+    const scalar cos_a{std::cos(constant<scalar>::pi / 6.f)};
+    const scalar sin_a{std::sin(constant<scalar>::pi / 6.f)};
+    const point3 t{1.f, 2.f, 3.f};
+    const vector3 x{cos_a, sin_a, 0.f};
+    const vector3 z{0.f, 0.f, 1.f};
+    const transform3 trf{t, z, x};
+
+    compact_store.push_back(trf, ctx);
+    compact_store.emplace_back(ctx, t);
+    compact_store.emplace_back(ctx);
+    ASSERT_EQ(compact_store.size(ctx), 3u);
+
+    // Full placement is recovered
+    const transform3 trf0 = compact_store[0u];
+    const transform3 trf1 = compact_store.at(1u, ctx);
+    const transform3 trf2 = compact_store[2u];
+    const point3 p{4.f, -5.f, 6.f};
+
+    const auto &compact0 = compact_store.compact(0u);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(trf0.point_to_global(p)[i], trf.point_to_global(p)[i],
+                    tol);
+        EXPECT_NEAR(trf0.point_to_local(p)[i], trf.point_to_local(p)[i], tol);
+        EXPECT_NEAR(compact0.point_to_global(p)[i],
+                    trf.point_to_global(p)[i], tol);
+        EXPECT_NEAR(compact0.point_to_local(p)[i], trf.point_to_local(p)[i],
+                    tol);
+        EXPECT_NEAR(trf1.translation()[i], t[i], tol);
+        EXPECT_NEAR(trf2.point_to_global(p)[i], p[i], tol);
+    }
+}
+
+// The navigator computes the same safety distance from the compact placement
+GTEST_TEST(detray_core, compact_placement_safety) {
+    using namespace detray;
+    using transform3 = test::transform3;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    constexpr scalar tol{1e-5f};
+
+    const point3 t{1.f, 2.f, 3.f};
+    const vector3 x{0.f, 1.f, 0.f};
+    const vector3 z{0.f, 0.f, 1.f};
+    const transform3 trf{t, z, x};
+
+    compact_transform_store<transform3> compact_store;
+    compact_store.push_back(trf);
+
+    dvector<mask<cylinder2D<>>> cylinders{};
+    cylinders.emplace_back(0u, 10.f, -50.f, 50.f);
+    dvector<mask<rectangle2D<>>> rectangles{};
+    rectangles.emplace_back(0u, 3.f, 4.f);
+
+    const point3 p{4.f, -5.f, 6.f};
+    const auto &compact = detail::placement(compact_store, 0u);
+
+    // Radial distance for the cylinder
+    const scalar cyl_dist{
+        detail::safety_distance{}(cylinders, 0u, compact, p)};
+    EXPECT_NEAR(cyl_dist, detail::safety_distance{}(cylinders, 0u, trf, p),
+                tol);
+    EXPECT_NEAR(cyl_dist, 10.f - std::sqrt(3.f * 3.f + 7.f * 7.f), tol);
+
+    // Distance to the local bounding box for the rectangle
+    EXPECT_NEAR(detail::safety_distance{}(rectangles, 0u, compact, p),
+                detail::safety_distance{}(rectangles, 0u, trf, p), tol);
+}
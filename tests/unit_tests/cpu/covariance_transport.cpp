@@ -8,14 +8,15 @@
 // Project include(s).
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/surface.hpp"
+#include "detray/intersection/helix_cylinder_intersector.hpp"
+#include "detray/intersection/helix_line_intersector.hpp"
+#include "detray/intersection/helix_plane_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/masks/unbounded.hpp"
+#include "detray/propagator/detail/covariance_engine.hpp"
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/axis_rotation.hpp"
-#include "tests/common/tools/intersectors/helix_cylinder_intersector.hpp"
-#include "tests/common/tools/intersectors/helix_line_intersector.hpp"
-#include "tests/common/tools/intersectors/helix_plane_intersector.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -23,6 +24,10 @@
 // google-test include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <algorithm>
+#include <cmath>
+
 using namespace detray;
 
 // Algebra types
@@ -49,6 +54,7 @@ class HelixCovarianceTransportValidation : public ::testing::Test {
     const vector3 z_axis{0.f, 0.f, 1.f};
     static constexpr const scalar mask_tolerance{1e-3f};
     static constexpr const scalar tolerance{3e-2f};
+    static constexpr const scalar rel_tolerance{1e-3f};
 
     // Test types
     using mask_type = T;
@@ -239,6 +245,39 @@ class HelixCovarianceTransportValidation : public ::testing::Test {
             full_jacobi * bound_cov_0 *
             matrix_operator().transpose(full_jacobi);
 
+        // The structure aware transport has to reproduce the dense products
+        using covariance_engine = detail::covariance_engine<matrix_operator>;
+
+        const free_to_bound_matrix corrected_free_to_bound =
+            covariance_engine().correct_free_to_bound(
+                free_to_bound_jacobi,
+                destination_frame.path_derivative(trf_1, r, t), t, dtds);
+        const bound_matrix sparse_jacobi = covariance_engine().to_bound(
+            covariance_engine().transport(corrected_free_to_bound,
+                                          transport_jacobi),
+            bound_to_free_jacobi);
+        const auto sparse_sym_cov =
+            covariance_engine().similarity<e_bound_size>(sparse_jacobi,
+                                                         bound_cov_0);
+        const bound_matrix sparse_cov =
+            covariance_engine().unpack(sparse_sym_cov);
+
+        for (unsigned int i = 0u; i < e_bound_size; i++) {
+            for (unsigned int j = 0u; j < e_bound_size; j++) {
+                const scalar_type jac{
+                    matrix_operator().element(full_jacobi, i, j)};
+                const scalar_type cov{
+                    matrix_operator().element(bound_cov_1, i, j)};
+                EXPECT_NEAR(matrix_operator().element(sparse_jacobi, i, j),
+                            jac,
+                            this->rel_tolerance *
+                                std::max(scalar_type{1.f}, std::abs(jac)));
+                EXPECT_NEAR(matrix_operator().element(sparse_cov, i, j), cov,
+                            this->rel_tolerance *
+                                std::max(scalar_type{1.f}, std::abs(cov)));
+            }
+        }
+
         bound_track_parameters<transform3> ret;
         ret.set_vector(bound_vec_1);
         ret.set_covariance(bound_cov_1);
@@ -8,6 +8,7 @@
 // Project include(s).
 #include "detray/geometry/surface.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
 #include "detray/materials/material.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/materials/predefined_materials.hpp"
@@ -318,3 +319,72 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(std::make_tuple(1.f * unit<scalar>::GeV),
                       std::make_tuple(10.f * unit<scalar>::GeV),
                       std::make_tuple(100.f * unit<scalar>::GeV)));
+
+// Compare the tabulated interactions with the analytic computation
+GTEST_TEST(detray_material, interaction_table) {
+
+    // Interaction object
+    interaction<scalar> I;
+
+    // intersection with an incidence angle
+    intersection2D<sf_handle_t> is;
+    is.cos_incidence_angle = 0.7f;
+
+    // Silicon slab
+    material_slab<scalar> slab(silicon<scalar>(), 0.15f * unit<scalar>::mm);
+
+    // muon
+    constexpr int pdg{pdg_particle::eMuon};
+    constexpr scalar m{105.7f * unit<scalar>::MeV};
+    constexpr scalar q{-1.f};
+
+    const interaction_table<scalar> table(slab.get_material(), pdg, m, q);
+
+    ASSERT_TRUE(table.matches(pdg, m, q));
+    ASSERT_FALSE(table.matches(pdg_particle::eElectron, m, q));
+
+    // Momentum outside of the table range
+    EXPECT_FALSE(table.in_range(q / (10.f * unit<scalar>::MeV)));
+    EXPECT_FALSE(table.in_range(q / (2.f * unit<scalar>::TeV)));
+
+    // Scan the momentum range, avoiding the table nodes
+    constexpr std::size_t n_samples{1000u};
+    const scalar log_p_min{std::log(60.f * unit<scalar>::MeV)};
+    const scalar log_p_max{std::log(900.f * unit<scalar>::GeV)};
+
+    for (std::size_t i = 0u; i < n_samples; ++i) {
+        const scalar frac{static_cast<scalar>(i) /
+                          static_cast<scalar>(n_samples)};
+        const scalar p{std::exp(log_p_min + (log_p_max - log_p_min) * frac)};
+        const scalar qOverP{q / p};
+
+        ASSERT_TRUE(table.in_range(qOverP));
+
+        const scalar bethe{
+            I.compute_energy_loss_bethe(is, slab, pdg, m, qOverP, q)};
+        const scalar landau{
+            I.compute_energy_loss_landau(is, slab, pdg, m, qOverP, q)};
+        const scalar sigma_qop{I.compute_energy_loss_landau_sigma_QOverP(
+            is, slab, pdg, m, qOverP, q)};
+        const scalar theta0{
+            I.compute_multiple_scattering_theta0(is, slab, pdg, m, qOverP, q)};
+
+        // Within 1% of the analytic computation
+        EXPECT_NEAR(table.compute_energy_loss_bethe(is, slab, qOverP) / bethe,
+                    1.f, 0.01f)
+            << "p: " << p;
+        EXPECT_NEAR(
+            table.compute_energy_loss_landau(is, slab, qOverP) / landau, 1.f,
+            0.01f)
+            << "p: " << p;
+        EXPECT_NEAR(
+            table.compute_energy_loss_landau_sigma_QOverP(is, slab, qOverP) /
+                sigma_qop,
+            1.f, 0.01f)
+            << "p: " << p;
+        EXPECT_NEAR(
+            table.compute_multiple_scattering_theta0(is, slab, qOverP) / theta0,
+            1.f, 0.01f)
+            << "p: " << p;
+    }
+}
@@ -55,6 +55,13 @@ GTEST_TEST(detray_geometry, detector_volume) {
                 sf_finder_ids::e_grid);
     ASSERT_TRUE(v1.template link<geo_objects::e_sensitive>().index() == 12u);
 
+    // Volume material (vacuum by default)
+    ASSERT_FALSE(v1.has_material());
+    v1.set_material(2u, 3u);
+    ASSERT_TRUE(v1.has_material());
+    ASSERT_EQ(v1.material().id(), 2u);
+    ASSERT_EQ(v1.material().index(), 3u);
+
     // Check copy constructor
     const auto v2 = volume_t(v1);
     ASSERT_EQ(v2.id(), volume_id::e_cylinder);
@@ -65,4 +72,6 @@ GTEST_TEST(detray_geometry, detector_volume) {
     ASSERT_TRUE(v2.template link<geo_objects::e_sensitive>().id() ==
                 sf_finder_ids::e_grid);
     ASSERT_TRUE(v2.template link<geo_objects::e_sensitive>().index() == 12u);
+    ASSERT_TRUE(v2.has_material());
+    ASSERT_TRUE(v2 == v1);
 }
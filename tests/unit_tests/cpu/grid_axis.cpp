@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <limits>
 
 // detray test
@@ -314,6 +315,47 @@ GTEST_TEST(detray_grid, closed_irregular_axis) {
     EXPECT_EQ(cir_axis.range(3.f, nhood11s), expected_range);
 }
 
+GTEST_TEST(detray_grid, irregular_axis_lookup_table) {
+
+    // Strongly irregular bin edges, including very narrow bins
+    vecmem::vector<scalar> bin_edges = {-100.f, -3.f,  -2.99f, -2.98f, 1.f,
+                                        2.f,    4.f,   8.f,    8.001f, 12.f,
+                                        15.f,   15.5f, 40.f};
+    // Index range for the bin edges [-3, 40]
+    const dindex_range edge_range = {1u, 12u};
+
+    // Copy of the edges with an appended lookup table
+    vecmem::vector<scalar> lut_edges{bin_edges};
+    irregular<>::add_lookup_table(lut_edges, edge_range, 11u);
+    ASSERT_EQ(lut_edges.size(), bin_edges.size() + 14u);
+    EXPECT_TRUE(std::isnan(lut_edges[bin_edges.size()]));
+
+    // The lookup table can only be appended directly after the edges
+    vecmem::vector<scalar> no_lut_edges{bin_edges};
+    no_lut_edges.push_back(100.f);
+    irregular<>::add_lookup_table(no_lut_edges, edge_range, 11u);
+    EXPECT_EQ(no_lut_edges.size(), bin_edges.size() + 1u);
+
+    const irregular<> binning(&edge_range, &bin_edges);
+    const irregular<> lut_binning(&edge_range, &lut_edges);
+
+    EXPECT_EQ(lut_binning.nbins(), binning.nbins());
+
+    // Same result on the bin edges, between them and outside of the span
+    for (dindex i = edge_range[0]; i <= edge_range[1]; ++i) {
+        const scalar edge{bin_edges[i]};
+        EXPECT_EQ(lut_binning.bin(edge), binning.bin(edge)) << edge;
+        EXPECT_EQ(lut_binning.bin(edge - tol), binning.bin(edge - tol));
+        EXPECT_EQ(lut_binning.bin(edge + tol), binning.bin(edge + tol));
+    }
+    for (scalar v = -50.f; v < 60.f; v += 0.0137f) {
+        EXPECT_EQ(lut_binning.bin(v), binning.bin(v)) << v;
+    }
+    EXPECT_EQ(lut_binning.bin(-std::numeric_limits<scalar>::infinity()), -1);
+    EXPECT_EQ(lut_binning.bin(std::numeric_limits<scalar>::infinity()),
+              binning.bin(std::numeric_limits<scalar>::infinity()));
+}
+
 GTEST_TEST(detray_grid, multi_axis) {
 
     // readable axis ownership definition
@@ -11,6 +11,7 @@
 #include "detray/core/detector.hpp"
 #include "detray/definitions/indexing.hpp"
 #include "detray/detectors/toy_metadata.hpp"
+#include "detray/io/common/detail/parallel_for.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/surface_finders/grid/populator.hpp"
 #include "detray/surface_finders/grid/serializer.hpp"
@@ -24,6 +25,8 @@
 
 // System include(s)
 #include <limits>
+#include <memory>
+#include <vector>
 
 using namespace detray;
 using namespace detray::n_axis;
@@ -303,3 +306,124 @@ GTEST_TEST(detray_tools, decorator_grid_builder) {
         EXPECT_EQ(sf.transform(), trf_idx++);
     }
 }
+
+/// Unittest: Compare the spatial hash bin association to the association that
+/// tests every bin
+GTEST_TEST(detray_tools, spatial_hash_bin_association) {
+
+    using transform3 = typename test_detector_t::transform3;
+    using surface_t = typename test_detector_t::surface_type;
+    using mask_id = typename test_detector_t::masks::id;
+    using sf_data_t = surface_data<test_detector_t>;
+
+    using cyl_grid_t =
+        grid<coordinate_axes<cylinder2D<>::axes<>, false, host_container_types>,
+             surface_t, simple_serializer, regular_attacher<20>>;
+    using disc_grid_t =
+        grid<coordinate_axes<ring2D<>::axes<>, false, host_container_types>,
+             surface_t, simple_serializer, regular_attacher<20>>;
+
+    using rectangle_factory =
+        surface_factory<test_detector_t, rectangle2D<>, mask_id::e_rectangle2,
+                        surface_id::e_sensitive>;
+    using trapezoid_factory =
+        surface_factory<test_detector_t, trapezoid2D<>, mask_id::e_trapezoid2,
+                        surface_id::e_sensitive>;
+
+    vecmem::host_memory_resource host_mr;
+    test_detector_t d(host_mr);
+    auto geo_ctx = typename test_detector_t::geometry_context{};
+
+    volume_builder<test_detector_t> vbuilder{};
+    vbuilder.init_vol(d, volume_id::e_cylinder);
+    const dindex vol_idx{vbuilder.get_vol_index()};
+
+    // Barrel modules in three rings and endcap modules in two rings
+    auto rect_factory = std::make_shared<rectangle_factory>();
+    auto trpz_factory = std::make_shared<trapezoid_factory>();
+    constexpr unsigned int n_phi{12u};
+    const scalar phi_step{2.f * constant<scalar>::pi /
+                          static_cast<scalar>(n_phi)};
+    for (unsigned int i = 0u; i < n_phi; ++i) {
+        const scalar phi{-constant<scalar>::pi +
+                         (static_cast<scalar>(i) + 0.5f) * phi_step};
+        const vector3 radial{math_ns::cos(phi), math_ns::sin(phi), 0.f};
+        const vector3 tangential{-math_ns::sin(phi), math_ns::cos(phi), 0.f};
+
+        for (const scalar z : {-40.f, 0.f, 40.f}) {
+            rect_factory->push_back(
+                sf_data_t{transform3(point3{30.f * radial[0],
+                                            30.f * radial[1], z},
+                                     radial, tangential),
+                          vol_idx, std::vector<scalar>{9.f, 12.f}});
+        }
+        for (const scalar r : {35.f, 60.f}) {
+            trpz_factory->push_back(
+                sf_data_t{transform3(point3{r * radial[0], r * radial[1],
+                                            100.f},
+                                     vector3{0.f, 0.f, 1.f}, tangential),
+                          vol_idx, std::vector<scalar>{6.f, 12.f, 13.f,
+                                                       1.f / 26.f}});
+        }
+    }
+    vbuilder.add_sensitives(rect_factory, geo_ctx);
+    vbuilder.add_sensitives(trpz_factory, geo_ctx);
+    vbuilder.build(d);
+
+    // Compare the bin contents of two grids
+    auto check_equal = [](const auto& ref_grid, const auto& test_grid) {
+        std::size_t n_entries{0u};
+        ASSERT_EQ(ref_grid.nbins(), test_grid.nbins());
+        for (dindex gbin = 0u; gbin < ref_grid.nbins(); ++gbin) {
+            std::vector<surface_t> ref_content;
+            for (const auto& sf : ref_grid.bin(gbin)) {
+                ref_content.push_back(sf);
+            }
+            std::vector<surface_t> test_content;
+            for (const auto& sf : test_grid.bin(gbin)) {
+                test_content.push_back(sf);
+            }
+            ASSERT_EQ(ref_content.size(), test_content.size());
+            for (std::size_t i = 0u; i < ref_content.size(); ++i) {
+                EXPECT_TRUE(ref_content[i] == test_content[i]);
+            }
+            n_entries += ref_content.size();
+        }
+        // Make sure the association actually found something
+        EXPECT_TRUE(n_entries > 0u);
+    };
+
+    // Associate the surfaces on three threads
+    const detail::threaded_for_each parallel_for_3{3u};
+
+    // Disc grid
+    auto disc_builder = grid_builder<test_detector_t, disc_grid_t>{};
+    disc_builder.init_grid(mask<ring2D<>>{0u, 0.f, 80.f}, {5u, 16u});
+
+    disc_grid_t disc_ref = disc_builder.get();
+    disc_grid_t disc_test = disc_builder.get();
+
+    bin_association(geo_ctx, d.surface_lookup(), d.transform_store(),
+                    d.mask_store(), disc_ref, {0.1f, 0.1f}, false);
+    spatial_hash_bin_association(geo_ctx, d.surface_lookup(),
+                                 d.transform_store(), d.mask_store(),
+                                 disc_test, {0.1f, 0.1f}, false,
+                                 parallel_for_3);
+    check_equal(disc_ref, disc_test);
+
+    // Cylinder grid
+    auto cyl_builder = grid_builder<test_detector_t, cyl_grid_t>{};
+    cyl_builder.init_grid(mask<cylinder2D<>>{0u, 30.f, -60.f, 60.f},
+                          {10u, 6u});
+
+    cyl_grid_t cyl_ref = cyl_builder.get();
+    cyl_grid_t cyl_test = cyl_builder.get();
+
+    bin_association(geo_ctx, d.surface_lookup(), d.transform_store(),
+                    d.mask_store(), cyl_ref, {1.f, 0.05f}, true);
+    spatial_hash_bin_association(geo_ctx, d.surface_lookup(),
+                                 d.transform_store(), d.mask_store(),
+                                 cyl_test, {1.f, 0.05f}, true,
+                                 parallel_for_3);
+    check_equal(cyl_ref, cyl_test);
+}
@@ -53,6 +53,13 @@ GTEST_TEST(detray_masks, annulus2D) {
     ASSERT_NEAR(ann2[annulus2D<>::e_shift_y], 2.0f, tol);
     ASSERT_NEAR(ann2[annulus2D<>::e_average_phi], 0.f, tol);
 
+    // Origin shift from focal to beam system, precomputed at construction
+    ASSERT_NEAR(ann2.baked()[annulus2D<>::e_shift_r2], 8.f, tol);
+    ASSERT_NEAR(ann2.baked()[annulus2D<>::e_two_shift_r],
+                2.f * std::sqrt(8.f), tol);
+    ASSERT_NEAR(ann2.baked()[annulus2D<>::e_shift_phi], -constant<scalar>::pi_4,
+                tol);
+
     ASSERT_TRUE(ann2.is_inside(toStripFrame(p2_in)) ==
                 intersection::status::e_inside);
     ASSERT_TRUE(ann2.is_inside(toStripFrame(p2_out1)) ==
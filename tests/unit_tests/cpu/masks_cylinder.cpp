@@ -35,6 +35,14 @@ GTEST_TEST(detray_masks, cylinder2D) {
     ASSERT_NEAR(c[cylinder2D<>::e_n_half_z], -hz, tol);
     ASSERT_NEAR(c[cylinder2D<>::e_p_half_z], hz, tol);
 
+    // Squared radius for the intersectors, precomputed at construction
+    ASSERT_NEAR(c.baked()[cylinder2D<>::e_r2], r * r, tol);
+
+    // The precomputed value follows a new set of boundaries
+    mask<cylinder2D<>> c2{0u, 1.f, -hz, hz};
+    c2 = c.values();
+    ASSERT_NEAR(c2.baked()[cylinder2D<>::e_r2], r * r, tol);
+
     ASSERT_TRUE(c.is_inside(p2_in) == intersection::status::e_inside);
     ASSERT_TRUE(c.is_inside(p2_edge) == intersection::status::e_inside);
     ASSERT_TRUE(c.is_inside(p2_out) == intersection::status::e_outside);
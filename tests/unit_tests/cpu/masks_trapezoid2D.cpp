@@ -38,6 +38,12 @@ GTEST_TEST(detray_masks, trapezoid2D) {
     ASSERT_NEAR(t2[trapezoid2D<>::e_half_length_2], hy, tol);
     ASSERT_NEAR(t2[trapezoid2D<>::e_divisor], divisor, tol);
 
+    // Slope of the legs, precomputed at construction
+    ASSERT_NEAR(t2.baked()[trapezoid2D<>::e_mid_half_length],
+                0.5f * (hx_miny + hx_maxy), tol);
+    ASSERT_NEAR(t2.baked()[trapezoid2D<>::e_slope],
+                (hx_maxy - hx_miny) * divisor, tol);
+
     ASSERT_TRUE(t2.is_inside(p2_in) == intersection::status::e_inside);
     ASSERT_TRUE(t2.is_inside(p2_edge) == intersection::status::e_inside);
     ASSERT_TRUE(t2.is_inside(p2_out) == intersection::status::e_outside);
@@ -94,6 +94,9 @@ GTEST_TEST(detray_materials, telescope_geometry_energy_loss) {
     interactor_t::state interactor_state{};
     parameter_resetter<transform3>::state parameter_resetter_state{};
 
+    // Compare with the analytic computation
+    interactor_state.use_interaction_tables = false;
+
     // Create actor states tuples
     auto actor_states = std::tie(print_insp_state, aborter_state, bound_updater,
                                  interactor_state, parameter_resetter_state);
@@ -319,3 +322,95 @@ GTEST_TEST(detray_materials, telescope_geometry_scattering_angle) {
     // To make sure that the variances are not zero
     EXPECT_TRUE(ref_phi_variance > 1e-9f && ref_theta_variance > 1e-9f);
 }
+
+// The detector tabulates the interactions of its material, which are then
+// used by default during the propagation
+GTEST_TEST(detray_materials, telescope_geometry_interaction_tables) {
+
+    vecmem::host_memory_resource host_mr;
+
+    mask<rectangle2D<>> rectangle{0u, 20.f * unit<scalar>::mm,
+                                  20.f * unit<scalar>::mm};
+
+    detail::ray<transform3> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    std::vector<scalar> positions = {0.f, 50.f, 100.f, 150.f, 200.f, 250.f};
+
+    const auto mat = silicon_tml<scalar>();
+    constexpr scalar thickness{0.17f * unit<scalar>::cm};
+
+    const auto det = create_telescope_detector(host_mr, rectangle, positions,
+                                               mat, thickness, traj);
+    using detector_t = decltype(det);
+
+    // All modules share one table
+    const auto &tables = det.interaction_tables();
+    ASSERT_EQ(tables.size(), 1u);
+    EXPECT_EQ(tables.tables()[0].get_material(), mat);
+
+    constexpr scalar q{-1.f};
+    constexpr scalar mass{105.7f * unit<scalar>::MeV};
+    constexpr auto slab_idx{static_cast<std::size_t>(
+        detector_t::materials::id::e_slab)};
+    const auto *table =
+        tables.find(slab_idx, 0u, pdg_particle::eMuon, mass, q);
+    ASSERT_NE(table, nullptr);
+    // The tables do not depend on the sign of the charge
+    EXPECT_EQ(tables.find(slab_idx, 0u, pdg_particle::eMuon, mass, -q), table);
+    EXPECT_EQ(tables.find(slab_idx, 0u, pdg_particle::eElectron, mass, q),
+              nullptr);
+    // No table for the vacuum on the portals
+    const auto n_modules{static_cast<dindex>(positions.size())};
+    EXPECT_EQ(tables.find(slab_idx, n_modules, pdg_particle::eMuon, mass, q),
+              nullptr);
+
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<transform3>;
+    using interactor_t = pointwise_material_interactor<transform3>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter,
+                    parameter_transporter<transform3>, interactor_t,
+                    parameter_resetter<transform3>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p({}, {});
+
+    constexpr scalar iniP{10.f * unit<scalar>::GeV};
+
+    typename bound_track_parameters<transform3>::vector_type bound_vector =
+        matrix_operator().template zero<e_bound_size, 1>();
+    getter::element(bound_vector, e_bound_theta, 0) = constant<scalar>::pi_2;
+    getter::element(bound_vector, e_bound_qoverp, 0) = q / iniP;
+
+    const bound_track_parameters<transform3> bound_param(
+        geometry::barcode{}.set_index(0u), bound_vector,
+        matrix_operator().template zero<e_bound_size, e_bound_size>());
+
+    // @returns the final momentum and qop variance
+    auto propagate = [&](const bool use_tables) {
+        pathlimit_aborter::state aborter_state{};
+        parameter_transporter<transform3>::state bound_updater{};
+        interactor_t::state interactor_state{};
+        interactor_state.use_interaction_tables = use_tables;
+        parameter_resetter<transform3>::state parameter_resetter_state{};
+
+        auto actor_states =
+            std::tie(aborter_state, bound_updater, interactor_state,
+                     parameter_resetter_state);
+
+        propagator_t::state state(bound_param, det);
+        EXPECT_TRUE(p.propagate(state, actor_states));
+
+        const auto &final_param = state._stepping._bound_params;
+        return std::make_pair(
+            final_param.p(),
+            matrix_operator().element(final_param.covariance(), e_bound_qoverp,
+                                      e_bound_qoverp));
+    };
+
+    const auto [p_ana, var_ana] = propagate(false);
+    const auto [p_tab, var_tab] = propagate(true);
+
+    // Energy loss and its variance within 1% of the analytic computation
+    EXPECT_NEAR((iniP - p_tab) / (iniP - p_ana), 1.f, 1e-2f);
+    EXPECT_NEAR(var_tab / var_ana, 1.f, 1e-2f);
+}
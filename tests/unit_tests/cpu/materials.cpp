@@ -11,12 +11,16 @@
 #include "detray/intersection/line_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/materials/material.hpp"
+#include "detray/materials/material_map.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/materials/mixture.hpp"
 #include "detray/materials/predefined_materials.hpp"
 #include "detray/test/types.hpp"
 
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // GTest include(s)
 #include <gtest/gtest.h>
 
@@ -173,3 +177,65 @@ GTEST_TEST(detray_materials, material_rod) {
     EXPECT_NEAR(rod.path_segment_in_L0(is),
                 rod.path_segment(is) / rod.get_material().L0(), tol);
 }
+
+// This tests the surface material maps
+GTEST_TEST(detray_materials, material_map) {
+
+    using disc_map_t = material_map<ring2D<>::axes<>, scalar>;
+
+    vecmem::host_memory_resource host_mr;
+    material_map_factory<scalar> mat_factory{host_mr};
+
+    const material_slab<scalar> si_slab(silicon<scalar>(),
+                                        1.f * unit<scalar>::mm);
+    const material_slab<scalar> be_slab(beryllium<scalar>(),
+                                        2.f * unit<scalar>::mm);
+
+    // Two discs with different radial extent and binning
+    auto disc_map0 =
+        mat_factory.new_grid(mask<ring2D<>>{0u, 0.f, 10.f}, {2u, 4u});
+    auto disc_map1 =
+        mat_factory.new_grid(mask<ring2D<>>{0u, 10.f, 30.f}, {4u, 1u});
+
+    // Inner half of the first disc
+    for (dindex iphi = 0u; iphi < 4u; ++iphi) {
+        disc_map0.populate(n_axis::multi_bin<2>{{0u, iphi}}, si_slab);
+    }
+    // Outermost ring of the second disc
+    disc_map1.populate(n_axis::multi_bin<2>{{3u, 0u}}, be_slab);
+
+    auto disc_maps = mat_factory.new_collection<disc_map_t>();
+    disc_maps.push_back(disc_map0);
+
+    // Add the second map through another collection
+    auto other_maps = mat_factory.new_collection<disc_map_t>();
+    other_maps.push_back(disc_map1);
+    disc_maps.append(other_maps);
+
+    EXPECT_EQ(disc_maps.size(), 2u);
+    EXPECT_EQ(disc_maps.bin_storage().size(), 12u);
+    EXPECT_EQ(disc_maps[1].get_axis<n_axis::label::e_r>().min(), 10.f);
+    EXPECT_EQ(disc_maps[1].get_axis<n_axis::label::e_r>().max(), 30.f);
+
+    // Lookup at the local position of the intersection (r, phi)
+    const auto lookup = [&disc_maps](const dindex map_idx, const scalar r,
+                                     const scalar phi) {
+        intersection_t is;
+        is.local = {r, phi, 0.f};
+        return *detray::ranges::begin(
+            detail::get_material(disc_maps, map_idx, is));
+    };
+
+    EXPECT_EQ(lookup(0u, 2.f, 0.5f), si_slab);
+    EXPECT_EQ(lookup(0u, 2.f, -3.f), si_slab);
+    EXPECT_FALSE(lookup(0u, 7.f, 0.5f));
+    EXPECT_EQ(lookup(1u, 27.f, 1.f), be_slab);
+    EXPECT_FALSE(lookup(1u, 12.f, 1.f));
+
+    // Homogeneous material is looked up by index
+    const dvector<material_slab<scalar>> slabs = {si_slab, be_slab};
+    intersection_t is;
+    for (const auto &mat : detail::get_material(slabs, 1u, is)) {
+        EXPECT_EQ(mat, be_slab);
+    }
+}
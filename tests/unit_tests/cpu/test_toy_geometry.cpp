@@ -7,6 +7,7 @@
 
 // Project include(s)
 #include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/io/common/detail/parallel_for.hpp"
 #include "detray/test/types.hpp"
 #include "tests/common/test_toy_detector.hpp"
 
@@ -16,8 +17,38 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
 using namespace detray;
 
+namespace {
+
+/// @returns the boundary values and volume link of a surface mask
+struct get_mask_values {
+    template <typename mask_group_t, typename index_t>
+    inline auto operator()(const mask_group_t& mask_group,
+                           const index_t& index) const {
+        const auto& m = mask_group[index];
+        std::vector<scalar> values(m.values().begin(), m.values().end());
+        values.push_back(static_cast<scalar>(m.volume_link()));
+        return values;
+    }
+};
+
+/// @returns the material slab of a surface
+struct get_surface_material {
+    template <typename material_group_t, typename index_t>
+    inline auto operator()(const material_group_t& material_group,
+                           const index_t& index) const {
+        return material_group[index];
+    }
+};
+
+}  // anonymous namespace
+
 // This test check the building of the tml based toy geometry
 GTEST_TEST(detray_detectors, toy_geometry) {
 
@@ -30,3 +61,84 @@ GTEST_TEST(detray_detectors, toy_geometry) {
 
     EXPECT_TRUE(test_toy_detector(toy_det));
 }
+
+// This test checks that the toy geometry is the same, if the volumes of the
+// barrel and endcaps are built concurrently
+GTEST_TEST(detray_detectors, toy_geometry_threaded) {
+
+    vecmem::host_memory_resource host_mr;
+    constexpr std::size_t n_brl_layers{4u};
+    constexpr std::size_t n_edc_layers{3u};
+
+    const auto toy_det =
+        create_toy_geometry(host_mr, n_brl_layers, n_edc_layers, false,
+                            detail::threaded_for_each{4u});
+
+    EXPECT_TRUE(test_toy_detector(toy_det));
+}
+
+// This test checks the store sizes of the toy geometry when the modules share
+// their masks and material
+GTEST_TEST(detray_detectors, toy_geometry_deduplication) {
+
+    vecmem::host_memory_resource host_mr;
+    constexpr std::size_t n_brl_layers{4u};
+    constexpr std::size_t n_edc_layers{3u};
+
+    const auto toy_det =
+        create_toy_geometry(host_mr, n_brl_layers, n_edc_layers);
+    const auto dedup_det =
+        create_toy_geometry(host_mr, n_brl_layers, n_edc_layers, true);
+
+    using detector_t = std::decay_t<decltype(toy_det)>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+
+    const auto& masks = toy_det.mask_store();
+    const auto& dedup_masks = dedup_det.mask_store();
+    const auto& materials = toy_det.material_store();
+    const auto& dedup_materials = dedup_det.material_store();
+
+    std::cout << "Toy detector store sizes (before -> after deduplication):"
+              << "\n  rectangles:    "
+              << masks.template size<mask_id::e_rectangle2>() << " -> "
+              << dedup_masks.template size<mask_id::e_rectangle2>()
+              << "\n  trapezoids:    "
+              << masks.template size<mask_id::e_trapezoid2>() << " -> "
+              << dedup_masks.template size<mask_id::e_trapezoid2>()
+              << "\n  all masks:     " << masks.total_size() << " -> "
+              << dedup_masks.total_size() << "\n  material slabs: "
+              << materials.template size<material_id::e_slab>() << " -> "
+              << dedup_materials.template size<material_id::e_slab>()
+              << std::endl;
+
+    // Only the module masks and material are shared
+    EXPECT_EQ(dedup_det.n_surfaces(), toy_det.n_surfaces());
+    EXPECT_LT(dedup_masks.template size<mask_id::e_rectangle2>(),
+              masks.template size<mask_id::e_rectangle2>());
+    EXPECT_LT(dedup_masks.template size<mask_id::e_trapezoid2>(),
+              masks.template size<mask_id::e_trapezoid2>());
+    EXPECT_EQ(dedup_masks.template size<mask_id::e_portal_cylinder2>(),
+              masks.template size<mask_id::e_portal_cylinder2>());
+    EXPECT_LT(dedup_materials.template size<material_id::e_slab>(),
+              materials.template size<material_id::e_slab>());
+    EXPECT_EQ(dedup_det.transform_store().size(),
+              toy_det.transform_store().size());
+
+    // Every surface still sees the same mask and material
+    for (dindex i = 0u; i < toy_det.n_surfaces(); ++i) {
+        const auto& sf = toy_det.surface_lookup()[i];
+        const auto& dedup_sf = dedup_det.surface_lookup()[i];
+
+        ASSERT_EQ(sf.mask().id(), dedup_sf.mask().id());
+        EXPECT_EQ(masks.template visit<get_mask_values>(sf.mask()),
+                  dedup_masks.template visit<get_mask_values>(
+                      dedup_sf.mask()));
+
+        ASSERT_EQ(sf.material().id(), dedup_sf.material().id());
+        EXPECT_EQ(materials.template visit<get_surface_material>(
+                      sf.material()),
+                  dedup_materials.template visit<get_surface_material>(
+                      dedup_sf.material()));
+    }
+}
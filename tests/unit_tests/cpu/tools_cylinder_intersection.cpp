@@ -91,6 +91,37 @@ GTEST_TEST(detray_intersection, translated_cylinder) {
     EXPECT_NEAR(hits_bound[1].cos_incidence_angle, 1.f, tol);
 }
 
+// This checks the lazy intersection mode against the full intersection
+GTEST_TEST(detray_intersection, cylinder_lazy_mode) {
+    const transform3_t shifted(vector3{3.f, 2.f, 10.f});
+    cylinder_intersector<intersection_t> ci;
+
+    const point3 ori = {3.f, 2.f, 5.f};
+    const point3 dir = {1.f, 0.f, 0.f};
+    const ray_t ray(ori, 0.f, dir, 0.f);
+
+    mask<cylinder2D<>, std::uint_least16_t, transform3_t> cylinder{0u, r, -hz,
+                                                                   hz};
+    const auto hits_full = ci(ray, surface<>{}, cylinder, shifted, tol);
+    auto hits_lazy = ci(ray, surface<>{}, cylinder, shifted, tol,
+                        intersection::mode::e_lazy);
+
+    // Same mask decision, but no polar angle and incidence angle yet
+    ASSERT_TRUE(hits_lazy[1].status == intersection::status::e_inside);
+    EXPECT_NEAR(hits_lazy[1].path, hits_full[1].path, tol);
+    EXPECT_NEAR(hits_lazy[1].local[1], -5.f, tol);
+    EXPECT_NEAR(hits_lazy[1].local[2], r, tol);
+    EXPECT_TRUE(is_invalid_value(hits_lazy[1].local[0]));
+    EXPECT_TRUE(is_invalid_value(hits_lazy[1].cos_incidence_angle));
+
+    // Completing the intersection gives the full result
+    ci.complete(ray, hits_lazy[1], cylinder, shifted);
+    EXPECT_NEAR(hits_lazy[1].local[0], hits_full[1].local[0], tol);
+    EXPECT_NEAR(hits_lazy[1].local[1], hits_full[1].local[1], tol);
+    EXPECT_NEAR(hits_lazy[1].cos_incidence_angle,
+                hits_full[1].cos_incidence_angle, tol);
+}
+
 // This checks the inclindence angle calculation for a ray-cylinder intersection
 GTEST_TEST(detray_intersection, cylinder_incidence_angle) {
     const transform3_t identity{};
@@ -204,3 +235,37 @@ GTEST_TEST(detray_intersection, concentric_cylinders) {
     EXPECT_NEAR(hits_cylinrical[1].local[0], hit_cocylindrical.local[0], tol);
     EXPECT_NEAR(hits_cylinrical[1].local[1], hit_cocylindrical.local[1], tol);
 }
+
+// This checks the lazy intersection mode of the concentric cylinder
+// intersector against the full intersection
+GTEST_TEST(detray_intersection, concentric_cylinder_lazy_mode) {
+    const point3 ori = {1.f, 0.5f, 1.f};
+    const point3 dir = vector::normalize(vector3{1.f, 1.f, 1.f});
+    const ray_t ray(ori, 0.f, dir, 0.f);
+
+    const transform3_t identity{};
+    mask<cylinder2D<>, std::uint_least16_t, transform3_t> cylinder{0u, r, -hz,
+                                                                   hz};
+    concentric_cylinder_intersector<intersection_t> cci;
+
+    const auto hit_full = cci(ray, surface<>{}, cylinder, identity, tol);
+    auto hit_lazy = cci(ray, surface<>{}, cylinder, identity, tol,
+                        intersection::mode::e_lazy);
+
+    // Same mask decision, but no polar angle and incidence angle yet
+    ASSERT_TRUE(hit_full.status == intersection::status::e_inside);
+    ASSERT_TRUE(hit_lazy.status == intersection::status::e_inside);
+    EXPECT_NEAR(hit_lazy.path, hit_full.path, tol);
+    EXPECT_NEAR(hit_lazy.local[1], hit_full.local[1], tol);
+    EXPECT_NEAR(hit_lazy.local[2], r, tol);
+    EXPECT_TRUE(is_invalid_value(hit_lazy.local[0]));
+    EXPECT_TRUE(is_invalid_value(hit_lazy.cos_incidence_angle));
+
+    // Completing the intersection gives the full result
+    cci.complete(ray, hit_lazy, cylinder, identity);
+    EXPECT_NEAR(hit_lazy.local[0], hit_full.local[0], tol);
+    EXPECT_NEAR(hit_lazy.local[1], hit_full.local[1], tol);
+    EXPECT_NEAR(hit_lazy.local[2], hit_full.local[2], tol);
+    EXPECT_NEAR(hit_lazy.cos_incidence_angle, hit_full.cos_incidence_angle,
+                tol);
+}
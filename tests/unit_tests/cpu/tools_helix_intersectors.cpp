@@ -9,13 +9,13 @@
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_cylinder_intersector.hpp"
+#include "detray/intersection/helix_line_intersector.hpp"
+#include "detray/intersection/helix_plane_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/masks/unmasked.hpp"
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
-#include "tests/common/tools/intersectors/helix_cylinder_intersector.hpp"
-#include "tests/common/tools/intersectors/helix_line_intersector.hpp"
-#include "tests/common/tools/intersectors/helix_plane_intersector.hpp"
 
 // Google Test include(s).
 #include <gtest/gtest.h>
@@ -12,13 +12,13 @@
 #include "detray/intersection/cylinder_intersector.hpp"
 #include "detray/intersection/cylinder_portal_intersector.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersection_kernel.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
 #include "detray/intersection/plane_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/ranges.hpp"
-#include "tests/common/tools/intersectors/helix_intersection_kernel.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -118,6 +118,46 @@ GTEST_TEST(detray_intersection, line_intersector_case2) {
     EXPECT_NEAR(is.local[1], -constant<scalar>::inv_sqrt2, tol);
 }
 
+// This checks the lazy intersection mode against the full intersection
+GTEST_TEST(detray_intersection, line_intersector_lazy_mode) {
+    // tf3 with skewed axis
+    const vector3 x{1.f, 0.f, -1.f};
+    const vector3 z{1.f, 0.f, 1.f};
+    const vector3 t{1.f, 1.f, 1.f};
+    const transform3 tf{t, vector::normalize(z), vector::normalize(x)};
+
+    // Create a track
+    const point3 pos{1.f, -1.f, 0.f};
+    const vector3 dir{0.f, 1.f, 0.f};
+    const free_track_parameters<transform3> trk(pos, 0.f, dir, -1.f);
+    const detail::ray<transform3> ray(trk);
+
+    // Straw tube: The check does not need the sign of the distance
+    const mask<line<>> ln{0u, 10.f, std::numeric_limits<scalar>::infinity()};
+
+    const intersection_t is_full =
+        line_intersector_type()(ray, surface<>{}, ln, tf);
+    intersection_t is_lazy = line_intersector_type()(
+        ray, surface<>{}, ln, tf, 0.f, intersection::mode::e_lazy);
+
+    // Same mask decision, but only the unsigned distance to the wire
+    ASSERT_EQ(is_full.status, intersection::status::e_inside);
+    ASSERT_EQ(is_lazy.status, intersection::status::e_inside);
+    EXPECT_NEAR(is_lazy.path, is_full.path, tol);
+    EXPECT_NEAR(is_lazy.local[0], std::abs(is_full.local[0]), tol);
+    EXPECT_NEAR(is_lazy.local[1], is_full.local[1], tol);
+    EXPECT_TRUE(is_invalid_value(is_lazy.local[2]));
+
+    // Completing the intersection gives the full result
+    line_intersector_type().complete(ray, is_lazy, ln, tf);
+    EXPECT_NEAR(is_lazy.local[0], is_full.local[0], tol);
+    EXPECT_NEAR(is_lazy.local[0], -constant<scalar>::inv_sqrt2, tol);
+    EXPECT_NEAR(is_lazy.local[1], is_full.local[1], tol);
+    EXPECT_NEAR(is_lazy.local[2], is_full.local[2], tol);
+    EXPECT_NEAR(is_lazy.cos_incidence_angle, is_full.cos_incidence_angle,
+                tol);
+}
+
 GTEST_TEST(detray_intersection, line_intersector_square_scope) {
 
     // tf3 with Identity rotation and no translation
@@ -6,6 +6,7 @@
  */
 
 // Project include(s)
+#include "detray/core/detail/compact_transform_store.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
 #include "detray/intersection/intersection.hpp"
@@ -112,3 +113,71 @@ GTEST_TEST(detray_intersection, plane_incidence_angle) {
 
     ASSERT_NEAR(is.cos_incidence_angle, std::cos(constant<scalar>::pi_4), tol);
 }
+
+// This checks the lazy intersection mode against the full intersection
+GTEST_TEST(detray_intersection, plane_lazy_mode) {
+    // Tolerance for the comparison of the local coordinates
+    constexpr scalar is_tol{1e-5f};
+
+    const transform3 shifted(vector3{3.f, 2.f, 10.f});
+    plane_intersector<intersection_t> pi;
+
+    // Test ray
+    const point3 pos{4.f, 3.f, 0.f};
+    const vector3 mom{0.f, 0.f, 1.f};
+    const detail::ray<transform3> r(pos, 0.f, mom, 0.f);
+
+    // The ring check does not need the polar angle
+    mask<ring2D<>> disc{0u, 0.f, 5.f};
+
+    const auto hit_full = pi(r, surface<>{}, disc, shifted);
+    auto hit_lazy = pi(r, surface<>{}, disc, shifted, 0.f,
+                       intersection::mode::e_lazy);
+
+    // Same mask decision, but no polar angle yet
+    ASSERT_TRUE(hit_full.status == intersection::status::e_inside);
+    ASSERT_TRUE(hit_lazy.status == intersection::status::e_inside);
+    EXPECT_NEAR(hit_lazy.path, hit_full.path, is_tol);
+    EXPECT_NEAR(hit_lazy.local[0], std::sqrt(2.f), is_tol);
+    EXPECT_TRUE(is_invalid_value(hit_lazy.local[1]));
+
+    // Completing the intersection gives the full result
+    pi.complete(r, hit_lazy, disc, shifted);
+    EXPECT_NEAR(hit_lazy.local[0], hit_full.local[0], is_tol);
+    EXPECT_NEAR(hit_lazy.local[1], hit_full.local[1], is_tol);
+    EXPECT_NEAR(hit_lazy.local[1], constant<scalar>::pi_4, is_tol);
+    EXPECT_NEAR(hit_lazy.cos_incidence_angle, hit_full.cos_incidence_angle,
+                is_tol);
+}
+
+// This tests the intersection with a compact surface placement
+GTEST_TEST(detray_intersection, plane_ray_compact_placement) {
+    // tf3 with rotated axis and translation
+    const vector3 x{1.f, 0.f, -1.f};
+    const vector3 z{1.f, 0.f, 1.f};
+    const vector3 t{0.5f, 1.f, 0.2f};
+
+    const transform3 rotated{t, vector::normalize(z), vector::normalize(x)};
+    const compact_transform3<transform3> compact{rotated};
+
+    plane_intersector<intersection_t> pi;
+
+    // Test ray
+    const point3 pos{-1.f, 0.f, 0.f};
+    const vector3 mom{1.f, 0.1f, 0.f};
+    const detail::ray<transform3> r(pos, 0.f, mom, 0.f);
+
+    mask<rectangle2D<>> rect{0u, 3.f, 3.f};
+
+    // Same result with the full and the compact placement
+    const auto is = pi(r, surface<>{}, rect, rotated);
+    const auto is_compact = pi(r, surface<>{}, rect, compact);
+
+    ASSERT_TRUE(is.status == intersection::status::e_inside);
+    ASSERT_TRUE(is_compact.status == intersection::status::e_inside);
+    EXPECT_NEAR(is_compact.path, is.path, 1e-5f);
+    EXPECT_NEAR(is_compact.local[0], is.local[0], 1e-5f);
+    EXPECT_NEAR(is_compact.local[1], is.local[1], 1e-5f);
+    EXPECT_NEAR(is_compact.cos_incidence_angle, is.cos_incidence_angle,
+                1e-5f);
+}
@@ -18,6 +18,7 @@
 #include "detray/propagator/actors/parameter_transporter.hpp"
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
 #include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/helix_stepper.hpp"
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/propagator/navigator.hpp"
 #include "detray/propagator/propagator.hpp"
@@ -26,6 +27,10 @@
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/inspectors.hpp"
+#include "detray/utils/telemetry.hpp"
+
+// System include(s)
+#include <type_traits>
 
 using namespace detray;
 using transform3 = test::transform3;
@@ -136,6 +141,22 @@ struct helix_inspector : actor {
     }
 };
 
+/// Counts the sensitive surfaces that a track reaches
+struct sensitive_counter : actor {
+
+    struct state {
+        std::size_t _n_sensitives{0u};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &counter_state,
+                    const propagator_state_t &prop_state) const {
+        if (prop_state._navigation.is_on_sensitive()) {
+            ++counter_state._n_sensitives;
+        }
+    }
+};
+
 }  // anonymous namespace
 
 /// Test basic functionality of the propagator using a straight line stepper
@@ -314,3 +335,586 @@ INSTANTIATE_TEST_SUITE_P(
                                                     1.f * unit<scalar>::T},
                                       -10.f * unit<scalar>::um,
                                       5.f * unit<scalar>::mm)));
+
+/// Test propagation in a homogeneous magnetic field using the helix stepper
+GTEST_TEST(detray_propagator, propagator_helix_stepper) {
+
+    // geomery navigation configurations
+    constexpr std::size_t theta_steps{50u};
+    constexpr std::size_t phi_steps{50u};
+
+    // Set origin position of tracks
+    const point3 ori{0.f, 0.f, 0.f};
+    constexpr scalar mom{10.f * unit<scalar>::GeV};
+
+    // detector configuration
+    constexpr std::size_t n_brl_layers{4u};
+    constexpr std::size_t n_edc_layers{7u};
+    vecmem::host_memory_resource host_mr;
+
+    // Construct the constant magnetic field.
+    using b_field_t = decltype(
+        create_toy_geometry(host_mr, n_brl_layers, n_edc_layers))::bfield_type;
+
+    const auto d = create_toy_geometry(
+        host_mr,
+        b_field_t(b_field_t::backend_t::configuration_t{
+            0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+            2.f * unit<scalar>::T}),
+        n_brl_layers, n_edc_layers);
+
+    using navigator_t = navigator<decltype(d)>;
+    using track_t = free_track_parameters<transform3>;
+    using stepper_t =
+        helix_stepper<b_field_t::view_t, transform3, constrained_step<>>;
+    using actor_chain_t =
+        actor_chain<dtuple, helix_inspector, propagation::print_inspector,
+                    parameter_transporter<transform3>,
+                    pointwise_material_interactor<transform3>,
+                    parameter_resetter<transform3>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p(stepper_t{}, navigator_t{});
+
+    // Iterate through uniformly distributed momentum directions
+    for (auto track :
+         uniform_track_generator<track_t>(theta_steps, phi_steps, ori, mom)) {
+
+        track.set_overstep_tolerance(-7.f * unit<scalar>::um);
+
+        helix_inspector::state helix_insp_state{};
+        propagation::print_inspector::state print_insp_state{};
+        parameter_transporter<transform3>::state transporter_state{};
+        pointwise_material_interactor<transform3>::state interactor_state{};
+        parameter_resetter<transform3>::state resetter_state{};
+
+        auto actor_states =
+            std::tie(helix_insp_state, print_insp_state, transporter_state,
+                     interactor_state, resetter_state);
+
+        propagator_t::state state(track, d.get_bfield(), d);
+
+        // Propagate the entire detector: The track positions and jacobians
+        // are checked against the helix by the inspector
+        ASSERT_TRUE(p.propagate(state, actor_states))
+            << print_insp_state.to_string() << std::endl;
+        ASSERT_TRUE(helix_insp_state._nav_status.size() > 0);
+
+        // Time of flight (the energy loss is negligible at this momentum)
+        const auto &stepping = state._stepping;
+        const scalar path{stepping._path_length};
+        const scalar beta_inv{
+            std::sqrt(1.f + stepping._mass * stepping._mass / (mom * mom))};
+        EXPECT_NEAR(stepping().time(), path * beta_inv, 1e-3f * path);
+    }
+}
+
+/// Test the propagation of double precision track states through a detector
+/// that is given in the precision of @c detray::scalar, which can be float
+GTEST_TEST(detray_propagator, propagator_mixed_precision) {
+
+    // geomery navigation configurations
+    constexpr std::size_t theta_steps{20u};
+    constexpr std::size_t phi_steps{20u};
+
+    // Set origin position of tracks
+    const point3 ori{0.f, 0.f, 0.f};
+    constexpr scalar mom{10.f * unit<scalar>::GeV};
+
+    vecmem::host_memory_resource host_mr;
+
+    using b_field_t = decltype(create_toy_geometry(host_mr))::bfield_type;
+
+    const auto d = create_toy_geometry(
+        host_mr, b_field_t(b_field_t::backend_t::configuration_t{
+                     0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                     2.f * unit<scalar>::T}));
+
+    // Track state and stepper in double precision, the material interaction
+    // is evaluated in the precision of the detector
+    using track_transform3 = __plugin::transform3<double>;
+    using det_scalar_t = std::decay_t<decltype(d)>::scalar_type;
+    using mixed_interactor_t =
+        pointwise_material_interactor<track_transform3, det_scalar_t>;
+
+    using navigator_t = navigator<decltype(d)>;
+    using track_t = free_track_parameters<transform3>;
+    using mixed_track_t = free_track_parameters<track_transform3>;
+    using stepper_t = rk_stepper<b_field_t::view_t, transform3>;
+    using mixed_stepper_t = rk_stepper<b_field_t::view_t, track_transform3>;
+    using actor_chain_t =
+        actor_chain<dtuple, parameter_transporter<transform3>,
+                    pointwise_material_interactor<transform3>,
+                    parameter_resetter<transform3>>;
+    using mixed_actor_chain_t =
+        actor_chain<dtuple, parameter_transporter<track_transform3>,
+                    mixed_interactor_t, parameter_resetter<track_transform3>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using mixed_propagator_t =
+        propagator<mixed_stepper_t, navigator_t, mixed_actor_chain_t>;
+
+    propagator_t p(stepper_t{}, navigator_t{});
+    mixed_propagator_t mixed_p(mixed_stepper_t{}, navigator_t{});
+
+    for (auto track :
+         uniform_track_generator<track_t>(theta_steps, phi_steps, ori, mom)) {
+
+        track.set_overstep_tolerance(-7.f * unit<scalar>::um);
+
+        const auto& pos = track.pos();
+        const auto& dir = track.dir();
+        mixed_track_t mixed_track(
+            {pos[0], pos[1], pos[2]}, track.time(),
+            {mom * dir[0], mom * dir[1], mom * dir[2]}, track.charge());
+        mixed_track.set_overstep_tolerance(-7. * unit<double>::um);
+
+        parameter_transporter<transform3>::state transporter_state{};
+        pointwise_material_interactor<transform3>::state interactor_state{};
+        parameter_resetter<transform3>::state resetter_state{};
+        auto actor_states =
+            std::tie(transporter_state, interactor_state, resetter_state);
+
+        parameter_transporter<track_transform3>::state mixed_transp_state{};
+        mixed_interactor_t::state mixed_interactor_state{};
+        parameter_resetter<track_transform3>::state mixed_resetter_state{};
+        auto mixed_actor_states =
+            std::tie(mixed_transp_state, mixed_interactor_state,
+                     mixed_resetter_state);
+
+        propagator_t::state state(track, d.get_bfield(), d);
+        mixed_propagator_t::state mixed_state(mixed_track, d.get_bfield(), d);
+
+        ASSERT_TRUE(p.propagate(state, actor_states));
+        ASSERT_TRUE(mixed_p.propagate(mixed_state, mixed_actor_states));
+
+        // Both propagations leave the detector at the same position, up to
+        // the precision of the geometry
+        const auto& final_pos = state._stepping().pos();
+        const auto& mixed_final_pos = mixed_state._stepping().pos();
+        const scalar path_length{state._stepping.path_length()};
+
+        EXPECT_NEAR(static_cast<scalar>(mixed_state._stepping.path_length()),
+                    path_length, 1e-4f * path_length);
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            EXPECT_NEAR(static_cast<scalar>(mixed_final_pos[i]),
+                        final_pos[i], 1e-4f * path_length);
+        }
+    }
+}
+
+/// Magnetic field view that counts how often it is read
+template <typename field_view_t>
+struct counting_field {
+    using output_t = typename field_view_t::output_t;
+
+    output_t at(const scalar x, const scalar y, const scalar z) const {
+        ++(*m_n_lookups);
+        return m_field.at(x, y, z);
+    }
+
+    field_view_t m_field;
+    std::size_t* m_n_lookups{nullptr};
+};
+
+/// Test the telemetry counters of a propagation in a magnetic field
+GTEST_TEST(detray_propagator, propagation_telemetry) {
+
+    // Set origin position of tracks
+    const point3 ori{0.f, 0.f, 0.f};
+    constexpr scalar mom{10.f * unit<scalar>::GeV};
+
+    vecmem::host_memory_resource host_mr;
+    const auto d = create_toy_geometry(host_mr);
+    using b_field_t = decltype(d)::bfield_type;
+
+    using inspector_t = telemetry::inspector<true>;
+    using navigator_t = navigator<decltype(d), inspector_t>;
+    using track_t = free_track_parameters<transform3>;
+    using field_t = counting_field<b_field_t::view_t>;
+    using stepper_t = rk_stepper<field_t, transform3, unconstrained_step,
+                                 stepper_default_policy, telemetry::enabled>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, telemetry::collector>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    static_assert(telemetry::is_enabled_v<inspector_t>);
+    static_assert(not telemetry::is_enabled_v<navigation::void_inspector>);
+
+    // Without telemetry, the stepper does not keep any counters
+    using plain_state_t = rk_stepper<field_t, transform3>::state;
+    static_assert(not plain_state_t::has_telemetry);
+    static_assert(std::is_same_v<decltype(plain_state_t::_n_rk_trials),
+                                 telemetry::void_counter>);
+    static_assert(std::is_same_v<decltype(plain_state_t::_n_field_lookups),
+                                 telemetry::void_counter>);
+
+    propagator_t p(stepper_t{}, navigator_t{});
+
+    telemetry::recorder rec{};
+    std::size_t n_tracks{0u};
+    std::size_t n_rk_trials{0u};
+
+    // Count the field lookups independently of the telemetry
+    std::size_t n_lookups{0u};
+    const field_t field{b_field_t::view_t{d.get_bfield()}, &n_lookups};
+
+    for (auto track : uniform_track_generator<track_t>(10u, 10u, ori, mom)) {
+        track.set_overstep_tolerance(-7.f * unit<scalar>::um);
+
+        pathlimit_aborter::state aborter_state{};
+        telemetry::collector::state collector_state{&rec};
+        auto actor_states = std::tie(aborter_state, collector_state);
+
+        propagator_t::state state(track, field, d);
+
+        ASSERT_TRUE(p.propagate(state, actor_states));
+        ++n_tracks;
+        n_rk_trials += state._stepping._n_rk_trials;
+
+        // The counters were handed to the recorder at the end of the
+        // propagation (after the last navigation update)
+        const auto& tel = state._navigation.inspector();
+        EXPECT_EQ(tel.get(telemetry::counter::e_steps), 0u);
+        EXPECT_EQ(rec.n_tracks(), n_tracks);
+    }
+
+    using telemetry::counter;
+
+    const auto& steps = rec.get(counter::e_steps);
+    const auto& trials = rec.get(counter::e_rk_trials);
+    EXPECT_GT(steps.min, 0u);
+    EXPECT_GE(trials.sum, steps.sum);
+    EXPECT_EQ(trials.sum, n_rk_trials);
+    EXPECT_GT(n_lookups, 0u);
+    EXPECT_EQ(rec.get(counter::e_field_lookups).sum, n_lookups);
+
+    // Every volume is initialized at least once
+    const auto& inits = rec.get(counter::e_inits);
+    EXPECT_GT(inits.min, 0u);
+    EXPECT_GE(inits.sum, rec.get(counter::e_volume_switches).sum + n_tracks);
+
+    // Full trust is only restored after it was lowered (or after the first
+    // initialization of a track)
+    const auto n_lowered{rec.get(counter::e_no_trust_transitions).sum +
+                         rec.get(counter::e_fair_trust_transitions).sum +
+                         rec.get(counter::e_high_trust_transitions).sum};
+    EXPECT_GT(rec.get(counter::e_full_trust_transitions).min, 0u);
+    EXPECT_LE(rec.get(counter::e_full_trust_transitions).sum,
+              n_lowered + n_tracks);
+    // Not every navigation update changes the trust level
+    EXPECT_LT(n_lowered, 2u * steps.sum);
+
+    EXPECT_GE(rec.get(counter::e_intersections_tested).sum,
+              rec.get(counter::e_intersections_accepted).sum);
+    EXPECT_GT(rec.get(counter::e_intersections_accepted).min, 0u);
+    EXPECT_GT(rec.get(counter::e_stepper_ticks).min, 0u);
+    EXPECT_GT(rec.get(counter::e_navigator_ticks).min, 0u);
+
+    // Merge the per thread recorders
+    telemetry::recorder merged{};
+    merged.merge(rec);
+    merged.merge(rec);
+    EXPECT_EQ(merged.n_tracks(), 2u * n_tracks);
+    EXPECT_EQ(merged.get(counter::e_steps).sum, 2u * steps.sum);
+
+    const std::string json{merged.to_json()};
+    EXPECT_NE(json.find("\"n_tracks\": " + std::to_string(2u * n_tracks)),
+              std::string::npos);
+    EXPECT_NE(json.find("\"rk_trials\""), std::string::npos);
+}
+
+/// Compare the rejected RK trials and the intersections with and without the
+/// curvature constraint
+GTEST_TEST(detray_propagator, curvature_constraint_telemetry) {
+
+    // Low momentum tracks that curve in the solenoid field
+    const point3 ori{0.f, 0.f, 0.f};
+    constexpr scalar mom{1.f * unit<scalar>::GeV};
+
+    // Toy detector in a solenoid field
+    vecmem::host_memory_resource host_mr;
+    using b_field_t = decltype(create_toy_geometry(host_mr))::bfield_type;
+    const auto d = create_toy_geometry(
+        host_mr, b_field_t(b_field_t::backend_t::configuration_t{
+                     0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                     2.f * unit<scalar>::T}),
+        4u, 7u);
+
+    using navigator_t = navigator<decltype(d), telemetry::inspector<>>;
+    using track_t = free_track_parameters<transform3>;
+    using stepper_t =
+        rk_stepper<b_field_t::view_t, transform3, unconstrained_step,
+                   stepper_default_policy, telemetry::enabled>;
+    using c_stepper_t =
+        rk_stepper<b_field_t::view_t, transform3, curvature_constrained_step<>,
+                   stepper_default_policy, telemetry::enabled>;
+    using actor_chain_t = actor_chain<dtuple, telemetry::collector>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using c_propagator_t = propagator<c_stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p(stepper_t{}, navigator_t{});
+    c_propagator_t c_p(c_stepper_t{}, navigator_t{});
+
+    telemetry::recorder rec{};
+    telemetry::recorder c_rec{};
+
+    for (auto track : uniform_track_generator<track_t>(10u, 10u, ori, mom)) {
+        track.set_overstep_tolerance(-7.f * unit<scalar>::um);
+
+        telemetry::collector::state collector_state{&rec};
+        telemetry::collector::state c_collector_state{&c_rec};
+
+        propagator_t::state state(track, d.get_bfield(), d);
+        c_propagator_t::state c_state(track, d.get_bfield(), d);
+
+        ASSERT_TRUE(p.propagate(state, std::tie(collector_state)));
+        ASSERT_TRUE(c_p.propagate(c_state, std::tie(c_collector_state)));
+    }
+
+    using telemetry::counter;
+
+    // Number of rejected RK trials
+    const auto n_rejected = [](const telemetry::recorder& r) {
+        return r.get(counter::e_rk_trials).sum - r.get(counter::e_steps).sum;
+    };
+
+    EXPECT_GT(n_rejected(rec), 0u);
+    EXPECT_LT(n_rejected(c_rec), n_rejected(rec))
+        << "unconstrained:\n"
+        << rec.to_json() << "constrained:\n"
+        << c_rec.to_json();
+
+    // Steps that were cut by the prediction must not lower the navigation
+    // trust level: The candidates are not re-intersected more often
+    EXPECT_LE(c_rec.get(counter::e_fair_trust_transitions).sum,
+              rec.get(counter::e_fair_trust_transitions).sum);
+    EXPECT_LE(c_rec.get(counter::e_intersections_tested).sum,
+              rec.get(counter::e_intersections_tested).sum)
+        << "unconstrained:\n"
+        << rec.to_json() << "constrained:\n"
+        << c_rec.to_json();
+}
+
+/// Stop low momentum loopers in the toy detector
+GTEST_TEST(detray_propagator, looper_aborters) {
+
+    // Track that loops in the barrel
+    const point3 ori{0.f, 0.f, 0.f};
+    const scalar p_mag{100.f * unit<scalar>::MeV};
+
+    // Toy detector in a solenoid field
+    vecmem::host_memory_resource host_mr;
+    using b_field_t = decltype(create_toy_geometry(host_mr))::bfield_type;
+    const auto d = create_toy_geometry(
+        host_mr, b_field_t(b_field_t::backend_t::configuration_t{
+                     0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                     2.f * unit<scalar>::T}),
+        4u, 7u);
+
+    using navigator_t = navigator<decltype(d)>;
+    using track_t = free_track_parameters<transform3>;
+    using stepper_t = rk_stepper<b_field_t::view_t, transform3>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, min_pT_aborter,
+                    step_limit_aborter, volume_switch_aborter,
+                    stuck_track_aborter, looper_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p(stepper_t{}, navigator_t{});
+
+    aborter_statistics stats{};
+
+    // Small longitudinal momentum to move off the module boundaries at z=0
+    const vector3 mom{p_mag, 0.f, 1.f * unit<scalar>::MeV};
+    track_t track(ori, 0.f, mom, -1.f);
+    track.set_overstep_tolerance(-7.f * unit<scalar>::um);
+
+    // Only the loop detection
+    {
+        pathlimit_aborter::state pathlimit_state{10.f * unit<scalar>::m};
+        min_pT_aborter::state min_pT_state{};
+        step_limit_aborter::state step_limit_state{};
+        volume_switch_aborter::state volume_switch_state{};
+        stuck_track_aborter::state stuck_state{};
+        looper_aborter::state looper_state{};
+
+        auto actor_states =
+            std::tie(pathlimit_state, min_pT_state, step_limit_state,
+                     volume_switch_state, stuck_state, looper_state);
+
+        propagator_t::state state(track, d.get_bfield(), d);
+
+        ASSERT_FALSE(p.propagate(state, actor_states));
+        EXPECT_TRUE(looper_state._triggered);
+        EXPECT_EQ(looper_state._n_max_visits, looper_state._max_visits + 1u);
+        EXPECT_GT(looper_state._n_surfaces, 0u);
+        EXPECT_GT(step_limit_state._n_steps, 0u);
+        EXPECT_FALSE(stuck_state._triggered);
+        EXPECT_GT(pathlimit_state.path_limit(), 0.f);
+
+        stats.add(pathlimit_state, min_pT_state, step_limit_state,
+                  volume_switch_state, stuck_state, looper_state);
+    }
+
+    // Minimal transverse momentum
+    {
+        pathlimit_aborter::state pathlimit_state{10.f * unit<scalar>::m};
+        min_pT_aborter::state min_pT_state{200.f * unit<scalar>::MeV};
+        step_limit_aborter::state step_limit_state{};
+        volume_switch_aborter::state volume_switch_state{};
+        stuck_track_aborter::state stuck_state{};
+        looper_aborter::state looper_state{};
+
+        auto actor_states =
+            std::tie(pathlimit_state, min_pT_state, step_limit_state,
+                     volume_switch_state, stuck_state, looper_state);
+
+        propagator_t::state state(track, d.get_bfield(), d);
+
+        ASSERT_FALSE(p.propagate(state, actor_states));
+        EXPECT_TRUE(min_pT_state._triggered);
+        EXPECT_NEAR(min_pT_state._pT, p_mag, tol);
+        EXPECT_NEAR(state._stepping.path_length(), 0.f, tol);
+
+        stats.add(pathlimit_state, min_pT_state, step_limit_state,
+                  volume_switch_state, stuck_state, looper_state);
+    }
+
+    // Step budget
+    {
+        pathlimit_aborter::state pathlimit_state{10.f * unit<scalar>::m};
+        min_pT_aborter::state min_pT_state{};
+        step_limit_aborter::state step_limit_state{5u};
+        volume_switch_aborter::state volume_switch_state{};
+        stuck_track_aborter::state stuck_state{};
+        looper_aborter::state looper_state{};
+
+        auto actor_states =
+            std::tie(pathlimit_state, min_pT_state, step_limit_state,
+                     volume_switch_state, stuck_state, looper_state);
+
+        propagator_t::state state(track, d.get_bfield(), d);
+
+        ASSERT_FALSE(p.propagate(state, actor_states));
+        EXPECT_TRUE(step_limit_state._triggered);
+        EXPECT_EQ(step_limit_state._n_steps, 6u);
+        EXPECT_FALSE(looper_state._triggered);
+
+        stats.add(pathlimit_state, min_pT_state, step_limit_state,
+                  volume_switch_state, stuck_state, looper_state);
+    }
+
+    EXPECT_EQ(stats.n_tracks, 3u);
+    EXPECT_EQ(stats.n_loopers, 1u);
+    EXPECT_EQ(stats.n_min_pT, 1u);
+    EXPECT_EQ(stats.n_step_limit, 1u);
+    EXPECT_EQ(stats.n_volume_switches, 0u);
+    EXPECT_EQ(stats.n_stuck, 0u);
+}
+
+/// Propagate from sensitive surface to sensitive surface, like a track fit
+GTEST_TEST(detray_propagator, propagate_to_next_sensitive) {
+
+    const point3 ori{0.f, 0.f, 0.f};
+    constexpr scalar mom{10.f * unit<scalar>::GeV};
+
+    // Toy detector in a solenoid field
+    vecmem::host_memory_resource host_mr;
+    using b_field_t = decltype(create_toy_geometry(host_mr))::bfield_type;
+    const auto d = create_toy_geometry(
+        host_mr, b_field_t(b_field_t::backend_t::configuration_t{
+                     0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                     2.f * unit<scalar>::T}),
+        4u, 7u);
+
+    using navigator_t = navigator<decltype(d)>;
+    using track_t = free_track_parameters<transform3>;
+    using stepper_t = rk_stepper<b_field_t::view_t, transform3>;
+    using actor_chain_t =
+        actor_chain<dtuple, sensitive_counter,
+                    parameter_transporter<transform3>,
+                    parameter_resetter<transform3>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p(stepper_t{}, navigator_t{});
+
+    for (auto track : uniform_track_generator<track_t>(10u, 10u, ori, mom)) {
+        track.set_overstep_tolerance(-7.f * unit<scalar>::um);
+
+        parameter_transporter<transform3>::state transporter_state{};
+        parameter_resetter<transform3>::state resetter_state{};
+
+        // Reference: Propagate in one go
+        sensitive_counter::state counter_state{};
+        propagator_t::state state(track, d.get_bfield(), d);
+
+        ASSERT_TRUE(p.propagate(
+            state, std::tie(counter_state, transporter_state, resetter_state)));
+
+        // Resumable propagation: Double the momentum on the first sensitive
+        // surface, as a fit would update the track parameters
+        sensitive_counter::state leg_counter_state{};
+        auto leg_actor_states =
+            std::tie(leg_counter_state, transporter_state, resetter_state);
+        propagator_t::state leg_state(track, d.get_bfield(), d);
+
+        if (counter_state._n_sensitives == 0u) {
+            EXPECT_FALSE(
+                p.propagate_to_next_sensitive(leg_state, leg_actor_states));
+            continue;
+        }
+        ASSERT_TRUE(p.propagate_to_next_sensitive(leg_state, leg_actor_states));
+        ASSERT_TRUE(leg_state._navigation.is_on_sensitive());
+
+        const auto &first_bound = leg_state._stepping._bound_params;
+        EXPECT_NEAR(first_bound.qop(), track.qop(),
+                    tol * std::abs(track.qop()));
+
+        auto updated_bound = first_bound;
+        const scalar new_qop{0.5f * first_bound.qop()};
+        updated_bound.set_qop(new_qop);
+        const point3 update_pos{leg_state._stepping().pos()};
+
+        leg_state.set_bound_params(updated_bound);
+
+        // The free parameters follow the update
+        const auto &free_params = leg_state._stepping();
+        EXPECT_NEAR(free_params.qop(), new_qop, tol * std::abs(new_qop));
+        EXPECT_NEAR(getter::norm(free_params.pos() - update_pos), 0.f, tol);
+        EXPECT_NEAR(getter::norm(free_params.dir() - first_bound.dir()), 0.f,
+                    tol);
+
+        // The rest of the trajectory follows the updated momentum: In the
+        // solenoid field, the track stays on the circle in the transverse
+        // plane with the new radius
+        const scalar bz{2.f * unit<scalar>::T};
+        const vector3 dir{free_params.dir()};
+        const scalar perp_dir{getter::perp(dir)};
+        const scalar radius{perp_dir / (std::abs(new_qop) * bz)};
+        const scalar q_sign{new_qop < 0.f ? -1.f : 1.f};
+        const scalar c_x{update_pos[0] + q_sign * radius * dir[1] / perp_dir};
+        const scalar c_y{update_pos[1] - q_sign * radius * dir[0] / perp_dir};
+
+        std::size_t n_legs{1u};
+        while (p.propagate_to_next_sensitive(leg_state, leg_actor_states)) {
+            ASSERT_TRUE(leg_state._navigation.is_on_sensitive());
+            ++n_legs;
+
+            const auto &bound_params = leg_state._stepping._bound_params;
+            EXPECT_NEAR(bound_params.qop(), new_qop, tol * std::abs(new_qop));
+
+            const point3 pos{leg_state._stepping().pos()};
+            const scalar dx{pos[0] - c_x};
+            const scalar dy{pos[1] - c_y};
+            EXPECT_NEAR(std::sqrt(dx * dx + dy * dy), radius,
+                        0.1f * unit<scalar>::mm);
+        }
+
+        EXPECT_TRUE(leg_state._navigation.is_complete());
+        EXPECT_EQ(n_legs, leg_counter_state._n_sensitives);
+
+        // Nothing left to do
+        EXPECT_FALSE(
+            p.propagate_to_next_sensitive(leg_state, leg_actor_states));
+    }
+}
@@ -9,8 +9,11 @@
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/predefined_materials.hpp"
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/rk_stepper_pack.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
 #include "detray/test/types.hpp"
 #include "detray/tracks/tracks.hpp"
@@ -24,6 +27,9 @@
 #include <covfie/core/field_view.hpp>
 #include <covfie/core/vector.hpp>
 
+// System include(s)
+#include <vector>
+
 using namespace detray;
 using vector2 = test::vector2;
 using vector3 = test::vector3;
@@ -231,3 +237,318 @@ GTEST_TEST(detray_propagator, rk_stepper) {
         EXPECT_NEAR(getter::norm(backward_relative_error), 0.f, tol);
     }
 }
+
+// This tests the step size prediction from the track curvature
+GTEST_TEST(detray_propagator, rk_stepper_curvature_constraint) {
+    using namespace step;
+
+    // Count the RK trials
+    using tel_rk_stepper_t =
+        rk_stepper<mag_field_t::view_t, transform3, unconstrained_step,
+                   stepper_default_policy, telemetry::enabled>;
+    using curv_rk_stepper_t =
+        rk_stepper<mag_field_t::view_t, transform3,
+                   curvature_constrained_step<>, stepper_default_policy,
+                   telemetry::enabled>;
+
+    // Constant magnetic field
+    vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    mag_field_t mag_field(
+        typename mag_field_t::backend_t::configuration_t{B[0], B[1], B[2]});
+
+    tel_rk_stepper_t rk_stepper;
+    curv_rk_stepper_t crk_stepper;
+
+    // Low momentum track in the transverse plane
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 mom{1.f * unit<scalar>::GeV, 0.f, 0.f};
+    free_track_parameters<transform3> track(pos, 0.f, mom, -1.f);
+
+    prop_state<tel_rk_stepper_t::state, nav_state> propagation{
+        tel_rk_stepper_t::state{track, mag_field}, nav_state{}};
+    prop_state<curv_rk_stepper_t::state, nav_state> c_propagation{
+        curv_rk_stepper_t::state{track, mag_field}, nav_state{}};
+
+    tel_rk_stepper_t::state &rk_state = propagation._stepping;
+    curv_rk_stepper_t::state &crk_state = c_propagation._stepping;
+
+    // Long way to the next surface
+    propagation._navigation._step_size = 50.f * unit<scalar>::cm;
+    c_propagation._navigation._step_size = 50.f * unit<scalar>::cm;
+
+    ASSERT_TRUE(rk_stepper.step(propagation));
+    ASSERT_TRUE(crk_stepper.step(c_propagation));
+
+    // The unconstrained step has to be rejected at least once
+    EXPECT_GT(rk_state._n_rk_trials, 1u);
+    // The predicted step size is accepted right away and is not smaller than
+    // the step size that was found by the trials
+    EXPECT_EQ(crk_state._n_rk_trials, 1u);
+    const scalar curv_step{
+        crk_state.constraints().template size<constraint::e_curvature>()};
+    EXPECT_LT(curv_step, 50.f * unit<scalar>::cm);
+    EXPECT_NEAR(crk_state.step_size(), curv_step, tol);
+    EXPECT_GE(crk_state.step_size(), rk_state.step_size());
+    // The prediction is not a hard constraint
+    EXPECT_EQ(crk_state.constraints().template size<>(),
+              std::numeric_limits<scalar>::max());
+
+    // The constraint is updated, not accumulated, on every step
+    for (unsigned int i_s = 0u; i_s < 10u; i_s++) {
+        ASSERT_TRUE(crk_stepper.step(c_propagation));
+    }
+    EXPECT_EQ(crk_state._n_rk_trials, 11u);
+    EXPECT_NEAR(
+        crk_state.constraints().template size<constraint::e_curvature>(),
+        curv_step, tol);
+
+    // Releasing all constraints includes the curvature constraint
+    crk_state.template release_step<constraint::e_all>();
+    EXPECT_EQ(
+        crk_state.constraints().template size<constraint::e_curvature>(),
+        std::numeric_limits<scalar>::max());
+}
+
+// This tests the continuous energy loss and scattering in volume material
+GTEST_TEST(detray_propagator, rk_stepper_volume_material) {
+
+    constexpr unsigned int rk_steps = 10u;
+    constexpr int pdg{pdg_particle::eMuon};
+
+    // Constant magnetic field
+    vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    mag_field_t mag_field(
+        typename mag_field_t::backend_t::configuration_t{B[0], B[1], B[2]});
+
+    rk_stepper_t rk_stepper;
+
+    // Track in the transverse plane
+    const point3 pos{0.f, 0.f, 0.f};
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    const vector3 mom{p_mag, 0.f, 0.f};
+    free_track_parameters<transform3> track(pos, 0.f, mom, -1.f);
+    const scalar qop{track.qop()};
+    const scalar q{track.charge()};
+
+    prop_state<rk_stepper_t::state, nav_state> propagation{
+        rk_stepper_t::state{track, mag_field}, nav_state{}};
+    rk_stepper_t::state &rk_state = propagation._stepping;
+    nav_state &n_state = propagation._navigation;
+
+    // Fill the volume with silicon
+    const material<scalar> mat = silicon<scalar>();
+    rk_state._mat = &mat;
+    const scalar mass{rk_state._mass};
+
+    for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+        rk_stepper.step(propagation);
+    }
+
+    const scalar path_length{rk_state.path_length()};
+    ASSERT_NEAR(path_length, static_cast<scalar>(rk_steps) * unit<scalar>::mm,
+                tol);
+
+    // Compare to the energy loss over the entire path
+    const interaction<scalar> I{};
+    const scalar e_loss{
+        I.compute_energy_loss_bethe(path_length, mat, pdg, mass, qop, q)};
+    const scalar p_final{rk_state().p()};
+    const scalar e_init{std::sqrt(p_mag * p_mag + mass * mass)};
+    const scalar e_final{std::sqrt(p_final * p_final + mass * mass)};
+
+    EXPECT_TRUE(p_final < p_mag);
+    EXPECT_NEAR(e_init - e_final, e_loss, 0.01f * e_loss);
+
+    // The material noise is the variance for the entire path (Highland and
+    // Landau width are not additive), transported to the end of the path
+    const auto& noise = rk_state._mat_noise;
+    const auto var_theta = [&](const scalar path) {
+        const scalar theta0{I.compute_multiple_scattering_theta0(
+            path, mat, pdg, mass, qop, q)};
+        return theta0 * theta0;
+    };
+    const auto var_qop = [&](const scalar path) {
+        const scalar sigma_qop{I.compute_energy_loss_landau_sigma_QOverP(
+            path, mat, pdg, mass, qop, q)};
+        return sigma_qop * sigma_qop;
+    };
+    const scalar var_dir{var_theta(path_length)};
+
+    EXPECT_NEAR(rk_state._path_in_X0, path_length / mat.X0(), tol);
+    // The track bends in the transverse plane: No mixing with z
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_dir2, e_free_dir2),
+                var_dir, 0.02f * var_dir);
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_dir0, e_free_dir0) +
+                    matrix_operator().element(noise, e_free_dir1,
+                                              e_free_dir1),
+                var_dir, 0.02f * var_dir);
+    // The displacement from the scattering along the path (the early steps
+    // contribute less to the Highland variance, but have a longer lever arm)
+    const scalar var_pos{var_dir * path_length * path_length / 3.f};
+    const scalar cov_pos_dir{var_dir * path_length / 2.f};
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_pos2, e_free_pos2),
+                var_pos, 0.1f * var_pos);
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_pos2, e_free_dir2),
+                cov_pos_dir, 0.1f * cov_pos_dir);
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_qoverp, e_free_qoverp),
+                var_qop(path_length), 0.02f * var_qop(path_length));
+
+    // The energy loss is recovered when stepping back, while the noise keeps
+    // growing with the path in material
+    n_state._step_size *= -1.f;
+    for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+        rk_stepper.step(propagation);
+    }
+
+    EXPECT_NEAR(rk_state().qop(), qop, 1e-4f * std::abs(qop));
+    const scalar var_dir_2{var_theta(2.f * path_length)};
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_dir2, e_free_dir2),
+                var_dir_2, 0.02f * var_dir_2);
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_qoverp, e_free_qoverp),
+                var_qop(2.f * path_length),
+                0.02f * var_qop(2.f * path_length));
+
+    // No interaction in vacuum, but the noise is still transported
+    const scalar qop_vac{rk_state().qop()};
+    const scalar var_pos_vac{
+        matrix_operator().element(noise, e_free_pos2, e_free_pos2)};
+    rk_state._mat = nullptr;
+    rk_stepper.step(propagation);
+
+    EXPECT_NEAR(matrix_operator().element(noise, e_free_dir2, e_free_dir2),
+                var_dir_2, 0.02f * var_dir_2);
+    EXPECT_TRUE(matrix_operator().element(noise, e_free_pos2, e_free_pos2) >
+                var_pos_vac);
+    EXPECT_NEAR(rk_state().qop(), qop_vac, 1e-6f * std::abs(qop));
+}
+
+// This tests the lockstep transport of tracks in packs
+GTEST_TEST(detray_propagator, rk_stepper_pack) {
+
+    constexpr unsigned int theta_steps = 20u;
+    constexpr unsigned int phi_steps = 20u;
+
+    using track_t = free_track_parameters<transform3>;
+    using pack_stepper_t = rk_stepper_pack<mag_field_t::view_t, transform3, 8u>;
+    using scalar_stepper_t =
+        rk_stepper_pack<mag_field_t::view_t, transform3, 1u>;
+
+    // Constant magnetic field
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    mag_field_t mag_field(
+        typename mag_field_t::backend_t::configuration_t{B[0], B[1], B[2]});
+
+    // Tracks with different momenta, so that the lanes diverge
+    const point3 ori{0.f, 0.f, 0.f};
+    std::vector<track_t> tracks{};
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    for (const auto track : uniform_track_generator<track_t>(
+             theta_steps, phi_steps, ori, p_mag)) {
+        tracks.push_back(track);
+        tracks.back().set_qop(tracks.back().qop() /
+                              static_cast<scalar>(1u + tracks.size() % 10u));
+    }
+    std::vector<track_t> scalar_tracks{tracks};
+    const std::vector<track_t> initial_tracks{tracks};
+
+    const scalar path_limit{100.f * unit<scalar>::mm};
+
+    pack_stepper_t::state pack_state{mag_field};
+    scalar_stepper_t::state scalar_state{mag_field};
+
+    // Repack only every few steps
+    const std::size_t n_success{
+        pack_stepper_t{}.propagate(pack_state, tracks, path_limit, 3u)};
+    const std::size_t n_scalar_success{scalar_stepper_t{}.propagate(
+        scalar_state, scalar_tracks, path_limit)};
+
+    ASSERT_EQ(n_success, tracks.size());
+    ASSERT_EQ(n_scalar_success, tracks.size());
+    ASSERT_FALSE(pack_state.any_alive());
+
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        // The lanes are independent of each other
+        EXPECT_NEAR(getter::norm(tracks[i].pos() - scalar_tracks[i].pos()),
+                    0.f, tol);
+
+        // Compare to the helix after the full path length
+        detail::helix helix(initial_tracks[i], &B);
+        const point3 relative_error{(1.f / path_limit) *
+                                    (tracks[i].pos() - helix(path_limit))};
+        EXPECT_NEAR(getter::norm(relative_error), 0.f, tol);
+    }
+}
+
+// This tests the lanes of a pack that stop at different path lengths, e.g.
+// because the tracks have different next surfaces, against the scalar stepper
+GTEST_TEST(detray_propagator, rk_stepper_pack_path_limits) {
+
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+
+    using track_t = free_track_parameters<transform3>;
+    using pack_stepper_t = rk_stepper_pack<mag_field_t::view_t, transform3, 4u>;
+
+    // Constant magnetic field
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    mag_field_t mag_field(
+        typename mag_field_t::backend_t::configuration_t{B[0], B[1], B[2]});
+
+    // Every track has its own path limit (the pack does not navigate)
+    const point3 ori{0.f, 0.f, 0.f};
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    std::vector<track_t> tracks{};
+    std::vector<scalar> path_limits{};
+    for (const auto track : uniform_track_generator<track_t>(
+             theta_steps, phi_steps, ori, p_mag)) {
+        tracks.push_back(track);
+        path_limits.push_back(
+            static_cast<scalar>(10u + 15u * (tracks.size() % 7u)) *
+            unit<scalar>::mm);
+    }
+    const std::vector<track_t> initial_tracks{tracks};
+
+    pack_stepper_t::state pack_state{mag_field};
+    const std::size_t n_success{
+        pack_stepper_t{}.propagate(pack_state, tracks, path_limits)};
+    ASSERT_EQ(n_success, tracks.size());
+
+    rk_stepper_t rk_stepper;
+
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+
+        // Parameters only: The pack does not transport the covariance
+        prop_state<rk_stepper_t::state, nav_state> propagation{
+            rk_stepper_t::state{initial_tracks[i], mag_field}, nav_state{}};
+        rk_stepper_t::state &rk_state = propagation._stepping;
+        rk_state._transport_covariance = false;
+
+        // The next "surface" is at the path limit of the track
+        while (path_limits[i] - rk_state.path_length() >=
+               rk_state._step_size_cutoff) {
+            propagation._navigation._step_size =
+                path_limits[i] - rk_state.path_length();
+            rk_stepper.step(propagation);
+        }
+
+        // The lane stopped at its own path limit, like the scalar stepper
+        EXPECT_NEAR(getter::norm(tracks[i].pos() - rk_state().pos()) /
+                        path_limits[i],
+                    0.f, tol);
+        EXPECT_NEAR(getter::norm(tracks[i].dir() - rk_state().dir()), 0.f,
+                    tol);
+
+        detail::helix helix(initial_tracks[i], &B);
+        const point3 relative_error{(1.f / path_limits[i]) *
+                                    (tracks[i].pos() - helix(path_limits[i]))};
+        EXPECT_NEAR(getter::norm(relative_error), 0.f, tol);
+
+        // No jacobian transport without covariance
+        EXPECT_FLOAT_EQ(static_cast<float>(matrix_operator().element(
+                            rk_state._jac_transport, e_free_pos0,
+                            e_free_dir0)),
+                        0.f);
+    }
+}
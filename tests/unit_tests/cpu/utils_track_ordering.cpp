@@ -0,0 +1,114 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/utils/track_ordering.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Test include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace detray;
+using transform3 = test::transform3;
+using point3 = test::point3;
+
+GTEST_TEST(detray_utils, morton_key) {
+
+    // Interleaving order: x, y, z from most to least significant bit
+    EXPECT_EQ(detail::morton_key_3d(0u, 0u, 0u), 0u);
+    EXPECT_EQ(detail::morton_key_3d(1u, 0u, 0u), 4u);
+    EXPECT_EQ(detail::morton_key_3d(0u, 1u, 0u), 2u);
+    EXPECT_EQ(detail::morton_key_3d(0u, 0u, 1u), 1u);
+    EXPECT_EQ(detail::morton_key_3d(2u, 0u, 0u), 32u);
+    EXPECT_EQ(detail::morton_key_3d(1023u, 1023u, 1023u), (1u << 30u) - 1u);
+    // Only the lower 10 bits are used
+    EXPECT_EQ(detail::morton_key_3d(1024u, 0u, 0u), 0u);
+
+    // Quantization of values to 10 bits
+    EXPECT_EQ(detail::quantize(-1.f, 0.f, 1.f), 0u);
+    EXPECT_EQ(detail::quantize(0.f, 0.f, 1.f), 0u);
+    EXPECT_EQ(detail::quantize(0.5f, 0.f, 1.f), 511u);
+    EXPECT_EQ(detail::quantize(1.f, 0.f, 1.f), 1023u);
+    EXPECT_EQ(detail::quantize(2.f, 0.f, 1.f), 1023u);
+}
+
+GTEST_TEST(detray_utils, track_ordering) {
+
+    using track_t = free_track_parameters<transform3>;
+    using uniform_gen_t =
+        random_numbers<scalar, std::uniform_real_distribution<scalar>,
+                       std::seed_seq>;
+
+    vecmem::host_memory_resource host_mr;
+    const auto det = create_toy_geometry(host_mr);
+
+    // Tracks that start in the beampipe and in the first barrel layer
+    const point3 ori{0.f, 0.f, 0.f};
+    const point3 ori_layer{30.f * unit<scalar>::mm, 0.f, 0.f};
+    const point3 ori_stddev{0.f, 0.f, 0.f};
+
+    std::vector<track_t> tracks;
+    for (auto track : random_track_generator<track_t, uniform_gen_t>(
+             1000u, ori, ori_stddev,
+             {1.f * unit<scalar>::GeV, 100.f * unit<scalar>::GeV})) {
+        if (tracks.size() % 3u == 0u) {
+            track.set_pos(ori_layer);
+        }
+        tracks.push_back(track);
+    }
+    const std::vector<track_t> original{tracks};
+
+    track_sorter<decltype(det)> sorter{det};
+    const auto perm = sorter(tracks);
+
+    // The result is a permutation of the batch
+    ASSERT_EQ(perm.size(), tracks.size());
+    auto indices = perm;
+    std::sort(indices.begin(), indices.end());
+    std::vector<dindex> expected(tracks.size());
+    std::iota(expected.begin(), expected.end(), 0u);
+    EXPECT_EQ(indices, expected);
+
+    // The tracks are sorted by their keys and grouped by volume
+    std::size_t n_volume_switches{0u};
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_TRUE(tracks[i] == original[perm[i]]);
+
+        const auto k = sorter.key(tracks[i]);
+        const auto pos = tracks[i].pos();
+        EXPECT_EQ(k >> 32u, det.volume_by_pos(pos).index());
+
+        if (i > 0u) {
+            const auto k_prev = sorter.key(tracks[i - 1u]);
+            EXPECT_LE(k_prev, k);
+            n_volume_switches += (k_prev >> 32u) != (k >> 32u) ? 1u : 0u;
+        }
+    }
+    EXPECT_EQ(n_volume_switches, 1u);
+
+    // The ordering is reproducible
+    EXPECT_EQ(sorter.order(original), perm);
+
+    // Put the (propagated) tracks back into the original order
+    track_sorter<decltype(det)>::restore(tracks, perm);
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_TRUE(tracks[i] == original[i]);
+    }
+}
@@ -7,9 +7,13 @@
 
 // Project include(s)
 #include "detray/definitions/algebra.hpp"
+#include "detray/definitions/units.hpp"
 #include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/io/json/json_reader.hpp"
+#include "detray/io/json/json_stream_reader.hpp"
 #include "detray/io/json/json_writer.hpp"
+#include "detray/materials/material_map.hpp"
+#include "detray/materials/predefined_materials.hpp"
 #include "tests/common/test_toy_detector.hpp"
 
 // Vecmem include(s)
@@ -20,6 +24,7 @@
 
 // System include(s)
 #include <ios>
+#include <stdexcept>
 
 using namespace detray;
 
@@ -69,3 +74,269 @@ TEST(io, json_toy_geometry) {
     EXPECT_EQ(masks.template size<mask_id::e_straw_wire>(), 0u);
     EXPECT_EQ(masks.template size<mask_id::e_cell_wire>(), 0u);
 }
+
+/// Test the streaming reader for the geometry and the material of the toy
+/// detector
+TEST(io, json_toy_detector_stream_reader) {
+
+    using detector_t = detector<toy_metadata<>>;
+    using material_id = typename detector_t::materials::id;
+
+    typename detector_t::name_map volume_name_map = {{0u, "toy_detector"}};
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    detector_t toy_det = create_toy_geometry(host_mr);
+
+    // Write the detector geometry and material
+    json_geometry_writer<detector_t> geo_writer;
+    const auto geo_file = geo_writer.write(
+        toy_det, volume_name_map, std::ios_base::out | std::ios_base::trunc);
+
+    json_homogeneous_material_writer<detector_t> mat_writer;
+    const auto mat_file = mat_writer.write(
+        toy_det, volume_name_map, std::ios_base::out | std::ios_base::trunc);
+
+    // Stream the detector back in: The material has to be present before the
+    // surfaces can be linked to it
+    detector_t det{host_mr};
+    json_homogeneous_material_stream_reader<detector_t> mat_reader;
+    mat_reader.read(det, volume_name_map, mat_file);
+    json_geometry_stream_reader<detector_t> geo_reader;
+    geo_reader.read(det, volume_name_map, geo_file);
+
+    EXPECT_TRUE(test_toy_detector(det));
+
+    // The header of a streamed file has to match the reader
+    detector_t wrong_det{host_mr};
+    json_geometry_stream_reader<detector_t> wrong_reader;
+    EXPECT_THROW(wrong_reader.read(wrong_det, volume_name_map, mat_file),
+                 std::runtime_error);
+    // The header is checked before any data is added to the detector
+    EXPECT_EQ(wrong_det.volumes().size(), 0u);
+    EXPECT_EQ(wrong_det.n_surfaces(), 0u);
+
+    // Without material, the surfaces are only linked to it in strict mode
+    detector_t no_mat_det{host_mr};
+    json_geometry_stream_reader<detector_t> no_mat_reader;
+    no_mat_reader.read(no_mat_det, volume_name_map, geo_file);
+    EXPECT_EQ(no_mat_det.volumes().size(), det.volumes().size());
+    EXPECT_EQ(no_mat_det.n_surfaces(), det.n_surfaces());
+
+    detector_t strict_det{host_mr};
+    json_geometry_stream_reader<detector_t> strict_reader;
+    strict_reader.set_strict_material_links();
+    EXPECT_THROW(strict_reader.read(strict_det, volume_name_map, geo_file),
+                 std::runtime_error);
+
+    // Read the same files with the reader that loads the entire document
+    detector_t dom_det{host_mr};
+    json_homogeneous_material_reader<detector_t> dom_mat_reader;
+    dom_mat_reader.read(dom_det, volume_name_map, mat_file);
+    json_geometry_reader<detector_t> dom_geo_reader;
+    dom_geo_reader.read(dom_det, volume_name_map, geo_file);
+
+    // Check the material
+    const auto& slabs =
+        det.material_store().template get<material_id::e_slab>();
+    const auto& toy_slabs =
+        toy_det.material_store().template get<material_id::e_slab>();
+    ASSERT_EQ(slabs.size(), toy_slabs.size());
+    EXPECT_EQ(
+        dom_det.material_store().template size<material_id::e_slab>(),
+        toy_slabs.size());
+
+    for (std::size_t i = 0u; i < toy_slabs.size(); ++i) {
+        EXPECT_EQ(slabs[i], toy_slabs[i]);
+    }
+
+    // Check the surface material links
+    ASSERT_EQ(det.n_surfaces(), toy_det.n_surfaces());
+    ASSERT_EQ(dom_det.n_surfaces(), toy_det.n_surfaces());
+    for (dindex i = 0u; i < toy_det.n_surfaces(); ++i) {
+        const auto& toy_sf = toy_det.surface_lookup()[i];
+        EXPECT_EQ(det.surface_lookup()[i], dom_det.surface_lookup()[i]);
+        EXPECT_EQ(det.surface_lookup()[i].material(), toy_sf.material());
+        EXPECT_EQ(det.portals()[i].material(), toy_sf.material());
+    }
+}
+
+/// Test that the reader restores the mask sharing of a deduplicated detector
+TEST(io, json_toy_geometry_deduplication) {
+
+    using detector_t = detector<toy_metadata<>>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+
+    typename detector_t::name_map volume_name_map = {{0u, "toy_detector"}};
+
+    // Toy detector, in which the modules share their masks and material
+    vecmem::host_memory_resource host_mr;
+    detector_t toy_det = create_toy_geometry(host_mr, 4u, 3u, true);
+
+    json_geometry_writer<detector_t> geo_writer;
+    const auto geo_file = geo_writer.write(
+        toy_det, volume_name_map, std::ios_base::out | std::ios_base::trunc);
+
+    json_homogeneous_material_writer<detector_t> mat_writer;
+    const auto mat_file = mat_writer.write(
+        toy_det, volume_name_map, std::ios_base::out | std::ios_base::trunc);
+
+    // Read the detector without and with deduplication
+    detector_t det{host_mr};
+    json_homogeneous_material_reader<detector_t> mat_reader;
+    mat_reader.read(det, volume_name_map, mat_file);
+    json_geometry_reader<detector_t> geo_reader;
+    geo_reader.read(det, volume_name_map, geo_file);
+
+    detector_t dedup_det{host_mr};
+    mat_reader.read(dedup_det, volume_name_map, mat_file);
+    json_geometry_reader<detector_t> dedup_geo_reader;
+    dedup_geo_reader.set_deduplication();
+    dedup_geo_reader.read(dedup_det, volume_name_map, geo_file);
+
+    detector_t stream_det{host_mr};
+    json_homogeneous_material_stream_reader<detector_t> mat_stream_reader;
+    mat_stream_reader.read(stream_det, volume_name_map, mat_file);
+    json_geometry_stream_reader<detector_t> geo_stream_reader;
+    geo_stream_reader.set_deduplication();
+    geo_stream_reader.read(stream_det, volume_name_map, geo_file);
+
+    const auto& toy_masks = toy_det.mask_store();
+
+    // The masks are written per surface
+    EXPECT_EQ(det.n_surfaces(), toy_det.n_surfaces());
+    EXPECT_GT(det.mask_store().template size<mask_id::e_rectangle2>(),
+              toy_masks.template size<mask_id::e_rectangle2>());
+
+    // The material is linked by index and stays shared either way
+    EXPECT_EQ(det.material_store().template size<material_id::e_slab>(),
+              toy_det.material_store().template size<material_id::e_slab>());
+
+    for (const detector_t* d : {&dedup_det, &stream_det}) {
+        const auto& masks = d->mask_store();
+
+        EXPECT_EQ(d->n_surfaces(), toy_det.n_surfaces());
+        EXPECT_EQ(masks.template size<mask_id::e_rectangle2>(),
+                  toy_masks.template size<mask_id::e_rectangle2>());
+        EXPECT_EQ(masks.template size<mask_id::e_trapezoid2>(),
+                  toy_masks.template size<mask_id::e_trapezoid2>());
+        EXPECT_LE(masks.total_size(), toy_masks.total_size());
+
+        for (dindex i = 0u; i < toy_det.n_surfaces(); ++i) {
+            const auto& sf = d->surface_lookup()[i];
+            const auto& toy_sf = toy_det.surface_lookup()[i];
+            EXPECT_EQ(sf.material(), toy_sf.material());
+            if (toy_sf.mask().id() == mask_id::e_rectangle2) {
+                EXPECT_EQ(masks.template get<mask_id::e_rectangle2>().at(
+                              sf.mask().index()),
+                          toy_masks.template get<mask_id::e_rectangle2>().at(
+                              toy_sf.mask().index()));
+            }
+        }
+    }
+}
+
+/// Test the writing and reading of surface material maps
+TEST(io, json_material_maps) {
+
+    using detector_t = detector<>;
+    using material_id = typename detector_t::materials::id;
+
+    typename detector_t::name_map volume_name_map = {{0u, "material_maps"}};
+
+    vecmem::host_memory_resource host_mr;
+    material_map_factory<scalar> mat_factory{host_mr};
+
+    const material_slab<scalar> si_slab(silicon<scalar>(),
+                                        1.f * unit<scalar>::mm);
+    const material_slab<scalar> be_slab(beryllium<scalar>(),
+                                        2.f * unit<scalar>::mm);
+
+    // Two disc maps and a rectangle map
+    auto disc_map0 =
+        mat_factory.new_grid(mask<ring2D<>>{0u, 0.f, 10.f}, {2u, 4u});
+    auto disc_map1 =
+        mat_factory.new_grid(mask<ring2D<>>{0u, 10.f, 30.f}, {4u, 1u});
+    auto rect_map =
+        mat_factory.new_grid(mask<rectangle2D<>>{0u, 5.f, 20.f}, {3u, 2u});
+
+    for (dindex iphi = 0u; iphi < 4u; ++iphi) {
+        disc_map0.populate(n_axis::multi_bin<2>{{0u, iphi}}, si_slab);
+    }
+    disc_map1.populate(n_axis::multi_bin<2>{{3u, 0u}}, be_slab);
+    rect_map.populate(n_axis::multi_bin<2>{{1u, 1u}}, si_slab);
+    rect_map.populate(n_axis::multi_bin<2>{{2u, 0u}}, be_slab);
+
+    detector_t map_det{host_mr};
+    auto& disc_maps =
+        map_det.material_store().template get<material_id::e_disc2_map>();
+    disc_maps.push_back(disc_map0);
+    disc_maps.push_back(disc_map1);
+    map_det.material_store()
+        .template get<material_id::e_rectangle2_map>()
+        .push_back(rect_map);
+
+    // Write the maps
+    json_material_map_writer<detector_t> map_writer;
+    const auto map_file = map_writer.write(
+        map_det, volume_name_map, std::ios_base::out | std::ios_base::trunc);
+
+    // Read them back, once from the json document and once streamed
+    detector_t det{host_mr};
+    json_material_map_reader<detector_t> map_reader;
+    map_reader.read(det, volume_name_map, map_file);
+
+    detector_t stream_det{host_mr};
+    json_material_map_stream_reader<detector_t> map_stream_reader;
+    map_stream_reader.read(stream_det, volume_name_map, map_file);
+
+    // Compare the axes and the bin content of every map
+    const auto check_maps = [](const auto& maps, const auto& ref_maps) {
+        ASSERT_EQ(maps.size(), ref_maps.size());
+        EXPECT_EQ(maps.bin_storage().size(), ref_maps.bin_storage().size());
+
+        for (dindex i = 0u; i < ref_maps.size(); ++i) {
+            const auto map = maps[i];
+            const auto ref_map = ref_maps[i];
+
+            EXPECT_EQ(map.nbins(), ref_map.nbins());
+            EXPECT_EQ(map.template get_axis<0>().min(),
+                      ref_map.template get_axis<0>().min());
+            EXPECT_EQ(map.template get_axis<0>().max(),
+                      ref_map.template get_axis<0>().max());
+            EXPECT_EQ(map.template get_axis<1>().min(),
+                      ref_map.template get_axis<1>().min());
+            EXPECT_EQ(map.template get_axis<1>().max(),
+                      ref_map.template get_axis<1>().max());
+
+            const auto ref_bins = ref_map.all();
+            auto ref_bin = detray::ranges::begin(ref_bins);
+            for (const auto& mat_slab : map.all()) {
+                EXPECT_EQ(mat_slab, *ref_bin);
+                ++ref_bin;
+            }
+        }
+    };
+
+    for (const detector_t* d : {&det, &stream_det}) {
+        const auto& materials = d->material_store();
+        const auto& ref_materials = map_det.material_store();
+
+        check_maps(materials.template get<material_id::e_disc2_map>(),
+                   ref_materials.template get<material_id::e_disc2_map>());
+        check_maps(
+            materials.template get<material_id::e_rectangle2_map>(),
+            ref_materials.template get<material_id::e_rectangle2_map>());
+        EXPECT_EQ(materials.template size<material_id::e_cylinder2_map>(),
+                  0u);
+    }
+
+    // A detector without material maps cannot hold them
+    using toy_detector_t = detector<toy_metadata<>>;
+    toy_detector_t toy_det{host_mr};
+    typename toy_detector_t::name_map toy_name_map = {{0u, "material_maps"}};
+    json_material_map_reader<toy_detector_t> toy_map_reader;
+    EXPECT_THROW(toy_map_reader.read(toy_det, toy_name_map, map_file),
+                 std::runtime_error);
+}
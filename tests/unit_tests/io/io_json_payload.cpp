@@ -376,6 +376,47 @@ TEST(io, json_material_slab_payload) {
     EXPECT_EQ(m.mat.params, pm.mat.params);
 }
 
+/// This tests the json io for a surface material map
+TEST(io, json_material_grid_payload) {
+
+    detray::material_slab_payload m;
+    m.type = detray::material_slab_payload::material_type::slab;
+    m.index = 0u;
+    m.thickness = 1.2f;
+    m.mat.params = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f};
+
+    detray::axis_payload a0{
+        detray::n_axis::binning::e_regular, detray::n_axis::bounds::e_closed,
+        detray::n_axis::label::e_r, std::vector<detray::real_io>{0.f, 2.f}, 2u};
+
+    detray::axis_payload a1{
+        detray::n_axis::binning::e_regular, detray::n_axis::bounds::e_circular,
+        detray::n_axis::label::e_phi,
+        std::vector<detray::real_io>{-detray::constant<detray::real_io>::pi,
+                                     detray::constant<detray::real_io>::pi},
+        1u};
+
+    detray::material_grid_payload g;
+    g.type = detray::material_grid_payload::material_type::ring2;
+    g.index = 3u;
+    g.axes = {a0, a1};
+    g.bins = {m, m};
+    g.bins[1].index = 1u;
+
+    nlohmann::ordered_json j;
+    j["material_grid"] = g;
+
+    detray::material_grid_payload pg = j["material_grid"];
+
+    EXPECT_EQ(g.type, pg.type);
+    EXPECT_EQ(g.index, pg.index);
+    EXPECT_EQ(g.axes.size(), pg.axes.size());
+    ASSERT_EQ(g.bins.size(), pg.bins.size());
+    EXPECT_EQ(g.bins[1].index, pg.bins[1].index);
+    EXPECT_EQ(g.bins[1].thickness, pg.bins[1].thickness);
+    EXPECT_EQ(g.bins[1].mat.params, pg.bins[1].mat.params);
+}
+
 /// This tests the json io for a material slab
 TEST(io, json_detector_payload) {
 
@@ -26,12 +26,15 @@
 /// json geometry reader directly.
 int main(int argc, char** argv) {
 
-    // Input data file
+    // Input data files: The geometry and optionally its material
     std::string file_name;
-    if (argc == 2) {
+    std::string mat_file_name;
+    if (argc == 2 or argc == 3) {
         file_name = argv[1];
+        mat_file_name = argc == 3 ? argv[2] : "";
     } else {
-        throw std::runtime_error("Please specify an input file name!");
+        throw std::runtime_error(
+            "Please specify an input file name (and a material file name)!");
     }
 
     // Read a toy detector
@@ -44,6 +47,12 @@ int main(int argc, char** argv) {
     vecmem::host_memory_resource host_mr;
     detector_t det{host_mr};
 
+    // The material has to be read before the geometry that links to it
+    if (not mat_file_name.empty()) {
+        detray::json_homogeneous_material_reader<detector_t> mat_reader;
+        mat_reader.read(det, volume_name_map, mat_file_name);
+    }
+
     // Read the json geometry file
     detray::json_geometry_reader<detector_t> geo_reader;
     geo_reader.read(det, volume_name_map, file_name);
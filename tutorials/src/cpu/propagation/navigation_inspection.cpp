@@ -6,6 +6,7 @@
  */
 
 // Project include(s)
+#include "detray/core/detector_handle.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/intersection/detail/trajectories.hpp"  // ray
@@ -62,7 +63,11 @@ int main() {
 
     vecmem::host_memory_resource host_mr;
 
-    const toy_detector_t det = detray::create_toy_geometry(host_mr);
+    // Read-only handle to the detector, which can be shared between jobs
+    // without copying the geometry
+    const auto det_handle =
+        detray::make_detector_handle(detray::create_toy_geometry(host_mr));
+    const toy_detector_t &det = *det_handle;
 
     // Build the propagator
     propagator_t prop(stepper_t{}, navigator_t{});
@@ -93,12 +93,15 @@ int main() {
     auto vgrid_buff = detray::get_buffer(det_host.volume_search_grid(), dev_mr,
                                          cuda_cpy, detray::copy::sync,
                                          vecmem::data::buffer_type::fixed_size);
+    auto tab_buff = detray::get_buffer(det_host.interaction_tables(), dev_mr,
+                                       cuda_cpy, detray::copy::sync,
+                                       vecmem::data::buffer_type::fixed_size);
 
     // Assemble the detector buffer
     auto det_custom_buff = detray::detector_buffer(
         det_host, std::move(vol_buff), std::move(trf_buff), std::move(msk_buff),
         std::move(mat_buff), std::move(sf_buff), std::move(sf_lkp_buff),
-        std::move(vgrid_buff));
+        std::move(vgrid_buff), std::move(tab_buff));
 
     std::cout << "\nCustom buffer setup:" << std::endl;
     detray::tutorial::print(detray::get_data(det_custom_buff));
@@ -29,15 +29,19 @@ namespace detray {
 
 namespace {
 
-template <typename mask_shape_t>
-using telescope_types = telescope_metadata<mask_shape_t>;
+/// The telescope geometry is built in the algebra of the module mask
+template <typename mask_t>
+using telescope_types =
+    telescope_metadata<typename mask_t::shape, typename mask_t::algebra_type>;
+template <typename mask_t>
+using telescope_scalar = typename mask_t::scalar_type;
 
 /// Where and how to place the telescope modules.
+template <typename transform3_t>
 struct module_placement {
 
-    // @Note: These type definitions should be removed at some point
-    using point3 = __plugin::point3<detray::scalar>;
-    using vector3 = __plugin::vector3<detray::scalar>;
+    using point3 = typename transform3_t::point3;
+    using vector3 = typename transform3_t::vector3;
 
     /// Module position
     point3 _pos;
@@ -58,12 +62,13 @@ struct module_placement {
 /// @param steps lengths along the trajectory where surfaces should be placed.
 ///
 /// @return a vector of the @c module_placements along the trajectory.
-template <typename trajectory_t>
-inline std::vector<module_placement> module_positions(
-    const trajectory_t &traj, const std::vector<scalar> &steps) {
+template <typename trajectory_t, typename scalar_t>
+inline auto module_positions(const trajectory_t &traj,
+                             const std::vector<scalar_t> &steps) {
 
     // create and fill the module placements
-    std::vector<module_placement> placements;
+    std::vector<module_placement<typename trajectory_t::transform3_type>>
+        placements;
     placements.reserve(steps.size());
 
     for (const auto s : steps) {
@@ -85,33 +90,36 @@ inline std::vector<module_placement> module_positions(
 /// @param masks the module masks.
 /// @param materials the materials (only needed to add the portal materials).
 /// @param transforms the module surface transforms.
-template <auto mask_id, typename context_t, typename volume_t,
-          typename surface_container_t, typename mask_container_t,
-          typename material_container_t, typename transform_container_t>
-inline void create_cuboid_portals(context_t &ctx, const scalar pt_envelope,
+template <auto mask_id, typename context_t, typename scalar_t,
+          typename volume_t, typename surface_container_t,
+          typename mask_container_t, typename material_container_t,
+          typename transform_container_t>
+inline void create_cuboid_portals(context_t &ctx, const scalar_t pt_envelope,
                                   volume_t &volume,
                                   surface_container_t &surfaces,
                                   mask_container_t &masks,
                                   material_container_t &materials,
                                   transform_container_t &transforms) {
-    // @Note: These type definitions should be removed at some point
-    using point3 = __plugin::point3<detray::scalar>;
-    using vector3 = __plugin::vector3<detray::scalar>;
+    using transform3_t = typename transform_container_t::value_type;
+    using point3 = typename transform3_t::point3;
+    using vector3 = typename transform3_t::vector3;
 
     using surface_t = typename surface_container_t::value_type;
     using nav_link_t = typename surface_t::navigation_link;
     using mask_link_t = typename surface_t::mask_link;
     using material_link_t = typename surface_t::material_link;
 
-    using aabb_t = axis_aligned_bounding_volume<cuboid3D<>>;
+    using aabb_t = axis_aligned_bounding_volume<cuboid3D<>, scalar_t>;
 
     constexpr auto rectangle_id{mask_container_t::ids::e_portal_rectangle2};
     constexpr auto slab_id{material_container_t::ids::e_slab};
 
     // Envelope for the module surface minimum aabb
-    constexpr scalar envelope{10.f * std::numeric_limits<scalar>::epsilon()};
+    constexpr scalar_t envelope{10.f *
+                                std::numeric_limits<scalar_t>::epsilon()};
     // Max distance in case of infinite bounds
-    constexpr scalar max_shift{0.01f * std::numeric_limits<scalar>::max()};
+    constexpr scalar_t max_shift{0.01f *
+                                 std::numeric_limits<scalar_t>::max()};
 
     // The bounding boxes around the module surfaces
     std::vector<aabb_t> boxes;
@@ -137,9 +145,9 @@ inline void create_cuboid_portals(context_t &ctx, const scalar pt_envelope,
 
     // Get the half lengths for the rectangle sides and translation
     const point3 h_lengths = 0.5f * (box_max - box_min);
-    const scalar h_x{math_ns::abs(h_lengths[0])};
-    const scalar h_y{math_ns::abs(h_lengths[1])};
-    const scalar h_z{math_ns::abs(h_lengths[2])};
+    const scalar_t h_x{math_ns::abs(h_lengths[0])};
+    const scalar_t h_y{math_ns::abs(h_lengths[1])};
+    const scalar_t h_z{math_ns::abs(h_lengths[2])};
 
     // Volume links for the portal descriptors and the masks
     const dindex volume_idx{volume.index()};
@@ -162,8 +170,8 @@ inline void create_cuboid_portals(context_t &ctx, const scalar pt_envelope,
 
     // Add material slab (no material on the portals)
     material_link_t material_link{slab_id, materials.template size<slab_id>()};
-    materials.template emplace_back<slab_id>(empty_context{}, vacuum<scalar>{},
-                                             0.f);
+    materials.template emplace_back<slab_id>(empty_context{},
+                                             vacuum<scalar_t>{}, 0.f);
 
     // Build the portal surfaces
     dindex trf_idx{transforms.size(ctx) - 2};
@@ -190,8 +198,8 @@ inline void create_cuboid_portals(context_t &ctx, const scalar pt_envelope,
                             new_x);
 
     ++material_link;
-    materials.template emplace_back<slab_id>(empty_context{}, vacuum<scalar>{},
-                                             0.f);
+    materials.template emplace_back<slab_id>(empty_context{},
+                                             vacuum<scalar_t>{}, 0.f);
 
     surfaces.emplace_back(++trf_idx, mask_link, material_link, volume_idx,
                           dindex_invalid, surface_id::e_portal);
@@ -216,8 +224,8 @@ inline void create_cuboid_portals(context_t &ctx, const scalar pt_envelope,
                             new_x);
 
     ++material_link;
-    materials.template emplace_back<slab_id>(empty_context{}, vacuum<scalar>{},
-                                             0.f);
+    materials.template emplace_back<slab_id>(empty_context{},
+                                             vacuum<scalar_t>{}, 0.f);
 
     surfaces.emplace_back(++trf_idx, mask_link, material_link, volume_idx,
                           dindex_invalid, surface_id::e_portal);
@@ -245,8 +253,9 @@ inline void create_telescope(context_t &ctx, const trajectory_t &traj,
                              material_container_t &materials,
                              transform_container_t &transforms,
                              const config_t &cfg) {
-    // @Note: These type definitions should be removed at some point
-    using vector3 = __plugin::vector3<detray::scalar>;
+    using transform3_t = typename transform_container_t::value_type;
+    using scalar_t = typename transform3_t::scalar_type;
+    using vector3 = typename transform3_t::vector3;
 
     using surface_type = typename surface_container_t::value_type;
     using nav_link_t = typename surface_type::navigation_link;
@@ -257,8 +266,7 @@ inline void create_telescope(context_t &ctx, const trajectory_t &traj,
     constexpr auto slab_id = material_link_t::id_type::e_slab;
 
     // Create the module centers
-    const std::vector<module_placement> m_placements =
-        module_positions(traj, cfg.dists);
+    const auto m_placements = module_positions(traj, cfg.dists);
 
     // Create geometry data
     for (const auto &m_placement : m_placements) {
@@ -293,7 +301,7 @@ inline void create_telescope(context_t &ctx, const trajectory_t &traj,
 
         // Project onto the weakest direction component of the normal vector
         vector3 e_i{0.f, 0.f, 0.f};
-        scalar min = std::numeric_limits<scalar>::infinity();
+        scalar_t min = std::numeric_limits<scalar_t>::infinity();
         unsigned int i{std::numeric_limits<uint>::max()};
         for (unsigned int k = 0u; k < 3u; ++k) {
             if (m_local_z[k] < min) {
@@ -335,22 +343,24 @@ inline void create_telescope(context_t &ctx, const trajectory_t &traj,
 ///
 /// @returns a complete detector object
 template <typename mask_t = mask<rectangle2D<>>,
-          typename trajectory_t = detail::ray<__plugin::transform3<scalar>>,
+          typename trajectory_t = detail::ray<typename mask_t::algebra_type>,
           typename container_t = host_container_types>
 auto create_telescope_detector(
     vecmem::memory_resource &resource,
-    covfie::field<
-        typename telescope_types<typename mask_t::shape>::bfield_backend_t>
+    covfie::field<typename telescope_types<mask_t>::bfield_backend_t>
         &&bfield,
-    const mask_t &msk, std::vector<scalar> dists,
-    const material<scalar> mat = silicon_tml<scalar>(),
-    const scalar thickness = 80.f * unit<scalar>::um,
+    const mask_t &msk, std::vector<telescope_scalar<mask_t>> dists,
+    const material<telescope_scalar<mask_t>> mat =
+        silicon_tml<telescope_scalar<mask_t>>(),
+    const telescope_scalar<mask_t> thickness =
+        80.f * unit<telescope_scalar<mask_t>>::um,
     const trajectory_t traj = {{0.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, -1.f},
-    const scalar envelope = 0.1f * unit<scalar>::mm) {
+    const telescope_scalar<mask_t> envelope =
+        0.1f * unit<telescope_scalar<mask_t>>::mm) {
 
     // detector type
-    using detector_t = detector<telescope_types<typename mask_t::shape>,
-                                covfie::field, container_t>;
+    using detector_t =
+        detector<telescope_types<mask_t>, covfie::field, container_t>;
 
     // @todo: Temporal restriction due to missing local navigation
     assert((dists.size() < 20u) &&
@@ -359,9 +369,9 @@ auto create_telescope_detector(
     // module parameters
     struct surface_config {
         const typename mask_t::mask_values &mask_values;
-        const std::vector<scalar> &dists;
-        material<scalar> m_mat;
-        scalar m_thickness;
+        const std::vector<telescope_scalar<mask_t>> &dists;
+        material<telescope_scalar<mask_t>> m_mat;
+        telescope_scalar<mask_t> m_thickness;
     };
 
     // create empty detector
@@ -392,6 +402,7 @@ auto create_telescope_detector(
     // Add volme to the detector
     det.add_objects_per_volume(ctx, vol, surfaces, masks, transforms,
                                materials);
+    det.update_interaction_tables();
 
     return det;
 }
@@ -401,25 +412,29 @@ auto create_telescope_detector(
 /// @param n_surfaces the number of surfaces that are placed in the geometry
 /// @param tel_length the total length of the steps by the stepper
 template <typename mask_t = mask<rectangle2D<>>,
-          typename trajectory_t = detail::ray<__plugin::transform3<scalar>>,
+          typename trajectory_t = detail::ray<typename mask_t::algebra_type>,
           typename container_t = host_container_types>
 auto create_telescope_detector(
     vecmem::memory_resource &resource,
-    covfie::field<
-        typename telescope_types<typename mask_t::shape>::bfield_backend_t>
+    covfie::field<typename telescope_types<mask_t>::bfield_backend_t>
         &&bfield,
     const mask_t &msk, std::size_t n_surfaces = 10u,
-    const scalar tel_length = 500.f * unit<scalar>::mm,
-    const material<scalar> mat = silicon_tml<scalar>(),
-    const scalar thickness = 80.f * unit<scalar>::um,
+    const telescope_scalar<mask_t> tel_length =
+        500.f * unit<telescope_scalar<mask_t>>::mm,
+    const material<telescope_scalar<mask_t>> mat =
+        silicon_tml<telescope_scalar<mask_t>>(),
+    const telescope_scalar<mask_t> thickness =
+        80.f * unit<telescope_scalar<mask_t>>::um,
     const trajectory_t traj = {{0.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, -1.f},
-    const scalar envelope = 0.01f * unit<scalar>::mm) {
+    const telescope_scalar<mask_t> envelope =
+        0.01f * unit<telescope_scalar<mask_t>>::mm) {
     // Generate equidistant positions
-    std::vector<scalar> distances = {};
-    scalar pos = 0.f;
-    scalar dist{n_surfaces > 1u
-                    ? tel_length / static_cast<scalar>(n_surfaces - 1u)
-                    : 0.f};
+    std::vector<telescope_scalar<mask_t>> distances = {};
+    telescope_scalar<mask_t> pos = 0.f;
+    telescope_scalar<mask_t> dist{
+        n_surfaces > 1u ? tel_length / static_cast<telescope_scalar<mask_t>>(
+                                           n_surfaces - 1u)
+                        : 0.f};
     for (std::size_t i = 0u; i < n_surfaces; ++i) {
         distances.push_back(pos);
         pos += dist;
@@ -433,18 +448,20 @@ auto create_telescope_detector(
 
 /// Wrapper for create_telescope_geometry with constant zero bfield.
 template <typename mask_t = mask<rectangle2D<>>,
-          typename trajectory_t = detail::ray<__plugin::transform3<scalar>>,
+          typename trajectory_t = detail::ray<typename mask_t::algebra_type>,
           typename container_t = host_container_types>
 auto create_telescope_detector(
     vecmem::memory_resource &resource, const mask_t &msk,
-    const std::vector<scalar> dists,
-    const material<scalar> mat = silicon_tml<scalar>(),
-    const scalar thickness = 80.f * unit<scalar>::um,
+    const std::vector<telescope_scalar<mask_t>> dists,
+    const material<telescope_scalar<mask_t>> mat =
+        silicon_tml<telescope_scalar<mask_t>>(),
+    const telescope_scalar<mask_t> thickness =
+        80.f * unit<telescope_scalar<mask_t>>::um,
     const trajectory_t traj = {{0.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, -1.f},
-    const scalar envelope = 0.1f * unit<scalar>::mm) {
+    const telescope_scalar<mask_t> envelope =
+        0.1f * unit<telescope_scalar<mask_t>>::mm) {
 
-    using covfie_bkdn_t =
-        typename telescope_types<typename mask_t::shape>::bfield_backend_t;
+    using covfie_bkdn_t = typename telescope_types<mask_t>::bfield_backend_t;
 
     // Build the geometry
     return create_telescope_detector<mask_t, trajectory_t, container_t>(
@@ -456,19 +473,22 @@ auto create_telescope_detector(
 
 /// Wrapper for create_telescope_geometry with constant zero bfield.
 template <typename mask_t = mask<rectangle2D<>>,
-          typename trajectory_t = detail::ray<__plugin::transform3<scalar>>,
+          typename trajectory_t = detail::ray<typename mask_t::algebra_type>,
           typename container_t = host_container_types>
 auto create_telescope_detector(
     vecmem::memory_resource &resource, const mask_t &msk,
     std::size_t n_surfaces = 10u,
-    const scalar tel_length = 500.f * unit<scalar>::mm,
-    const material<scalar> mat = silicon_tml<scalar>(),
-    const scalar thickness = 80.f * unit<scalar>::um,
+    const telescope_scalar<mask_t> tel_length =
+        500.f * unit<telescope_scalar<mask_t>>::mm,
+    const material<telescope_scalar<mask_t>> mat =
+        silicon_tml<telescope_scalar<mask_t>>(),
+    const telescope_scalar<mask_t> thickness =
+        80.f * unit<telescope_scalar<mask_t>>::um,
     const trajectory_t traj = {{0.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, -1.f},
-    const scalar envelope = 0.1f * unit<scalar>::mm) {
+    const telescope_scalar<mask_t> envelope =
+        0.1f * unit<telescope_scalar<mask_t>>::mm) {
 
-    using covfie_bkdn_t =
-        typename telescope_types<typename mask_t::shape>::bfield_backend_t;
+    using covfie_bkdn_t = typename telescope_types<mask_t>::bfield_backend_t;
 
     // Build the geometry
     return create_telescope_detector<mask_t, trajectory_t, container_t>(
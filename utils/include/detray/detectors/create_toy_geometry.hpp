@@ -14,7 +14,11 @@
 #include "detray/detectors/toy_metadata.hpp"
 #include "detray/geometry/detector_volume.hpp"
 #include "detray/materials/predefined_materials.hpp"
+#include "detray/tools/detector_assembler.hpp"
+#include "detray/tools/grid_builder.hpp"
+#include "detray/tools/store_deduplicator.hpp"
 #include "detray/tools/volume_builder.hpp"
+#include "detray/utils/for_each.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
@@ -24,9 +28,13 @@
 #include <covfie/core/field.hpp>
 
 // System include(s)
+#include <cassert>
+#include <cstddef>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -148,24 +156,21 @@ inline void add_disc_surface(
                           volume_idx, dindex_invalid, sf_id);
 }
 
-/** Function that adds a generic cylinder volume, using a factory for contained
- *  module surfaces.
+/** Function that fills the fragment of a generic cylinder volume with its
+ *  placement and portals.
  *
  * @tparam detector_t the detector type
- * @tparam factory_t type of module factory. Must be callable on containers.
  *
- * @param det detector the volume should be added to
- * @param resource vecmem memory resource for the temporary containers
+ * @param frag fragment of the volume in the detector assembler
  * @param ctx geometry context
  * @param lay_inner_r inner radius of volume
  * @param lay_outer_r outer radius of volume
  * @param lay_neg_r lower extend of volume
  * @param lay_pos_r upper extend of volume
  * @param volume_links volume links for the portals of the volume
- * @param module_factory functor that adds module surfaces to volume
  */
 template <typename detector_t>
-void create_cyl_volume(detector_t &det, vecmem::memory_resource &resource,
+void create_cyl_volume(volume_fragment<detector_t> &frag,
                        typename detector_t::geometry_context &ctx,
                        const scalar lay_inner_r, const scalar lay_outer_r,
                        const scalar lay_neg_z, const scalar lay_pos_z,
@@ -179,14 +184,8 @@ void create_cyl_volume(detector_t &det, vecmem::memory_resource &resource,
     const scalar lower_z{std::min(lay_neg_z, lay_pos_z)};
     const scalar upper_z{std::max(lay_neg_z, lay_pos_z)};
 
-    // Add module surfaces to volume
-    typename detector_t::surface_container_t surfaces(&resource);
-    typename detector_t::mask_container masks(resource);
-    typename detector_t::material_container materials(resource);
-    typename detector_t::transform_container transforms(resource);
-
-    auto &cyl_volume = det.new_volume(
-        volume_id::e_cylinder, {detector_t::sf_finders::id::e_default, 0u});
+    // The portal link is set when the fragment is merged into the detector
+    auto &cyl_volume = frag.volume;
     cyl_volume.template set_link<object_id::e_portal>(
         detector_t::sf_finders::id::e_default, detail::invalid_value<dindex>());
     cyl_volume.template set_link<object_id::e_passive>(
@@ -194,31 +193,28 @@ void create_cyl_volume(detector_t &det, vecmem::memory_resource &resource,
     cyl_volume.template set_link<object_id::e_sensitive>(
         detector_t::sf_finders::id::e_default, detail::invalid_value<dindex>());
 
-    // volume placement
-    cyl_volume.set_transform(det.transform_store().size());
-    // translation of the cylinder
-    point3 t{0.f, 0.f, 0.5f * (upper_z + lower_z)};
-    det.transform_store().emplace_back(ctx, t);
+    // volume placement: translation of the cylinder
+    frag.placement = typename detector_t::transform3{
+        point3{0.f, 0.f, 0.5f * (upper_z + lower_z)}};
 
     // negative and positive, inner and outer portal surface
     constexpr auto cyl_id = detector_t::masks::id::e_portal_cylinder2;
-    add_cylinder_surface<cyl_id>(cyl_volume.index(), ctx, surfaces, masks,
-                                 materials, transforms, inner_r, lower_z,
-                                 upper_z, volume_links[0], vacuum<scalar>(),
-                                 0.f * unit<scalar>::mm);
-    add_cylinder_surface<cyl_id>(cyl_volume.index(), ctx, surfaces, masks,
-                                 materials, transforms, outer_r, lower_z,
-                                 upper_z, volume_links[1], vacuum<scalar>(),
-                                 0.f * unit<scalar>::mm);
-    add_disc_surface(cyl_volume.index(), ctx, surfaces, masks, materials,
-                     transforms, inner_r, outer_r, lower_z, volume_links[2],
-                     vacuum<scalar>(), 0.f * unit<scalar>::mm);
-    add_disc_surface(cyl_volume.index(), ctx, surfaces, masks, materials,
-                     transforms, inner_r, outer_r, upper_z, volume_links[3],
-                     vacuum<scalar>(), 0.f * unit<scalar>::mm);
-
-    det.add_objects_per_volume(ctx, cyl_volume, surfaces, masks, transforms,
-                               materials);
+    add_cylinder_surface<cyl_id>(cyl_volume.index(), ctx, frag.surfaces,
+                                 frag.masks, frag.materials, frag.transforms,
+                                 inner_r, lower_z, upper_z, volume_links[0],
+                                 vacuum<scalar>(), 0.f * unit<scalar>::mm);
+    add_cylinder_surface<cyl_id>(cyl_volume.index(), ctx, frag.surfaces,
+                                 frag.masks, frag.materials, frag.transforms,
+                                 outer_r, lower_z, upper_z, volume_links[1],
+                                 vacuum<scalar>(), 0.f * unit<scalar>::mm);
+    add_disc_surface(cyl_volume.index(), ctx, frag.surfaces, frag.masks,
+                     frag.materials, frag.transforms, inner_r, outer_r,
+                     lower_z, volume_links[2], vacuum<scalar>(),
+                     0.f * unit<scalar>::mm);
+    add_disc_surface(cyl_volume.index(), ctx, frag.surfaces, frag.masks,
+                     frag.materials, frag.transforms, inner_r, outer_r,
+                     upper_z, volume_links[3], vacuum<scalar>(),
+                     0.f * unit<scalar>::mm);
 }
 
 /** Helper function that creates a layer of rectangular barrel modules.
@@ -322,11 +318,75 @@ inline void create_barrel_modules(context_t &ctx, volume_type &vol,
     }
 }
 
+/// Helper function that adds the modules of a layer to the fragment of its
+/// volume. The modules are filled into the surface grid @param grid once the
+/// fragment is merged into the detector and their links are final.
+///
+/// @param ctx geometry context
+/// @param resource vecmem memory resource for the temporary containers
+/// @param frag fragment of the layer volume, which already holds the portals
+/// @param grid the empty grid with proper axes
+/// @param cfg config struct for module creation
+/// @param module_factory functor that creates the modules
+template <auto grid_id, typename detector_t, typename grid_t,
+          typename config_t, typename factory_t>
+inline void add_module_grid(const typename detector_t::geometry_context &ctx,
+                            vecmem::memory_resource &resource,
+                            volume_fragment<detector_t> &frag, grid_t &&grid,
+                            const config_t &cfg, factory_t &module_factory) {
+    using geo_obj_ids = typename detector_t::geo_obj_ids;
+    using volume_type = typename detector_t::volume_type;
+    using surface_container_t = typename detector_t::surface_container_t;
+
+    // Create the sensitive surfaces
+    surface_container_t surfaces(&resource);
+    typename detector_t::mask_container masks(resource);
+    typename detector_t::material_container materials(resource);
+    typename detector_t::transform_container transforms(resource);
+    module_factory(ctx, frag.volume, surfaces, masks, materials, transforms);
+
+    // Let modules with the same shape and material share the store entries
+    if (cfg.deduplicate) {
+        store_deduplicator{}(surfaces, masks, materials);
+    }
+
+    // Link the modules into the volume stores, after the portals
+    const auto trf_offset{frag.transforms.size(ctx)};
+    for (auto &sf : surfaces) {
+        frag.masks.template visit<detail::mask_index_update>(sf.mask(), sf);
+        frag.materials.template visit<detail::material_index_update>(
+            sf.material(), sf);
+        sf.update_transform(trf_offset);
+    }
+
+    // Fill the grid by the module positions and add it to the detector
+    frag.add_accelerator = [grid = std::forward<grid_t>(grid),
+                            module_trfs = transforms, ctx](
+                               detector_t &det, volume_type &vol,
+                               const surface_container_t &sensitives) mutable {
+        detail::fill_by_pos{}(grid, detector_volume{det, vol}, sensitives,
+                              module_trfs, det.mask_store(), ctx);
+        assert(grid.all().size() == sensitives.size());
+
+        det.surface_store().template push_back<grid_id>(grid);
+        vol.template set_link<geo_obj_ids::e_sensitive>(
+            grid_id, det.surface_store().template size<grid_id>() - 1u);
+    };
+
+    // Add modules, transforms, masks and material to the fragment
+    frag.sensitives.assign(surfaces.begin(), surfaces.end());
+    frag.transforms.append(std::move(transforms), ctx);
+    frag.masks.append(std::move(masks));
+    frag.materials.append(std::move(materials));
+}
+
 /// Helper function that creates a surface grid of rectangular barrel modules.
 ///
-/// @param surfaces_grid the grid to be created with proper axes
-/// @param resource vecmem memory resource
+/// @param ctx geometry context
+/// @param resource vecmem memory resource for the temporary containers
+/// @param frag fragment of the layer volume, which already holds the portals
 /// @param cfg config struct for module creation
+/// @param module_factory functor that creates the modules
 template <
     typename detector_t, typename config_t, typename factory_t,
     std::enable_if_t<
@@ -339,12 +399,8 @@ template <
         bool> = true>
 inline void add_cylinder_grid(const typename detector_t::geometry_context &ctx,
                               vecmem::memory_resource &resource,
-                              typename detector_t::volume_type &vol,
-                              detector_t &det, const config_t &cfg,
-                              factory_t &module_factory) {
-    // Get relevant ids
-    using geo_obj_ids = typename detector_t::geo_obj_ids;
-
+                              volume_fragment<detector_t> &frag,
+                              const config_t &cfg, factory_t &module_factory) {
     constexpr auto cyl_id = detector_t::masks::id::e_portal_cylinder2;
     constexpr auto grid_id = detector_t::sf_finders::id::e_cylinder2_grid;
 
@@ -353,56 +409,23 @@ inline void add_cylinder_grid(const typename detector_t::geometry_context &ctx,
     auto gbuilder =
         grid_builder<detector_t, cyl_grid_t, detray::detail::fill_by_pos>{};
 
-    // The disc portals are at the end of the portal range by construction
-    auto portal_mask_idx = (det.portals(vol).end() - 3u)->mask().index();
+    // The outer cylinder portal comes before the two disc portals
+    auto portal_mask_idx = (frag.surfaces.end() - 3u)->mask().index();
     const auto &cyl_mask =
-        det.mask_store().template get<cyl_id>().at(portal_mask_idx);
+        frag.masks.template get<cyl_id>().at(portal_mask_idx);
 
-    // Create the sensitive surfaces
-    typename detector_t::surface_container_t surfaces(&resource);
-    typename detector_t::mask_container masks(resource);
-    typename detector_t::material_container materials(resource);
-    typename detector_t::transform_container transforms(resource);
-    module_factory(ctx, vol, surfaces, masks, materials, transforms);
-
-    // Iterate the surfaces and update their links
-    const auto trf_offset{det.transform_store().size(ctx)};
-    auto sf_offset{det.n_surfaces()};
-    for (auto &sf : surfaces) {
-        // Make sure the volume was constructed correctly
-        assert(sf.volume() < det.volumes().size());
-        // Update the surface links accroding to number of data in detector
-        det.mask_store().template visit<detail::mask_index_update>(sf.mask(),
-                                                                   sf);
-        det.material_store().template visit<detail::material_index_update>(
-            sf.material(), sf);
-        sf.update_transform(trf_offset);
-        sf.set_index(sf_offset++);
-        // Copy surface descriptor into global lookup
-        det.add_surface_to_lookup(sf);
-    }
-
-    // Add new grid to the detector
     gbuilder.init_grid(cyl_mask, {cfg.m_binning.first, cfg.m_binning.second});
-    gbuilder.fill_grid(detector_volume{det, vol}, surfaces, transforms, masks,
-                       ctx);
-    assert(gbuilder.get().all().size() == surfaces.size());
-
-    // Add transforms, masks and material to detector
-    det.append_masks(std::move(masks));
-    det.append_transforms(std::move(transforms));
-    det.append_materials(std::move(materials));
-    det.surface_store().template push_back<grid_id>(gbuilder.get());
-    vol.template set_link<geo_obj_ids::e_sensitive>(
-        grid_id, det.surface_store().template size<grid_id>() - 1u);
+    add_module_grid<grid_id>(ctx, resource, frag, std::move(gbuilder.get()),
+                             cfg, module_factory);
 }
 
 /// Helper function that creates a surface grid of trapezoidal endcap modules.
 ///
-/// @param vol the detector volume that should be equipped with a grid
-/// @param surfaces_grid the grid to be created with proper axes
-/// @param resource vecmem memory resource
+/// @param ctx geometry context
+/// @param resource vecmem memory resource for the temporary containers
+/// @param frag fragment of the layer volume, which already holds the portals
 /// @param cfg config struct for module creation
+/// @param module_factory functor that creates the modules
 template <
     typename detector_t, typename config_t, typename factory_t,
     std::enable_if_t<
@@ -415,12 +438,8 @@ template <
         bool> = true>
 inline void add_disc_grid(const typename detector_t::geometry_context &ctx,
                           vecmem::memory_resource &resource,
-                          typename detector_t::volume_type &vol,
-                          detector_t &det, const config_t &cfg,
-                          factory_t &module_factory) {
-    // Get relevant ids
-    using geo_obj_ids = typename detector_t::geo_obj_ids;
-
+                          volume_fragment<detector_t> &frag,
+                          const config_t &cfg, factory_t &module_factory) {
     constexpr auto disc_id = detector_t::masks::id::e_portal_ring2;
     constexpr auto grid_id = detector_t::sf_finders::id::e_disc_grid;
 
@@ -430,48 +449,14 @@ inline void add_disc_grid(const typename detector_t::geometry_context &ctx,
         grid_builder<detector_t, disc_grid_t, detray::detail::fill_by_pos>{};
 
     // The disc portals are at the end of the portal range by construction
-    auto portal_mask_idx = det.portals(vol).back().mask().index();
+    auto portal_mask_idx = frag.surfaces.back().mask().index();
     const auto &disc_mask =
-        det.mask_store().template get<disc_id>().at(portal_mask_idx);
-
-    // Create the sensitive surfaces
-    typename detector_t::surface_container_t surfaces(&resource);
-    typename detector_t::mask_container masks(resource);
-    typename detector_t::material_container materials(resource);
-    typename detector_t::transform_container transforms(resource);
-    module_factory(ctx, vol, surfaces, masks, materials, transforms);
-
-    // Iterate the surfaces and update their links
-    const auto trf_offset{det.transform_store().size(ctx)};
-    auto sf_offset{det.n_surfaces()};
-    for (auto &sf : surfaces) {
-        // Make sure the volume was constructed correctly
-        assert(sf.volume() < det.volumes().size());
-        // Update the surface links accroding to number of data in detector
-        det.mask_store().template visit<detail::mask_index_update>(sf.mask(),
-                                                                   sf);
-        det.material_store().template visit<detail::material_index_update>(
-            sf.material(), sf);
-        sf.update_transform(trf_offset);
-        sf.set_index(sf_offset++);
-        // Copy surface descriptor into global lookup
-        det.add_surface_to_lookup(sf);
-    }
+        frag.masks.template get<disc_id>().at(portal_mask_idx);
 
-    // Add new grid to the detector
     gbuilder.init_grid(disc_mask,
                        {cfg.disc_binning.size(), cfg.disc_binning.front()});
-    gbuilder.fill_grid(detector_volume{det, vol}, surfaces, transforms, masks,
-                       ctx);
-    assert(gbuilder.get().all().size() == surfaces.size());
-
-    // Add transforms, masks and material to detector
-    det.append_masks(std::move(masks));
-    det.append_transforms(std::move(transforms));
-    det.append_materials(std::move(materials));
-    det.surface_store().template push_back<grid_id>(gbuilder.get());
-    vol.template set_link<geo_obj_ids::e_sensitive>(
-        grid_id, det.surface_store().template size<grid_id>() - 1u);
+    add_module_grid<grid_id>(ctx, resource, frag, std::move(gbuilder.get()),
+                             cfg, module_factory);
 }
 
 /** Helper method for positioning of modules in an endcap ring
@@ -847,14 +832,17 @@ inline void add_endcap_barrel_connection(
  * @param lay_sizes extend of the endcap layers in z direction
  * @param lay_positions position of the endcap layers in z direction
  * @param cfg config struct for module creation
+ * @param for_each loop in which the volumes are built
  */
-template <typename edc_module_factory, typename detector_t, typename config_t>
+template <typename edc_module_factory, typename detector_t, typename config_t,
+          typename for_each_t>
 void add_endcap_detector(
     detector_t &det, vecmem::memory_resource &resource,
     typename detector_t::geometry_context &ctx, dindex n_layers,
     dindex beampipe_idx,
     const std::vector<std::pair<scalar, scalar>> &lay_sizes,
-    const std::vector<scalar> &lay_positions, config_t cfg) {
+    const std::vector<scalar> &lay_positions, config_t cfg,
+    const for_each_t &for_each) {
     using nav_link_t = typename detector_t::surface_type::navigation_link;
     constexpr auto leaving_world{detail::invalid_value<nav_link_t>()};
 
@@ -898,8 +886,6 @@ void add_endcap_detector(
         vol_sizes.emplace_back(lay_sizes[i].first, lay_sizes[i].second);
     }
 
-    edc_module_factory m_factory{cfg};
-
     auto vol_size_itr = vol_sizes.begin();
     auto pos_itr = lay_positions.begin();
     // Reverse iteration for negative endcap
@@ -907,27 +893,29 @@ void add_endcap_detector(
         std::advance(vol_size_itr, 2u * n_layers - 2u);
         std::advance(pos_itr, n_layers - 1u);
     }
-    bool is_gap = true;
-    for (int i = 0; i < 2 * static_cast<int>(n_layers) - 1; ++i) {
-        // Every second layer is a gap volume
-        is_gap = !is_gap;
-        const scalar sign{static_cast<scalar>(cfg.side)};
-        if (is_gap) {
-            create_cyl_volume(det, resource, ctx, cfg.inner_r, cfg.outer_r,
+    const scalar sign{static_cast<scalar>(cfg.side)};
+
+    // Build the layer and gap volumes independently of each other
+    const std::vector<volume_id> vol_ids(2u * n_layers - 1u,
+                                         volume_id::e_cylinder);
+    detector_assembler<detector_t, for_each_t> assembler{for_each};
+    assembler(
+        det, vol_ids,
+        [&](volume_fragment<detector_t> &frag, const std::size_t idx) {
+            const int i{static_cast<int>(idx)};
+            create_cyl_volume(frag, ctx, cfg.inner_r, cfg.outer_r,
                               sign * (vol_size_itr + cfg.side * i)->first,
                               sign * (vol_size_itr + cfg.side * i)->second,
-                              volume_links_vec[static_cast<unsigned int>(i)]);
+                              volume_links_vec[idx]);
 
-        } else {
-            m_factory.cfg.edc_position = *(pos_itr + cfg.side * i / 2);
-            create_cyl_volume(det, resource, ctx, cfg.inner_r, cfg.outer_r,
-                              sign * (vol_size_itr + cfg.side * i)->first,
-                              sign * (vol_size_itr + cfg.side * i)->second,
-                              volume_links_vec[static_cast<unsigned int>(i)]);
-            add_disc_grid(ctx, resource, det.volumes().back(), det, cfg,
-                          m_factory);
-        }
-    }
+            // Every second volume is a gap volume without modules
+            if (idx % 2u == 0u) {
+                edc_module_factory m_factory{cfg};
+                m_factory.cfg.edc_position = *(pos_itr + cfg.side * i / 2);
+                add_disc_grid(ctx, resource, frag, cfg, m_factory);
+            }
+        },
+        ctx);
 }
 
 /** Helper method for creating the barrel section.
@@ -941,15 +929,18 @@ void add_endcap_detector(
  * @param lay_sizes extend of the barrel layers in r direction
  * @param lay_positions position of the barrel layers in r direction
  * @param cfg config struct for module creation
+ * @param for_each loop in which the volumes are built
  */
-template <typename brl_module_factory, typename detector_t, typename config_t>
+template <typename brl_module_factory, typename detector_t, typename config_t,
+          typename for_each_t>
 void add_barrel_detector(
     detector_t &det, vecmem::memory_resource &resource,
     typename detector_t::geometry_context &ctx, const unsigned int n_layers,
     dindex beampipe_idx, const scalar brl_half_z,
     const std::vector<std::pair<scalar, scalar>> &lay_sizes,
     const std::vector<scalar> &lay_positions,
-    const std::vector<std::pair<int, int>> &m_binning, config_t cfg) {
+    const std::vector<std::pair<int, int>> &m_binning, config_t cfg,
+    const for_each_t &for_each) {
 
     using nav_link_t = typename detector_t::surface_type::navigation_link;
     constexpr auto leaving_world{detail::invalid_value<nav_link_t>()};
@@ -986,26 +977,27 @@ void add_barrel_detector(
         vol_sizes.emplace_back(lay_sizes[i].first, lay_sizes[i].second);
     }
 
-    brl_module_factory m_factory{cfg};
-    bool is_gap = true;
-    for (unsigned int i = 0u; i < 2u * n_layers - 1u; ++i) {
-        unsigned int j = (i + 2u) / 2u;
-        // Every second layer is a gap volume
-        is_gap = !is_gap;
-        if (is_gap) {
-            create_cyl_volume(det, resource, ctx, vol_sizes[i].first,
+    // Build the layer and gap volumes independently of each other
+    const std::vector<volume_id> vol_ids(2u * n_layers - 1u,
+                                         volume_id::e_cylinder);
+    detector_assembler<detector_t, for_each_t> assembler{for_each};
+    assembler(
+        det, vol_ids,
+        [&](volume_fragment<detector_t> &frag, const std::size_t i) {
+            create_cyl_volume(frag, ctx, vol_sizes[i].first,
                               vol_sizes[i].second, -brl_half_z, brl_half_z,
                               volume_links_vec[i]);
-        } else {
-            m_factory.cfg.m_binning = m_binning[j];
-            m_factory.cfg.layer_r = lay_positions[j];
-            create_cyl_volume(det, resource, ctx, vol_sizes[i].first,
-                              vol_sizes[i].second, -brl_half_z, brl_half_z,
-                              volume_links_vec[i]);
-            add_cylinder_grid(ctx, resource, det.volumes().back(), det, cfg,
-                              m_factory);
-        }
-    }
+
+            // Every second volume is a gap volume without modules
+            if (i % 2u == 0u) {
+                const std::size_t j{(i + 2u) / 2u};
+                brl_module_factory m_factory{cfg};
+                m_factory.cfg.m_binning = m_binning[j];
+                m_factory.cfg.layer_r = lay_positions[j];
+                add_cylinder_grid(ctx, resource, frag, cfg, m_factory);
+            }
+        },
+        ctx);
 }
 
 }  // namespace
@@ -1015,19 +1007,30 @@ void add_barrel_detector(
  *  present when an endcap detector is built to have the barrel region radius
  *  match the endcap diameter.
  *
+ * @tparam metadata_t the toy detector metadata (e.g. with a different
+ *         transform store)
+ *
  * @param n_brl_layers number of pixel barrel layer to build (max 4)
  * @param n_edc_layers number of pixel endcap discs to build (max 7)
+ * @param deduplicate let the modules of a layer share their masks and
+ *        material slabs
+ * @param for_each loop in which the volumes of the barrel and the endcaps
+ *        are built (serial by default). If it is threaded, @param resource
+ *        has to be thread-safe.
  *
  * @returns a complete detector object
  */
-template <typename container_t = host_container_types>
+template <typename container_t = host_container_types,
+          typename metadata_t = toy_metadata<>,
+          typename for_each_t = detail::serial_for_each>
 auto create_toy_geometry(
     vecmem::memory_resource &resource,
-    covfie::field<toy_metadata<>::bfield_backend_t> &&bfield,
-    unsigned int n_brl_layers = 4u, unsigned int n_edc_layers = 3u) {
+    covfie::field<typename metadata_t::bfield_backend_t> &&bfield,
+    unsigned int n_brl_layers = 4u, unsigned int n_edc_layers = 3u,
+    const bool deduplicate = false, for_each_t &&for_each = {}) {
 
     // detector type
-    using detector_t = detector<toy_metadata<>, covfie::field, container_t>;
+    using detector_t = detector<metadata_t, covfie::field, container_t>;
 
     /// Leaving world
     using nav_link_t = typename detector_t::surface_type::navigation_link;
@@ -1057,6 +1060,7 @@ auto create_toy_geometry(
         std::pair<unsigned int, unsigned int> m_binning = {16u, 14u};
         material<scalar> mat = silicon_tml<scalar>();
         scalar thickness{0.15f * unit<scalar>::mm};
+        bool deduplicate{false};
     };
 
     //
@@ -1086,6 +1090,7 @@ auto create_toy_geometry(
         std::vector<scalar> m_tilt = {0.f, 0.f};
         material<scalar> mat = silicon_tml<scalar>();
         scalar thickness{0.15f * unit<scalar>::mm};
+        bool deduplicate{false};
     };
 
     // Fills volume with barrel layer
@@ -1126,6 +1131,8 @@ auto create_toy_geometry(
 
     brl_m_config brl_config{};
     edc_m_config edc_config{};
+    brl_config.deduplicate = deduplicate;
+    edc_config.deduplicate = deduplicate;
 
     if (n_edc_layers > edc_positions.size()) {
         throw std::invalid_argument(
@@ -1156,7 +1163,7 @@ auto create_toy_geometry(
         // negative endcap layers
         add_endcap_detector<edc_module_factory>(
             det, resource, ctx0, n_edc_layers, beampipe_idx, edc_lay_sizes,
-            edc_positions, edc_config);
+            edc_positions, edc_config, for_each);
 
         // gap volume that connects barrel and neg. endcap
         dindex prev_vol_idx = det.volumes().back().index();
@@ -1174,7 +1181,7 @@ auto create_toy_geometry(
         // barrel
         add_barrel_detector<brl_module_factory>(
             det, resource, ctx0, n_brl_layers, beampipe_idx, brl_half_z,
-            brl_lay_sizes, brl_positions, brl_binning, brl_config);
+            brl_lay_sizes, brl_positions, brl_binning, brl_config, for_each);
     }
     if (n_edc_layers > 0u) {
         // gap layer that connects barrel and pos. endcap
@@ -1194,23 +1201,32 @@ auto create_toy_geometry(
         // positive endcap layers
         add_endcap_detector<edc_module_factory>(
             det, resource, ctx0, n_edc_layers, beampipe_idx, edc_lay_sizes,
-            edc_positions, edc_config);
+            edc_positions, edc_config, for_each);
     }
 
+    det.update_interaction_tables();
+
     return det;
 }
 
 /** Wrapper for create_toy_geometry with constant zero bfield.
  */
-template <typename container_t = host_container_types>
+template <typename container_t = host_container_types,
+          typename metadata_t = toy_metadata<>,
+          typename for_each_t = detail::serial_for_each>
 auto create_toy_geometry(vecmem::memory_resource &resource,
                          unsigned int n_brl_layers = 4u,
-                         unsigned int n_edc_layers = 3u) {
-    return create_toy_geometry<container_t>(
+                         unsigned int n_edc_layers = 3u,
+                         const bool deduplicate = false,
+                         for_each_t &&for_each = {}) {
+    using bfield_backend_t = typename metadata_t::bfield_backend_t;
+
+    return create_toy_geometry<container_t, metadata_t>(
         resource,
-        covfie::field<toy_metadata<>::bfield_backend_t>{
-            toy_metadata<>::bfield_backend_t::configuration_t{0.f, 0.f, 0.f}},
-        n_brl_layers, n_edc_layers);
+        covfie::field<bfield_backend_t>{
+            typename bfield_backend_t::configuration_t{0.f, 0.f, 0.f}},
+        n_brl_layers, n_edc_layers, deduplicate,
+        std::forward<for_each_t>(for_each));
 }
 
 }  // namespace detray
@@ -25,32 +25,37 @@
 namespace detray {
 
 /// Defines a telescope detector type with only rectangle portals and one
-/// additional kind of contained module surfaces (@tparam mask_shape_t)
+/// additional kind of contained module surfaces (@tparam mask_shape_t). The
+/// geometry is given in the precision of the algebra @tparam algebra_t
 template <typename mask_shape_t = rectangle2D<>,
-          typename _bfield_backend_t =
-              covfie::backend::constant<covfie::vector::vector_d<scalar, 3>,
-                                        covfie::vector::vector_d<scalar, 3>>>
+          typename algebra_t = __plugin::transform3<detray::scalar>,
+          typename _bfield_backend_t = covfie::backend::constant<
+              covfie::vector::vector_d<typename algebra_t::scalar_type, 3>,
+              covfie::vector::vector_d<typename algebra_t::scalar_type, 3>>>
 struct telescope_metadata {
 
+    using scalar_type = typename algebra_t::scalar_type;
+
     /// Mask to (next) volume link: next volume(s)
     using nav_link = std::uint_least16_t;
 
     /// Mask types (these types are needed for the portals, which are always
     /// there, and to resolve the wire surface material, i.e. slab vs. rod)
-    using rectangle = mask<rectangle2D<>, nav_link>;
-    using straw_wire = mask<line<false>, nav_link>;
-    using cell_wire = mask<line<true>, nav_link>;
+    using rectangle = mask<rectangle2D<>, nav_link, algebra_t>;
+    using straw_wire = mask<line<false>, nav_link, algebra_t>;
+    using cell_wire = mask<line<true>, nav_link, algebra_t>;
+    using module_mask = mask<mask_shape_t, nav_link, algebra_t>;
 
     /// Material types
-    using rod = material_rod<detray::scalar>;
-    using slab = material_slab<detray::scalar>;
+    using rod = material_rod<scalar_type>;
+    using slab = material_slab<scalar_type>;
 
     using bfield_backend_t = _bfield_backend_t;
 
     /// How to store coordinate transform matrices
     template <template <typename...> class vector_t = dvector>
-    using transform_store = single_store<__plugin::transform3<detray::scalar>,
-                                         vector_t, geometry_context>;
+    using transform_store =
+        single_store<algebra_t, vector_t, geometry_context>;
 
     /// Rectangles are always needed as portals (but the yhave the same type as
     /// module rectangles). Only one additional mask shape is allowed
@@ -80,11 +85,11 @@ struct telescope_metadata {
     template <template <typename...> class tuple_t = dtuple,
               template <typename...> class vector_t = dvector>
     using mask_store = std::conditional_t<
-        std::is_same_v<mask<mask_shape_t, nav_link>, rectangle>,
+        std::is_same_v<module_mask, rectangle>,
         regular_multi_store<mask_ids, empty_context, tuple_t, vector_t,
                             rectangle>,
         regular_multi_store<mask_ids, empty_context, tuple_t, vector_t,
-                            rectangle, mask<mask_shape_t, nav_link>>>;
+                            rectangle, module_mask>>;
 
     /// Material type ids
     enum class material_ids {
@@ -95,14 +100,14 @@ struct telescope_metadata {
 
     /// How to store materials
     template <template <typename...> class tuple_t = dtuple,
-              template <typename...> class vector_t = dvector>
+              typename container_t = host_container_types>
     using material_store = std::conditional_t<
-        std::is_same_v<mask<mask_shape_t, nav_link>, cell_wire> |
-            std::is_same_v<mask<mask_shape_t, nav_link>, straw_wire>,
-        regular_multi_store<material_ids, empty_context, tuple_t, vector_t,
-                            slab, rod>,
-        regular_multi_store<material_ids, empty_context, tuple_t, vector_t,
-                            slab>>;
+        std::is_same_v<module_mask, cell_wire> |
+            std::is_same_v<module_mask, straw_wire>,
+        regular_multi_store<material_ids, empty_context, tuple_t,
+                            container_t::template vector_type, slab, rod>,
+        regular_multi_store<material_ids, empty_context, tuple_t,
+                            container_t::template vector_type, slab>>;
 
     /// How to link to the entries in the data stores
     using transform_link = typename transform_store<>::link_type;
@@ -99,9 +99,10 @@ struct toy_metadata {
 
     /// How to store materials
     template <template <typename...> class tuple_t = dtuple,
-              template <typename...> class vector_t = dvector>
-    using material_store = regular_multi_store<material_ids, empty_context,
-                                               tuple_t, vector_t, slab>;
+              typename container_t = host_container_types>
+    using material_store =
+        regular_multi_store<material_ids, empty_context, tuple_t,
+                            container_t::template vector_type, slab>;
 
     /// How to link to the entries in the data stores
     using transform_link = typename transform_store<>::link_type;
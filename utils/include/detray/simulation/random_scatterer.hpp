@@ -12,12 +12,13 @@
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/materials/material_map.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/simulation/landau_distribution.hpp"
 #include "detray/simulation/scattering_helper.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/axis_rotation.hpp"
-#include "detray/utils/ranges.hpp"
 #include "detray/utils/unit_vectors.hpp"
 
 // System include(s).
@@ -25,14 +26,19 @@
 
 namespace detray {
 
-template <typename transform3_t>
+/// @tparam transform3_t algebra of the track parameters
+/// @tparam mat_scalar_t precision of the detector material
+template <typename transform3_t,
+          typename mat_scalar_t = typename transform3_t::scalar_type>
 struct random_scatterer : actor {
 
     using transform3_type = transform3_t;
     using matrix_operator = typename transform3_type::matrix_actor;
     using scalar_type = typename transform3_type::scalar_type;
     using vector3 = typename transform3_type::vector3;
-    using interaction_type = interaction<scalar_type>;
+    /// The material interaction is evaluated in the precision of the detector
+    /// material, which can be different from the track precision
+    using interaction_type = interaction<mat_scalar_t>;
 
     struct state {
         std::random_device rd{};
@@ -56,6 +62,8 @@ struct random_scatterer : actor {
         // Simulation setup
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
+        /// Use the interaction tables of the detector, where available
+        bool use_interaction_tables = true;
 
         /// Constructor with seed
         ///
@@ -72,28 +80,57 @@ struct random_scatterer : actor {
         using state = typename random_scatterer::state;
 
         template <typename material_group_t, typename index_t,
-                  typename surface_t>
+                  typename surface_t, typename algebra_t, typename tables_t>
         DETRAY_HOST_DEVICE inline void operator()(
             const material_group_t& material_group,
             const index_t& material_range,
-            const intersection2D<surface_t, transform3_type>& is, state& s,
-            const bound_track_parameters<transform3_type>& bound_params) const {
-
-            const scalar qop = bound_params.qop();
-            const scalar charge = bound_params.charge();
+            const intersection2D<surface_t, algebra_t>& is, state& s,
+            const bound_track_parameters<transform3_type>& bound_params,
+            const tables_t& tables, const std::size_t coll_idx) const {
+
+            const scalar_type qop{static_cast<scalar_type>(bound_params.qop())};
+            const scalar_type charge{
+                static_cast<scalar_type>(bound_params.charge())};
+            const scalar_type mass{static_cast<scalar_type>(s.mass)};
+
+            // Use the tabulated values, if available for the material and
+            // the momentum of the track
+            const auto* table =
+                s.use_interaction_tables
+                    ? tables.find(coll_idx,
+                                  detail::get_material_position(
+                                      material_group, material_range, is),
+                                  s.pdg, mass, charge)
+                    : nullptr;
+            const auto node = table ? table->locate(qop)
+                                    : typename tables_t::table_type::node{};
+            if (not node.in_range) {
+                table = nullptr;
+            }
 
+            // Homogeneous material or the bin of a material map at the
+            // local position of the intersection
             for (const auto& mat :
-                 detray::ranges::subrange(material_group, material_range)) {
+                 detail::get_material(material_group, material_range, is)) {
+
+                // Empty material map bin
+                if (not mat) {
+                    continue;
+                }
 
                 // Energy Loss
                 if (s.do_energy_loss) {
                     s.e_loss_mpv =
-                        interaction_type().compute_energy_loss_landau(
-                            is, mat, s.pdg, s.mass, qop, charge);
+                        table ? table->compute_energy_loss_landau(is, mat, node)
+                              : interaction_type().compute_energy_loss_landau(
+                                    is, mat, s.pdg, mass, qop, charge);
 
                     s.e_loss_sigma =
-                        interaction_type().compute_energy_loss_landau_sigma(
-                            is, mat, s.pdg, s.mass, qop, charge);
+                        table ? table->compute_energy_loss_landau_sigma(
+                                    is, mat, node)
+                              : interaction_type()
+                                    .compute_energy_loss_landau_sigma(
+                                        is, mat, s.pdg, mass, qop, charge);
                 }
 
                 // Covariance update
@@ -101,8 +138,11 @@ struct random_scatterer : actor {
                     // @todo: use momentum before or after energy loss in
                     // backward mode?
                     s.projected_scattering_angle =
-                        interaction_type().compute_multiple_scattering_theta0(
-                            is, mat, s.pdg, s.mass, qop, charge);
+                        table ? table->compute_multiple_scattering_theta0(
+                                    is, mat, node)
+                              : interaction_type()
+                                    .compute_multiple_scattering_theta0(
+                                        is, mat, s.pdg, mass, qop, charge);
                 }
             }
         }
@@ -122,8 +162,11 @@ struct random_scatterer : actor {
             const auto* det = navigation.detector();
             const auto& is = *navigation.current();
 
+            const auto& mat_link = is.surface.material();
             det->material_store().template visit<kernel>(
-                is.surface.material(), is, simulator_state, bound_params);
+                mat_link, is, simulator_state, bound_params,
+                det->interaction_tables(),
+                static_cast<std::size_t>(detail::get<0>(mat_link)));
 
             // Get the new momentum
             const auto new_mom =
@@ -8,23 +8,53 @@
 #pragma once
 
 // Project include(s).
+#include "detray/core/detector_handle.hpp"
 #include "detray/propagator/actor_chain.hpp"
 #include "detray/propagator/actors/aborters.hpp"
 #include "detray/propagator/actors/parameter_resetter.hpp"
 #include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/helix_stepper.hpp"
 #include "detray/propagator/navigator.hpp"
 #include "detray/propagator/propagator.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 #include "detray/simulation/event_writer.hpp"
 #include "detray/simulation/random_scatterer.hpp"
 
+// Covfie include(s).
+#include <covfie/core/backend/primitive/constant.hpp>
+
 // System include(s).
 #include <limits>
 #include <memory>
+#include <type_traits>
 
 namespace detray {
 
-template <typename detector_t, typename track_generator_t, typename smearer_t>
+namespace detail {
+
+/// Check whether a covfie field backend describes a homogeneous field
+/// @{
+template <typename bfield_backend_t>
+struct is_homogeneous_field : public std::false_type {};
+
+template <typename input_vector_t, typename output_vector_t>
+struct is_homogeneous_field<
+    covfie::backend::constant<input_vector_t, output_vector_t>>
+    : public std::true_type {};
+
+template <typename bfield_backend_t>
+inline constexpr bool is_homogeneous_field_v =
+    is_homogeneous_field<bfield_backend_t>::value;
+/// @}
+
+}  // namespace detail
+
+/// @tparam use_helix_stepper propagate on the analytic helix instead of
+///         integrating the equations of motion. Only for homogeneous fields
+///         and detectors without volume material, which the helix stepper
+///         does not take into account.
+template <typename detector_t, typename track_generator_t, typename smearer_t,
+          bool use_helix_stepper = false>
 struct simulator {
 
     using scalar_type = typename detector_t::scalar_type;
@@ -41,24 +71,58 @@ struct simulator {
         dtuple, parameter_transporter<transform3>, random_scatterer<transform3>,
         parameter_resetter<transform3>, event_writer<transform3, smearer_t>>;
 
+    static_assert(not use_helix_stepper or
+                      detail::is_homogeneous_field_v<
+                          typename detector_t::bfield_backend_type>,
+                  "The helix stepper needs a homogeneous field");
+
     using navigator_type = navigator<detector_t>;
-    using stepper_type = rk_stepper<typename bfield_type::view_t, transform3,
-                                    constrained_step<>>;
+    using stepper_type = std::conditional_t<
+        use_helix_stepper,
+        helix_stepper<typename bfield_type::view_t, transform3,
+                      constrained_step<>>,
+        rk_stepper<typename bfield_type::view_t, transform3,
+                   constrained_step<>>>;
     using propagator_type =
         propagator<stepper_type, navigator_type, actor_chain_type>;
 
-    simulator(std::size_t events, const detector_t& det,
+    /// Construct from a shared detector handle: Many simulators can run on
+    /// the same geometry without copying it.
+    simulator(std::size_t events, detector_handle<detector_t> det,
               track_generator_t&& track_gen, smearer_t& smearer,
               const std::string directory = "")
         : m_events(events),
           m_directory(directory),
-          m_detector(std::make_unique<detector_t>(det)),
+          m_detector(std::move(det)),
           m_track_generator(
               std::make_unique<track_generator_t>(std::move(track_gen))),
           m_smearer(smearer) {}
 
+    /// Construct from a detector, of which the simulator keeps its own copy.
+    /// Use a (non-owning) detector handle to avoid the copy.
+    simulator(std::size_t events, const detector_t& det,
+              track_generator_t&& track_gen, smearer_t& smearer,
+              const std::string directory = "")
+        : simulator(events, std::make_shared<const detector_t>(det),
+                    std::move(track_gen), smearer, directory) {}
+
+    /// Construct from a temporary detector, which the simulator takes over
+    simulator(std::size_t events, detector_t&& det,
+              track_generator_t&& track_gen, smearer_t& smearer,
+              const std::string directory = "")
+        : simulator(events, make_detector_handle(std::move(det)),
+                    std::move(track_gen), smearer, directory) {}
+
     config& get_config() { return m_cfg; }
 
+    /// @returns read-only access to the detector
+    const detector_t& get_detector() const { return *m_detector; }
+
+    /// @returns the shared detector handle
+    const detector_handle<detector_t>& get_detector_handle() const {
+        return m_detector;
+    }
+
     void run() {
 
         for (std::size_t event_id = 0u; event_id < m_events; event_id++) {
@@ -100,7 +164,7 @@ struct simulator {
     config m_cfg;
     std::size_t m_events{0u};
     std::string m_directory = "";
-    std::unique_ptr<detector_t> m_detector;
+    detector_handle<detector_t> m_detector;
     std::unique_ptr<track_generator_t> m_track_generator;
     smearer_t m_smearer;
 